@@ -2,10 +2,12 @@
 // Demo da nova arquitetura AAA do DriftEngine
 
 #include "Drift/Core/Log.h"
+#include "Drift/Core/Profiler.h"
 #include "Drift/Core/Threading/ThreadingSystem.h"
 #include "Drift/Core/Threading/ThreadingExample.h"
 #include "Drift/Core/Assets/AssetsSystem.h"
 #include "Drift/Core/Assets/AssetsExample.h"
+#include "Drift/Core/Assets/DerivedDataCache.h"
 #include "Drift/RHI/DX11/DeviceDX11.h"
 #include "Drift/RHI/ResourceManager.h"
 #include "Drift/RHI/RHIException.h"
@@ -18,6 +20,7 @@
 #include "Drift/UI/UIElement.h"
 #include "Drift/UI/Widgets/Button.h"
 #include "Drift/UI/Widgets/Label.h"
+#include "Drift/UI/Widgets/ProfilerOverlay.h"
 #include "Drift/RHI/DX11/RingBufferDX11.h"
 #include "Drift/RHI/DX11/UIBatcherDX11.h"
 #include <d3d11.h>
@@ -50,6 +53,7 @@ struct AppData {
     std::shared_ptr<UI::Label> debugLabel;
     std::shared_ptr<UI::Label> performanceLabel;
     std::shared_ptr<UI::Label> instructionLabel;
+    std::shared_ptr<UI::ProfilerOverlay> profilerOverlay;
     
     // Contadores para animação
     float animationTime = 0.0f;
@@ -132,9 +136,17 @@ int main() {
         assetsConfig.enablePreloading = true;
         assetsConfig.enableLazyUnloading = true;
         assetsConfig.maxConcurrentLoads = 8;
+        assetsConfig.prefetchManifestPath = "cache/startup.dpfm";
+        assetsConfig.recordPrefetchManifest = true;
         
         assetsSystem.Initialize(assetsConfig);
         Core::Log("[App] Sistema de assets inicializado");
+
+        // Cache persistente de dados derivados (texturas decodificadas etc.)
+        Drift::Core::Assets::DerivedDataCacheConfig ddcConfig;
+        ddcConfig.directory = "cache/ddc";
+        ddcConfig.maxCacheSize = 1024ull * 1024 * 1024; // 1GB
+        Drift::Core::Assets::DerivedDataCache::GetInstance().Initialize(ddcConfig);
         
         // Executa exemplo básico do sistema de assets
         Core::Log("[App] Executando exemplo do sistema de assets...");
@@ -273,6 +285,13 @@ int main() {
             performanceLabel->MarkDirty();
             root->AddChild(performanceLabel);
             
+            // Overlay do profiler: gráfico de frames e seções mais caras (F4 mostra/esconde)
+            auto profilerOverlay = std::make_shared<UI::ProfilerOverlay>(uiContext.get());
+            profilerOverlay->SetPosition({860.0f, 20.0f});
+            profilerOverlay->SetSize({400.0f, profilerOverlay->GetSize().y});
+            profilerOverlay->SetVisible(false);
+            root->AddChild(profilerOverlay);
+            
             // Label de instruções
             auto instructionLabel = std::make_shared<UI::Label>(uiContext.get());
             instructionLabel->SetName("InstructionLabel");
@@ -378,6 +397,7 @@ int main() {
         appData.debugLabel = std::static_pointer_cast<UI::Label>(appData.uiContext->GetRoot()->FindChildByName("DebugLabel"));
         appData.performanceLabel = std::static_pointer_cast<UI::Label>(appData.uiContext->GetRoot()->FindChildByName("PerformanceLabel"));
         appData.instructionLabel = std::static_pointer_cast<UI::Label>(appData.uiContext->GetRoot()->FindChildByName("InstructionLabel"));
+        appData.profilerOverlay = std::static_pointer_cast<UI::ProfilerOverlay>(appData.uiContext->GetRoot()->FindChildByName("ProfilerOverlay"));
 
         // ================================
         // 4.c UI BATCHER E RING BUFFER
@@ -408,16 +428,25 @@ int main() {
         // ================================
 
         // Entrando no loop principal...
-        // Controles: F1 = Wireframe, ESC = Sair, R = Recarregar fontes
+        // Controles: F1 = Wireframe, F2 = Capturar timeline, F3 = Amostragem, F4 = Overlay do profiler,
+        // ESC = Sair, R = Recarregar fontes
         
         double lastTime = glfwGetTime();
         double fpsTime = lastTime;
         int frameCount = 0;
         float fps = 0.0f;
+        bool timelinePending = false;
+        
+        // Frames acima de 50 ms (3 frames a 60 Hz) gravam a timeline dos 30 anteriores em profiler_spikes/
+        Core::ProfilerConfig profilerConfig;
+        profilerConfig.spikeThresholdMs = 50.0;
+        Core::Profiler::GetInstance().Configure(profilerConfig);
+        Core::Profiler::GetInstance().SetThreadName("Main");
         
         Core::Log("[App] Iniciando loop principal...");
         
         while (!glfwWindowShouldClose(window)) {
+            Core::Profiler::GetInstance().BeginFrame();
             glfwPollEvents();
             
             // ---- TIMING ----
@@ -463,6 +492,29 @@ int main() {
                     std::string(appData.renderManager->IsWireframeMode() ? "ON" : "OFF"));
             }
             
+            // Capturar timeline dos próximos 120 frames com F2 (exportada ao terminar)
+            if (input.IsKeyPressed(Engine::Input::Key::F2) && !timelinePending) {
+                Core::Profiler::GetInstance().StartCapture(120);
+                timelinePending = true;
+            }
+            
+            // Amostragem de pilhas com F3: liga, e ao desligar grava o flamegraph (formato folded)
+            if (input.IsKeyPressed(Engine::Input::Key::F3)) {
+                auto& sampler = Core::SamplingProfiler::GetInstance();
+                if (sampler.IsRunning()) {
+                    sampler.Stop();
+                    sampler.ExportFoldedStacks("profiler_samples.folded");
+                    sampler.Clear();
+                } else {
+                    sampler.Start(1000);
+                }
+            }
+            
+            // Overlay do profiler com F4
+            if (input.IsKeyPressed(Engine::Input::Key::F4) && appData.profilerOverlay) {
+                appData.profilerOverlay->SetVisible(!appData.profilerOverlay->IsVisible());
+            }
+            
             // Recarregar fontes com R
             if (input.IsKeyPressed(Engine::Input::Key::R)) {
                 Core::Log("[App] Recarregando fontes...");
@@ -627,6 +679,13 @@ int main() {
             
             // ---- PRESENT ----
             appData.context->Present();
+            
+            // Fim de frame: agrega os eventos do profiler, atualiza percentis e verifica picos
+            Core::Profiler::GetInstance().EndFrame();
+            if (timelinePending && !Core::Profiler::GetInstance().IsCapturing()) {
+                Core::Profiler::GetInstance().ExportChromeTrace("profiler_timeline.json");
+                timelinePending = false;
+            }
         }
 
         // ================================
@@ -680,6 +739,7 @@ int main() {
         // Shutdown do sistema de assets
         Core::Log("[App] Finalizando sistema de assets...");
         Drift::Core::Assets::AssetsSystem::GetInstance().Shutdown();
+        Drift::Core::Assets::DerivedDataCache::GetInstance().Shutdown();
 
         // Cleanup automático via RAII
         glfwDestroyWindow(window);
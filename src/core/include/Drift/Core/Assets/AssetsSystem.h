@@ -1,10 +1,19 @@
 #pragma once
 
 #include "Drift/Core/Threading/ThreadingSystem.h"
+#include "Drift/Core/IO/MappedFile.h"
+#include "Drift/Core/IO/ArchiveFileSystem.h"
+#include "Drift/Core/IO/AsyncIO.h"
+#include "Drift/Core/Hash.h"
+#include "Drift/Core/Clock.h"
+#include "Drift/Core/ProfiledMutex.h"
 #include "Drift/Core/Log.h"
+#include "Drift/Core/Assets/PrefetchManifest.h"
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
+#include <string_view>
 #include <mutex>
 #include <functional>
 #include <typeindex>
@@ -14,6 +23,10 @@
 #include <any>
 #include <future>
 #include <queue>
+#include <map>
+#include <array>
+#include <atomic>
+#include <thread>
 
 namespace Drift::Core::Assets {
 
@@ -38,6 +51,18 @@ enum class AssetStatus {
     Unloading       // Asset sendo descarregado
 };
 
+/**
+ * @brief Orçamento de memória de um tipo de asset
+ *
+ * budget limita o tipo (ao ultrapassar, só assets do próprio tipo são despejados);
+ * reservation é a fatia garantida: outros tipos não despejam o tipo abaixo dela
+ * nem ocupam a parte ainda não usada.
+ */
+struct AssetMemoryBudget {
+    size_t budget = 0;              // Limite do tipo (0 = apenas o limite global)
+    size_t reservation = 0;         // Memória reservada ao tipo
+};
+
 /**
  * @brief Configuração do sistema de assets
  */
@@ -50,6 +75,16 @@ struct AssetsConfig {
     float trimThreshold = 0.8f;                    // Threshold para limpeza (80%)
     size_t maxConcurrentLoads = 8;                 // Máximo de carregamentos simultâneos
     std::string defaultAssetPath = "assets/";      // Caminho padrão para assets
+    bool enableMemoryMappedIO = true;              // Mapeia arquivos e entrega FileView aos loaders
+    bool enableAsyncIO = true;                     // Carregamentos da fila leem o arquivo via IO::AsyncIO
+    std::unordered_map<std::type_index, AssetMemoryBudget> memoryBudgets;   // Orçamentos por tipo
+    std::string prefetchManifestPath;              // Manifesto de pré-busca ("" = desativado)
+    bool recordPrefetchManifest = false;           // Grava os pedidos da sessão no manifesto ao finalizar
+    bool replayPrefetchManifest = true;            // Reproduz o manifesto existente ao inicializar
+    float prefetchManifestWindow = 30.0f;          // Segundos gravados após o início da gravação
+    uint32_t prefetchManifestLeadMs = 2000;        // Antecedência da reprodução sobre os tempos gravados
+    bool enableQualityDowngrade = false;           // Sob pressão de memória reduz a qualidade antes de despejar
+    bool enableContentDedup = true;                // Compartilha bytes e assets de conteúdo idêntico
 };
 
 /**
@@ -76,6 +111,15 @@ public:
     virtual void UpdateAccess() = 0;
 };
 
+/**
+ * @brief Nível da escada de qualidade de um loader
+ */
+struct AssetQualityLevel {
+    std::string variant;            // Nome do nível (ex.: "half")
+    float memoryScale = 1.0f;       // Memória relativa ao primeiro nível (estimativa da economia)
+    std::any params;                // Parâmetros entregues ao loader neste nível
+};
+
 /**
  * @brief Interface para loaders de assets
  */
@@ -86,27 +130,98 @@ public:
     
     // Carregamento
     virtual std::shared_ptr<T> Load(const std::string& path, const std::any& params = {}) = 0;
+    
+    /**
+     * @brief Carrega a partir de um arquivo já mapeado em memória (zero-copy)
+     * 
+     * Loaders que conseguem interpretar os bytes in-place devem sobrescrever
+     * este método e reter o FileView em vez de copiar os dados. A implementação
+     * padrão ignora a visão e recorre a Load(path, params).
+     */
+    virtual std::shared_ptr<T> Load(const std::string& path, const IO::FileView& data, const std::any& params = {}) {
+        (void)data;
+        return Load(path, params);
+    }
+    
     virtual bool CanLoad(const std::string& path) const = 0;
     virtual std::vector<std::string> GetSupportedExtensions() const = 0;
     
+    /**
+     * @brief Dependências que devem estar prontas antes deste asset
+     * 
+     * Podem ser outros assets (resolvidos pela extensão) ou arquivos brutos,
+     * que são apenas pré-buscados. Ex.: um layout de UI depende de suas fontes e imagens.
+     */
+    virtual std::vector<std::string> GetDependencies(const std::string& path) const {
+        (void)path;
+        return {};
+    }
+    
+    /**
+     * @brief Escada de qualidade, da mais cara para a mais barata
+     * 
+     * Com enableQualityDowngrade, sob pressão de memória os assets menos usados são
+     * recarregados no nível seguinte (Load com os params do nível) antes de qualquer
+     * despejo. O primeiro nível é a qualidade normal. Vazio = sem redução de qualidade.
+     */
+    virtual std::vector<AssetQualityLevel> GetQualityLadder() const {
+        return {};
+    }
+    
     // Informações
     virtual std::string GetLoaderName() const = 0;
     virtual size_t EstimateMemoryUsage(const std::string& path) const = 0;
 };
 
+/**
+ * @brief Identificador 64-bit de um asset (hash de caminho + variante)
+ * 
+ * Calculado uma única vez a partir das strings; comparações e buscas usam
+ * apenas o valor inteiro. Colisões de 64 bits são consideradas impossíveis na prática.
+ */
+struct AssetId {
+    uint64_t value = 0;
+    
+    constexpr AssetId() = default;
+    constexpr explicit AssetId(uint64_t v) : value(v) {}
+    
+    static AssetId FromPath(std::string_view path, std::string_view variant = {}) {
+        uint64_t hash = Hash64(path);
+        return AssetId(variant.empty() ? hash : Hash64(variant, hash));
+    }
+    
+    constexpr bool IsValid() const { return value != 0; }
+    constexpr bool operator==(const AssetId& other) const { return value == other.value; }
+    constexpr bool operator!=(const AssetId& other) const { return value != other.value; }
+};
+
+struct AssetIdHash {
+    size_t operator()(const AssetId& id) const noexcept {
+        return static_cast<size_t>(id.value);
+    }
+};
+
 /**
  * @brief Chave única para identificação de assets
+ * 
+ * Igualdade e hash usam somente (id, tipo); path e variante são mantidos nas
+ * chaves armazenadas para logs, callbacks e carregamento. Chaves de busca
+ * construídas a partir de um AssetId não carregam strings.
  */
 struct AssetKey {
-    std::string path;
+    AssetId id;
     std::type_index type;
+    std::string path;
     std::string variant;
     
     AssetKey(const std::string& p, std::type_index t, const std::string& v = "")
-        : path(p), type(t), variant(v) {}
+        : id(AssetId::FromPath(p, v)), type(t), path(p), variant(v) {}
+    
+    AssetKey(AssetId i, std::type_index t)
+        : id(i), type(t) {}
     
     bool operator==(const AssetKey& other) const {
-        return path == other.path && type == other.type && variant == other.variant;
+        return id == other.id && type == other.type;
     }
     
     std::string ToString() const {
@@ -119,20 +234,103 @@ struct AssetKey {
  */
 struct AssetKeyHash {
     size_t operator()(const AssetKey& k) const noexcept {
-        return std::hash<std::string>{}(k.path) ^ 
-               (std::hash<std::type_index>{}(k.type) << 1) ^
-               (std::hash<std::string>{}(k.variant) << 2);
+        return static_cast<size_t>(HashCombine64(k.id.value, k.type.hash_code()));
     }
 };
 
+template<typename T>
+class AssetPin;
+
+/**
+ * @brief Handle tipado para o slot de um asset residente ({índice, geração})
+ * 
+ * Valor simples de 8 bytes: copiar não toca contadores atômicos nem mantém o
+ * asset residente. Quando o asset é despejado a geração do slot avança e o
+ * handle passa a ser rejeitado (IsAlive() == false, Pin() vazio). Para usar o
+ * asset, fixe-o com Pin() pelo escopo do uso.
+ */
+template<typename T>
+class AssetHandle {
+public:
+    AssetHandle() = default;
+    AssetHandle(uint32_t index, uint32_t generation) : m_Index(index), m_Generation(generation) {}
+    
+    uint32_t GetIndex() const { return m_Index; }
+    uint32_t GetGeneration() const { return m_Generation; }
+    bool IsValid() const { return m_Generation != 0; }
+    
+    // Implementados após AssetsSystem
+    bool IsAlive() const;
+    AssetPin<T> Pin() const;
+    
+    bool operator==(const AssetHandle& other) const { return m_Index == other.m_Index && m_Generation == other.m_Generation; }
+    bool operator!=(const AssetHandle& other) const { return !(*this == other); }
+
+private:
+    uint32_t m_Index = 0;
+    uint32_t m_Generation = 0;
+};
+
+/**
+ * @brief Fixação de um asset pelo escopo (RAII, apenas movível)
+ * 
+ * Enquanto existir, o asset não é despejado, descarregado nem trocado por
+ * outra variante; o ponteiro permanece válido. Fixações longas impedem o
+ * cache de liberar memória: fixe durante o uso (ex.: um quadro), não para sempre.
+ */
+template<typename T>
+class AssetPin {
+public:
+    AssetPin() = default;
+    ~AssetPin() { Release(); }
+    
+    AssetPin(const AssetPin&) = delete;
+    AssetPin& operator=(const AssetPin&) = delete;
+    AssetPin(AssetPin&& other) noexcept : m_Index(other.m_Index), m_Asset(other.m_Asset) { other.m_Asset = nullptr; }
+    AssetPin& operator=(AssetPin&& other) noexcept {
+        if (this != &other) {
+            Release();
+            m_Index = other.m_Index;
+            m_Asset = other.m_Asset;
+            other.m_Asset = nullptr;
+        }
+        return *this;
+    }
+    
+    T* Get() const { return m_Asset; }
+    T* operator->() const { return m_Asset; }
+    T& operator*() const { return *m_Asset; }
+    explicit operator bool() const { return m_Asset != nullptr; }
+    
+    // Implementado após AssetsSystem
+    void Release();
+
+private:
+    friend class AssetsSystem;
+    AssetPin(uint32_t index, T* asset) : m_Index(index), m_Asset(asset) {}
+    
+    uint32_t m_Index = 0;
+    T* m_Asset = nullptr;
+};
+
+/**
+ * @brief Contadores de acesso de um asset (LRU)
+ *
+ * Compartilhados entre a entrada do cache e o índice de leitura, para que
+ * GetAsset registre o acesso sem travar m_Mutex.
+ */
+struct AssetAccessCounters {
+    std::atomic<size_t> lastAccess{0};
+    std::atomic<size_t> accessCount{0};
+};
+
 /**
  * @brief Entrada de asset no cache
  */
 struct AssetCacheEntry {
     std::shared_ptr<IAsset> asset;
     AssetStatus status = AssetStatus::NotLoaded;
-    size_t lastAccess = 0;
-    size_t accessCount = 0;
+    std::shared_ptr<AssetAccessCounters> access = std::make_shared<AssetAccessCounters>();
     size_t memoryUsage = 0;
     std::chrono::steady_clock::time_point loadTime;
     bool isPreloaded = false;
@@ -141,6 +339,18 @@ struct AssetCacheEntry {
     
     // Para carregamento assíncrono
     bool isAsyncLoading = false;
+    
+    // Registro de deduplicação (hash do conteúdo + tipo; 0 = instância não compartilhável)
+    uint64_t contentHash = 0;
+    
+    // Slot do handle (0 = sem slot; atribuído quando o asset fica pronto)
+    uint32_t slot = 0;
+    
+    // Escada de qualidade (índice do nível atual e redução em andamento)
+    size_t qualityLevel = 0;
+    bool canDowngrade = true;
+    bool downgradePending = false;
+    size_t pendingSavings = 0;
 };
 
 /**
@@ -158,12 +368,25 @@ struct AssetsStats {
     size_t loadCount = 0;
     size_t unloadCount = 0;
     size_t asyncLoadCount = 0;
+    size_t downgradeCount = 0;          // Reduções de qualidade concluídas
+    size_t downgradedAssets = 0;        // Assets abaixo da qualidade pedida
+    size_t pendingDowngrades = 0;
+    size_t dedupSharedAssets = 0;       // Entradas que reutilizam a instância de outra
+    size_t dedupMemorySaved = 0;        // Memória de assets não duplicada
+    size_t dedupPayloadHits = 0;        // Payloads entregues a partir de um buffer já vivo
+    size_t dedupPayloadBytes = 0;       // Bytes desses payloads
+    size_t evictionCount = 0;           // Assets despejados por limite de memória ou contagem
+    double evictionTime = 0.0;          // Tempo total gasto escolhendo e despejando (s)
+    size_t lockAcquisitions = 0;        // Aquisições do lock do cache
+    size_t lockContentions = 0;         // Aquisições que precisaram esperar
+    double lockWaitTime = 0.0;          // Tempo total de espera pelo lock (s)
     double averageLoadTime = 0.0;
     
     // Estatísticas por tipo
     std::unordered_map<std::type_index, size_t> assetsByType;
     std::unordered_map<std::type_index, size_t> memoryByType;
     std::unordered_map<std::type_index, size_t> loadCountByType;
+    std::unordered_map<std::type_index, AssetMemoryBudget> memoryBudgets;
 };
 
 /**
@@ -209,6 +432,30 @@ public:
     template<typename T>
     std::shared_ptr<T> GetAsset(const std::string& path, const std::string& variant = "");
     
+    // Busca sem strings (caminho quente)
+    template<typename T>
+    std::shared_ptr<T> GetAsset(AssetId id);
+    
+    // Handles por slot: cópia barata, fixação explícita, seguros após despejo
+    template<typename T>
+    AssetHandle<T> GetHandle(AssetId id) const;
+    
+    template<typename T>
+    AssetHandle<T> GetHandle(const std::string& path, const std::string& variant = "") const {
+        return GetHandle<T>(AssetId::FromPath(path, variant));
+    }
+    
+    template<typename T>
+    AssetHandle<T> LoadAssetHandle(const std::string& path, const std::string& variant = "",
+                                   const std::any& params = {}, AssetPriority priority = AssetPriority::Normal);
+    
+    template<typename T>
+    AssetPin<T> Pin(const AssetHandle<T>& handle) const {
+        return AssetPin<T>(handle.GetIndex(), static_cast<T*>(PinSlot(handle.GetIndex(), handle.GetGeneration())));
+    }
+    
+    bool IsHandleAlive(uint32_t index, uint32_t generation) const;
+    
     template<typename T>
     std::shared_ptr<T> GetOrLoadAsset(const std::string& path, const std::string& variant = "", 
                                      const std::any& params = {}, AssetPriority priority = AssetPriority::Normal);
@@ -223,7 +470,19 @@ public:
     void PreloadAsset(const std::string& path, const std::string& variant = "", 
                      const std::any& params = {}, AssetPriority priority = AssetPriority::Low);
     
-    void PreloadAssets(const std::vector<std::string>& paths);
+    // Pré-carregamento sem tipo: resolve o loader pela extensão e percorre o grafo
+    // de dependências, carregando em paralelo em ordem topológica (não bloqueante)
+    void PreloadAssets(const std::vector<std::string>& paths, AssetPriority priority = AssetPriority::Low);
+    
+    // Grafo de dependências explícito (somado ao declarado pelos loaders)
+    void AddDependency(const std::string& path, const std::string& dependency);
+    void ClearDependencies(const std::string& path);
+    std::vector<std::string> GetDependencies(const std::string& path) const;
+    
+    // Arquivos .dpak montados (o último montado tem precedência sobre arquivos soltos)
+    bool MountArchive(const std::string& archivePath, const std::string& mountPoint = "");
+    bool UnmountArchive(const std::string& archivePath);
+    std::vector<std::string> GetMountedArchives() const;
     
     // Gerenciamento de cache
     void UnloadAsset(const std::string& path, std::type_index type, const std::string& variant = "");
@@ -232,10 +491,21 @@ public:
     void ClearCache();
     void TrimCache();
     
+    // Orçamentos de memória por tipo (ajustáveis em tempo de execução; despejam na hora se preciso)
+    void SetMemoryBudget(std::type_index type, const AssetMemoryBudget& budget);
+    void ClearMemoryBudget(std::type_index type);
+    AssetMemoryBudget GetMemoryBudget(std::type_index type) const;
+    void SetMaxMemoryUsage(size_t bytes);
+    size_t GetMemoryUsage(std::type_index type) const;
+    
     // Status e verificação
     bool IsAssetLoaded(const std::string& path, std::type_index type, const std::string& variant = "") const;
     bool IsAssetLoading(const std::string& path, std::type_index type, const std::string& variant = "") const;
     AssetStatus GetAssetStatus(const std::string& path, std::type_index type, const std::string& variant = "") const;
+    bool IsAssetLoaded(AssetId id, std::type_index type) const;
+    bool IsAssetLoading(AssetId id, std::type_index type) const;
+    AssetStatus GetAssetStatus(AssetId id, std::type_index type) const;
+    size_t GetQualityLevel(AssetId id, std::type_index type) const;     // Índice na escada de qualidade
     bool CanLoadAsset(const std::string& path, std::type_index type) const;
     std::vector<std::string> GetSupportedExtensions(std::type_index type) const;
     
@@ -253,36 +523,165 @@ public:
     void SetAssetUnloadedCallback(AssetUnloadedCallback callback) { m_AssetUnloadedCallback = callback; }
     void SetAssetFailedCallback(AssetFailedCallback callback) { m_AssetFailedCallback = callback; }
     
+    // Fila de carregamento assíncrono (maior prioridade primeiro, até maxConcurrentLoads em paralelo)
+    // Só afetam pedidos ainda na fila; carregamentos em andamento não são interrompidos
+    bool SetLoadPriority(const std::string& path, std::type_index type, AssetPriority priority, const std::string& variant = "");
+    bool SetLoadPriority(AssetId id, std::type_index type, AssetPriority priority);
+    bool CancelLoad(const std::string& path, std::type_index type, const std::string& variant = "");
+    bool CancelLoad(AssetId id, std::type_index type);
+    
+    // Manifesto de pré-busca: grava a ordem dos pedidos de uma sessão e, na próxima,
+    // reproduz como pré-busca de baixa prioridade (também feito por Initialize/Shutdown)
+    void StartManifestRecording();
+    bool StopManifestRecording(const std::string& path);
+    bool IsRecordingManifest() const { return m_RecordingManifest.load(); }
+    bool ReplayPrefetchManifest(const std::string& path);
+    
     // Utilitários
     void WaitForAllLoads();
     void CancelAllLoads();
-    size_t GetLoadingCount() const;
-    size_t GetQueuedCount() const;
+    size_t GetLoadingCount() const;     // Carregamentos em execução
+    size_t GetQueuedCount() const;      // Pedidos aguardando na fila
 
 private:
+    template<typename> friend class AssetPin;
+    
     AssetsSystem() = default;
-    ~AssetsSystem() = default;
+    ~AssetsSystem();
     AssetsSystem(const AssetsSystem&) = delete;
     AssetsSystem& operator=(const AssetsSystem&) = delete;
     
     // Cache de assets
-    std::unordered_map<AssetKey, AssetCacheEntry, AssetKeyHash> m_Assets;
+    using AssetMap = std::unordered_map<AssetKey, AssetCacheEntry, AssetKeyHash>;
+    AssetMap m_Assets;
+    
+    // Memória contabilizada incrementalmente (total e por tipo)
+    size_t m_MemoryUsage = 0;
+    std::unordered_map<std::type_index, size_t> m_MemoryByType;
+    
+    // Economia estimada das reduções de qualidade ainda na fila
+    size_t m_PendingDowngradeSavings = 0;
+    std::unordered_map<std::type_index, size_t> m_PendingSavingsByType;
+    
+    // Índice de leitura sem locks (GetAsset): cópias imutáveis por shard, trocadas pelos
+    // escritores sob m_Mutex e liberadas por época quando nenhum leitor pode vê-las
+    struct PublishedShard;
+    struct ThreadSlot;
+    static constexpr size_t kPublishedShardCount = 64;
+    std::array<std::atomic<const PublishedShard*>, kPublishedShardCount> m_PublishedShards{};
+    std::vector<std::pair<uint64_t, const PublishedShard*>> m_RetiredShards;   // (época, shard)
+    std::atomic<uint64_t> m_ReadEpoch{1};
+    mutable std::atomic<ThreadSlot*> m_ThreadSlots{nullptr};
+    mutable std::atomic<size_t> m_AccessCounter{0};
+    
+    ThreadSlot& GetThreadSlot() const;
+    std::shared_ptr<IAsset> FindPublishedAsset(AssetId id, std::type_index type, bool recordAccess = true) const;
+    std::pair<uint32_t, uint32_t> FindPublishedSlot(AssetId id, std::type_index type) const;
+    void PublishAsset(const AssetKey& key, const AssetCacheEntry& entry);
+    void UnpublishAsset(const AssetKey& key);
+    void UnpublishAllAssets();
+    void ReplacePublishedShard(size_t index, const PublishedShard* shard);
+    void ReclaimRetiredShards();
+    void RecordCacheHit() const;
+    void RecordCacheMiss() const;
+    void RecordAccess(AssetAccessCounters& access) const;
+    
+    // Slot map dos handles: blocos de tamanho fixo (endereços estáveis, leitura sem lock);
+    // alocação e liberação sob m_Mutex, fixação por CAS no estado do slot
+    struct AssetSlot;
+    static constexpr size_t kSlotChunkSize = 1024;
+    static constexpr size_t kMaxSlotChunks = 1024;
+    std::array<std::atomic<AssetSlot*>, kMaxSlotChunks> m_SlotChunks{};
+    std::vector<uint32_t> m_FreeSlots;
+    uint32_t m_SlotCount = 1;       // Índice 0 reservado (handle nulo)
+    
+    AssetSlot* GetSlot(uint32_t index) const;
+    void AttachSlot(AssetCacheEntry& entry);
+    bool ReleaseSlot(AssetCacheEntry& entry);
+    bool SwapSlotAsset(AssetCacheEntry& entry, IAsset* asset);
+    bool IsSlotPinned(const AssetCacheEntry& entry) const;
+    uint32_t GetSlotGeneration(uint32_t index) const;
+    IAsset* PinSlot(uint32_t index, uint32_t generation) const;
+    void UnpinSlot(uint32_t index) const;
     
     // Loaders registrados
     std::unordered_map<std::type_index, std::any> m_Loaders;
     
+    // Acesso sem tipo aos loaders (pré-carregamento por extensão)
+    struct LoaderBinding {
+        std::vector<std::string> extensions;
+        std::function<bool(const std::string&)> canLoad;
+        std::function<std::vector<std::string>(const std::string&)> getDependencies;
+        std::function<void(const std::string&, const std::string&, AssetPriority, std::function<void()>)> requestLoad;
+        std::vector<AssetQualityLevel> qualityLadder;
+        std::function<void(const AssetKey&, size_t, const AssetQualityLevel&)> requestDowngrade;
+    };
+    std::unordered_map<std::type_index, LoaderBinding> m_LoaderBindings;
+    std::unordered_map<std::string, std::type_index> m_ExtensionToType;
+    std::unordered_map<std::string, std::vector<std::string>> m_Dependencies;
+    std::atomic<size_t> m_PendingPreloads{0};
+    
+    // Manifesto de pré-busca
+    std::atomic<bool> m_RecordingManifest{false};
+    std::chrono::steady_clock::time_point m_ManifestStart;
+    std::vector<PrefetchManifestEntry> m_ManifestEntries;
+    std::unordered_set<uint64_t> m_ManifestSeen;
+    std::vector<PrefetchManifestEntry> m_PendingReplay;     // Aguardando o loader ou o tempo gravado
+    std::chrono::steady_clock::time_point m_ReplayStart;
+    std::atomic<bool> m_ReplayPending{false};
+    std::mutex m_ManifestMutex;
+    void RecordManifestRequest(const AssetKey& key);
+    void DispatchPendingReplay();
+    
+    struct PreloadBatch;
+    void DispatchPreload(const std::shared_ptr<PreloadBatch>& batch, size_t index);
+    void CompletePreload(const std::shared_ptr<PreloadBatch>& batch, size_t index);
+    
+    // Fila de carregamento assíncrono
+    using LoadCompletion = std::function<void()>;
+    struct LoadRequest {
+        AssetKey key;
+        AssetPriority priority = AssetPriority::Normal;
+        uint64_t sequence = 0;
+        std::function<void(const IO::FileView&)> execute;
+        std::vector<LoadCompletion> completions;    // Executadas ao concluir ou cancelar
+        bool inFlight = false;
+    };
+    using LoadQueueOrder = std::pair<int, uint64_t>;    // (-prioridade, ordem de chegada)
+    std::unordered_map<AssetKey, LoadRequest, AssetKeyHash> m_LoadRequests;
+    std::map<LoadQueueOrder, AssetKey> m_LoadQueue;
+    size_t m_InFlightLoads = 0;
+    uint64_t m_LoadSequence = 0;
+    mutable std::mutex m_LoadQueueMutex;
+    
+    void EnqueueLoad(const AssetKey& key, AssetPriority priority, std::function<void(const IO::FileView&)> execute,
+                     LoadCompletion completion);
+    void PumpLoadQueue();
+    void SubmitLoadTask(const AssetKey& key, AssetPriority priority, IO::FileView data);
+    void RunQueuedLoad(const AssetKey& key, const IO::FileView& data);
+    bool m_OwnsAsyncIO = false;
+    void FinishCancelledLoads(std::vector<LoadRequest>& cancelled);
+    
+    // Arquivos .dpak montados
+    struct MountedArchive {
+        std::string mountPoint;
+        std::shared_ptr<IO::ArchiveFileSystem> archive;
+    };
+    std::vector<MountedArchive> m_Archives;
+    mutable std::mutex m_ArchiveMutex;
+    
     // Configuração e estado
     AssetsConfig m_Config;
-    mutable std::mutex m_Mutex;
-    size_t m_AccessCounter = 0;
+    mutable ProfiledMutex m_Mutex{"AssetsSystem"};
     bool m_Initialized = false;
     
-    // Estatísticas
-    mutable size_t m_CacheHits = 0;
-    mutable size_t m_CacheMisses = 0;
+    // Estatísticas (cache hits/misses ficam nos contadores por thread)
     mutable size_t m_LoadCount = 0;
     mutable size_t m_UnloadCount = 0;
     mutable size_t m_AsyncLoadCount = 0;
+    mutable size_t m_DowngradeCount = 0;
+    mutable size_t m_EvictionCount = 0;
+    mutable double m_EvictionTime = 0.0;
     mutable double m_TotalLoadTime = 0.0;
     
     // Callbacks
@@ -294,7 +693,73 @@ private:
     template<typename T>
     IAssetLoader<T>* GetLoader() const;
     
+    template<typename T>
+    std::shared_ptr<T> InvokeLoader(IAssetLoader<T>* loader, const std::string& path, const IO::FileView& data,
+                                    const std::any& params);
+    
+    template<typename T>
+    void ExecuteLoad(const AssetKey& key, const std::any& params, const IO::FileView& prefetched = {});
+    
+    template<typename T>
+    void ExecuteDowngrade(const AssetKey& key, size_t level, const AssetQualityLevel& quality, const IO::FileView& data);
+    
+    template<typename T>
+    void RequestLoadUntyped(const std::string& path, const std::string& variant, AssetPriority priority,
+                            LoadCompletion completion);
+    
+    static std::string GetExtension(const std::string& path);
+    void RegisterExtensions(std::type_index type, const std::vector<std::string>& extensions);
+    void UnregisterExtensions(std::type_index type);
+    void PrefetchFile(const std::string& path) const;
+    
+    IO::FileView ReadFromArchives(const std::string& path) const;
+    IO::FileView OpenPayload(const std::string& path) const;
+    
+    // Deduplicação por conteúdo: bytes idênticos são entregues a partir de um único buffer
+    // vivo; assets do mesmo tipo com o mesmo conteúdo (sem params) compartilham a instância,
+    // com a memória contada uma vez no primeiro dono e repassada quando ele sai
+    struct SharedPayload {
+        std::weak_ptr<const void> owner;
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        const IO::MappedFile* mapping = nullptr;
+    };
+    struct SharedAssetRecord {
+        std::weak_ptr<IAsset> asset;
+        std::vector<AssetKey> owners;       // O primeiro é quem contabiliza a memória
+        size_t memory = 0;
+    };
+    std::unordered_map<uint64_t, SharedPayload> m_SharedPayloads;
+    size_t m_PayloadPruneThreshold = 64;
+    mutable std::mutex m_PayloadMutex;
+    std::atomic<size_t> m_DedupPayloadHits{0};
+    std::atomic<size_t> m_DedupPayloadBytes{0};
+    std::unordered_map<uint64_t, SharedAssetRecord> m_SharedAssets;     // HashCombine64(conteúdo, tipo)
+    
+    uint64_t HashPayload(const IO::FileView& view) const;                  // Sem locks; 0 = não deduplica
+    uint64_t DedupPayload(IO::FileView& view, uint64_t hash);              // Só a busca/inserção sob m_PayloadMutex
+    uint64_t DedupPayload(IO::FileView& view) { return DedupPayload(view, HashPayload(view)); }
+    std::shared_ptr<IAsset> FindSharedAsset(std::type_index type, uint64_t contentHash) const;
+    void AttachSharedAsset(const AssetKey& key, AssetCacheEntry& entry, uint64_t contentHash);
+    void DetachSharedAsset(const AssetKey& key, AssetCacheEntry& entry);
+    size_t GetShareCount(const AssetCacheEntry& entry) const;
+    void UnloadEntryAsset(AssetCacheEntry& entry);
+    bool IsInMountedArchive(const std::string& path) const;
     bool EvictLeastUsedAsset();
+    bool EvictLeastUsedAsset(std::type_index requester, bool sameTypeOnly);
+    bool EvictLeastUsedAssetUntimed(std::type_index requester, bool sameTypeOnly);
+    bool MakeRoomFor(std::type_index type, size_t memory);
+    bool ScheduleDowngrade(std::type_index requester, bool sameTypeOnly);
+    void EnqueueDowngrade(const AssetKey& key, size_t level, std::function<void(const IO::FileView&)> execute);
+    void FinishDowngrade(const AssetKey& key);
+    void ClearPendingDowngrade(std::type_index type, AssetCacheEntry& entry);
+    size_t GetProjectedTypeMemory(std::type_index type) const;
+    void EnforceMemoryBudgets();
+    size_t GetUnusedReservations(std::type_index excluded) const;
+    const AssetMemoryBudget* FindMemoryBudget(std::type_index type) const;
+    size_t GetTypeMemoryUsage(std::type_index type) const;
+    void SetEntryMemory(std::type_index type, AssetCacheEntry& entry, size_t memory);
+    bool EraseAssetEntry(AssetMap::iterator& it);     // Descarrega e remove; false se fixada (it intacto)
     void UpdateAccessStats(AssetCacheEntry& entry);
     size_t CalculateCurrentMemoryUsage() const;
     void TriggerAssetLoadedCallback(const std::string& path, std::type_index type);
@@ -303,7 +768,8 @@ private:
     
     // Carregamento assíncrono
     template<typename T>
-    void LoadAssetAsyncInternal(const AssetKey& key, const std::any& params, AssetPriority priority);
+    void LoadAssetAsyncInternal(const AssetKey& key, const std::any& params, AssetPriority priority,
+                                LoadCompletion completion = {});
     
     void ProcessAsyncLoads();
     void CleanupCompletedLoads();
@@ -312,15 +778,44 @@ private:
 // Implementação dos templates
 template<typename T>
 void AssetsSystem::RegisterLoader(std::unique_ptr<IAssetLoader<T>> loader) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    m_Loaders[std::type_index(typeid(T))] = std::any{std::shared_ptr<void>(std::move(loader))};
-    DRIFT_LOG_INFO("[AssetsSystem] Loader registrado: ", std::string(typeid(T).name()));
+    {
+        std::lock_guard<ProfiledMutex> lock(m_Mutex);
+        const std::type_index type(typeid(T));
+        IAssetLoader<T>* rawLoader = loader.get();
+        
+        LoaderBinding binding;
+        binding.extensions = rawLoader->GetSupportedExtensions();
+        binding.canLoad = [rawLoader](const std::string& path) { return rawLoader->CanLoad(path); };
+        binding.getDependencies = [rawLoader](const std::string& path) { return rawLoader->GetDependencies(path); };
+        binding.requestLoad = [this](const std::string& path, const std::string& variant, AssetPriority priority,
+                                     LoadCompletion completion) {
+            RequestLoadUntyped<T>(path, variant, priority, std::move(completion));
+        };
+        binding.qualityLadder = rawLoader->GetQualityLadder();
+        binding.requestDowngrade = [this](const AssetKey& key, size_t level, const AssetQualityLevel& quality) {
+            EnqueueDowngrade(key, level, [this, key, level, quality](const IO::FileView& data) {
+                ExecuteDowngrade<T>(key, level, quality, data);
+            });
+        };
+        
+        UnregisterExtensions(type);
+        RegisterExtensions(type, binding.extensions);
+        m_LoaderBindings[type] = std::move(binding);
+        m_Loaders[type] = std::any{std::shared_ptr<void>(std::move(loader))};
+        DRIFT_LOG_INFO("[AssetsSystem] Loader registrado: " << std::string(typeid(T).name()));
+    }
+    
+    // Entradas do manifesto que aguardavam este loader
+    DispatchPendingReplay();
 }
 
 template<typename T>
 void AssetsSystem::UnregisterLoader() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    m_Loaders.erase(std::type_index(typeid(T)));
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    const std::type_index type(typeid(T));
+    UnregisterExtensions(type);
+    m_LoaderBindings.erase(type);
+    m_Loaders.erase(type);
     DRIFT_LOG_INFO("[AssetsSystem] Loader removido: ", std::string(typeid(T).name()));
 }
 
@@ -334,6 +829,13 @@ IAssetLoader<T>* AssetsSystem::GetLoader() const {
     return nullptr;
 }
 
+template<typename T>
+std::shared_ptr<T> AssetsSystem::InvokeLoader(IAssetLoader<T>* loader, const std::string& path, const IO::FileView& data,
+                                              const std::any& params) {
+    // Paths sintéticos (sem arquivo) caem no Load tradicional; entradas de 0 bytes são payloads válidos
+    return data.IsValid() ? loader->Load(path, data, params) : loader->Load(path, params);
+}
+
 template<typename T>
 std::shared_ptr<T> AssetsSystem::LoadAsset(const std::string& path, const std::string& variant, 
                                           const std::any& params, AssetPriority priority) {
@@ -355,31 +857,39 @@ std::shared_ptr<T> AssetsSystem::LoadAsset(const std::string& path, const std::s
 template<typename T>
 std::shared_ptr<T> AssetsSystem::LoadAssetSync(const std::string& path, const std::string& variant, 
                                               const std::any& params) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
     AssetKey key(path, std::type_index(typeid(T)), variant);
+    RecordManifestRequest(key);
+    
+    if (auto cached = FindPublishedAsset(key.id, key.type)) {
+        return std::static_pointer_cast<T>(cached);
+    }
+    
+    // Carregamento assíncrono pendente: passa para o topo da fila e aguarda sem segurar m_Mutex
+    if (GetAssetStatus(key.id, key.type) == AssetStatus::Loading) {
+        SetLoadPriority(key.id, key.type, AssetPriority::Critical);
+        while (GetAssetStatus(key.id, key.type) == AssetStatus::Loading) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    
+    // Leitura e hash do payload antes de m_Mutex: o hash percorre todos os bytes e não pode
+    // bloquear GetAsset/LoadAsset de outras threads
+    auto startTime = std::chrono::steady_clock::now();
+    IO::FileView data = OpenPayload(path);
+    const uint64_t payloadHash = HashPayload(data);
+    
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     auto it = m_Assets.find(key);
     
-    if (it != m_Assets.end()) {
+    if (it != m_Assets.end() && it->second.status == AssetStatus::Loaded) {
         // Asset já existe no cache
         UpdateAccessStats(it->second);
-        m_CacheHits++;
-        
-        if (it->second.status == AssetStatus::Loaded) {
-            return std::static_pointer_cast<T>(it->second.asset);
-        } else if (it->second.status == AssetStatus::Loading) {
-            // Aguarda carregamento assíncrono
-            while (it->second.status == AssetStatus::Loading) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-            }
-            if (it->second.status == AssetStatus::Loaded) {
-                return std::static_pointer_cast<T>(it->second.asset);
-            }
-        }
+        RecordCacheHit();
+        return std::static_pointer_cast<T>(it->second.asset);
     }
     
     // Asset não existe ou falhou - carrega
-    m_CacheMisses++;
+    RecordCacheMiss();
     
     IAssetLoader<T>* loader = GetLoader<T>();
     if (!loader) {
@@ -387,8 +897,13 @@ std::shared_ptr<T> AssetsSystem::LoadAssetSync(const std::string& path, const st
         return nullptr;
     }
     
-    auto startTime = std::chrono::steady_clock::now();
-    auto asset = loader->Load(path, params);
+    uint64_t contentHash = DedupPayload(data, payloadHash);
+    uint64_t shareHash = params.has_value() ? 0 : contentHash;   // params mudam o resultado
+    auto asset = std::static_pointer_cast<T>(FindSharedAsset(key.type, shareHash));
+    const bool reused = asset != nullptr;
+    if (!asset) {
+        asset = InvokeLoader<T>(loader, path, data, params);
+    }
     auto endTime = std::chrono::steady_clock::now();
     
     if (!asset) {
@@ -401,28 +916,29 @@ std::shared_ptr<T> AssetsSystem::LoadAssetSync(const std::string& path, const st
     m_TotalLoadTime += loadTime;
     m_LoadCount++;
     
-    // Verifica limites de memória
+    // Verifica limites de memória (orçamento do tipo e limite global)
     size_t assetMemory = asset->GetMemoryUsage();
-    if (CalculateCurrentMemoryUsage() + assetMemory > m_Config.maxMemoryUsage) {
-        while (CalculateCurrentMemoryUsage() + assetMemory > m_Config.maxMemoryUsage) {
-            if (!EvictLeastUsedAsset()) {
-                break;
-            }
-        }
-    }
+    MakeRoomFor(key.type, reused ? 0 : assetMemory);
     
     // Adiciona ao cache
     AssetCacheEntry entry;
     entry.asset = asset;
     entry.status = AssetStatus::Loaded;
-    entry.lastAccess = ++m_AccessCounter;
-    entry.accessCount = 1;
-    entry.memoryUsage = assetMemory;
+    entry.access->lastAccess = m_AccessCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+    entry.access->accessCount = 1;
     entry.loadTime = endTime;
     entry.isPreloaded = false;
     entry.priority = AssetPriority::Normal;
     
-    m_Assets[key] = entry;
+    auto& cached = m_Assets[key];
+    SetEntryMemory(key.type, cached, 0);
+    ReleaseSlot(cached);
+    cached = entry;
+    SetEntryMemory(key.type, cached, assetMemory);
+    AttachSharedAsset(key, cached, shareHash);
+    asset = std::static_pointer_cast<T>(cached.asset);
+    AttachSlot(cached);
+    PublishAsset(key, cached);
     
     // Verifica limite de quantidade
     if (m_Assets.size() > m_Config.maxAssets) {
@@ -438,19 +954,13 @@ std::shared_ptr<T> AssetsSystem::LoadAssetSync(const std::string& path, const st
 
 template<typename T>
 std::shared_ptr<T> AssetsSystem::GetAsset(const std::string& path, const std::string& variant) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
-    AssetKey key(path, std::type_index(typeid(T)), variant);
-    auto it = m_Assets.find(key);
-    
-    if (it != m_Assets.end() && it->second.status == AssetStatus::Loaded) {
-        UpdateAccessStats(it->second);
-        m_CacheHits++;
-        return std::static_pointer_cast<T>(it->second.asset);
-    }
-    
-    m_CacheMisses++;
-    return nullptr;
+    return GetAsset<T>(AssetId::FromPath(path, variant));
+}
+
+template<typename T>
+std::shared_ptr<T> AssetsSystem::GetAsset(AssetId id) {
+    // Sem m_Mutex: lê o índice publicado
+    return std::static_pointer_cast<T>(FindPublishedAsset(id, std::type_index(typeid(T))));
 }
 
 template<typename T>
@@ -468,37 +978,22 @@ template<typename T>
 std::future<std::shared_ptr<T>> AssetsSystem::LoadAssetAsync(const std::string& path, const std::string& variant, 
                                                             const std::any& params, AssetPriority priority) {
     AssetKey key(path, std::type_index(typeid(T)), variant);
+    RecordManifestRequest(key);
+    auto promise = std::make_shared<std::promise<std::shared_ptr<T>>>();
+    auto future = promise->get_future();
     
     // Verifica se já está carregado
-    {
-        std::lock_guard<std::mutex> lock(m_Mutex);
-        auto it = m_Assets.find(key);
-        if (it != m_Assets.end() && it->second.status == AssetStatus::Loaded) {
-            UpdateAccessStats(it->second);
-            m_CacheHits++;
-            auto asset = std::static_pointer_cast<T>(it->second.asset);
-            return std::async(std::launch::deferred, [asset]() { return asset; });
-        }
+    if (auto cached = FindPublishedAsset(key.id, key.type)) {
+        promise->set_value(std::static_pointer_cast<T>(cached));
+        return future;
     }
     
-    // Inicia carregamento assíncrono
-    LoadAssetAsyncInternal<T>(key, params, priority);
-    
-    // Retorna future que aguarda o carregamento
-    return std::async(std::launch::async, [this, key]() {
-        while (true) {
-            std::lock_guard<std::mutex> lock(m_Mutex);
-            auto it = m_Assets.find(key);
-            if (it != m_Assets.end()) {
-                if (it->second.status == AssetStatus::Loaded) {
-                    return std::static_pointer_cast<T>(it->second.asset);
-                } else if (it->second.status == AssetStatus::Failed) {
-                    return std::shared_ptr<T>(nullptr);
-                }
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
+    // Enfileira o carregamento; o future é resolvido quando o pedido termina ou é cancelado
+    LoadAssetAsyncInternal<T>(key, params, priority, [this, key, promise]() {
+        promise->set_value(std::static_pointer_cast<T>(FindPublishedAsset(key.id, key.type, false)));
     });
+    
+    return future;
 }
 
 template<typename T>
@@ -512,72 +1007,195 @@ void AssetsSystem::PreloadAsset(const std::string& path, const std::string& vari
 }
 
 template<typename T>
-void AssetsSystem::LoadAssetAsyncInternal(const AssetKey& key, const std::any& params, AssetPriority priority) {
+void AssetsSystem::LoadAssetAsyncInternal(const AssetKey& key, const std::any& params, AssetPriority priority,
+                                          LoadCompletion completion) {
     // Marca como carregando
+    bool alreadyLoaded = false;
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::lock_guard<ProfiledMutex> lock(m_Mutex);
         auto& entry = m_Assets[key];
-        entry.status = AssetStatus::Loading;
-        entry.isAsyncLoading = true;
-        entry.priority = priority;
+        if (entry.status == AssetStatus::Loaded) {
+            alreadyLoaded = true;
+        } else {
+            entry.status = AssetStatus::Loading;
+            entry.isAsyncLoading = true;
+            entry.priority = priority;
+        }
     }
     
-    // Cria a tarefa assíncrona
-    auto task = [this, key, params]() {
-        try {
-            IAssetLoader<T>* loader = GetLoader<T>();
-            if (!loader) {
-                throw std::runtime_error("Loader não encontrado");
-            }
-            
-            auto asset = loader->Load(key.path, params);
-            if (!asset) {
-                throw std::runtime_error("Falha ao carregar asset");
-            }
-            
-            // Atualiza o cache
-            {
-                std::lock_guard<std::mutex> lock(m_Mutex);
-                auto it = m_Assets.find(key);
-                if (it != m_Assets.end()) {
-                    it->second.asset = asset;
-                    it->second.status = AssetStatus::Loaded;
-                    it->second.isAsyncLoading = false;
-                    it->second.memoryUsage = asset->GetMemoryUsage();
-                    it->second.loadTime = std::chrono::steady_clock::now();
-                    
-                    m_AsyncLoadCount++;
-                    TriggerAssetLoadedCallback(key.path, key.type);
-                    
-                    DRIFT_LOG_INFO("[AssetsSystem] Asset carregado assincronamente: ", key.path);
-                }
-            }
-            
-        } catch (const std::exception& e) {
-            // Marca como falhou
-            {
-                std::lock_guard<std::mutex> lock(m_Mutex);
-                auto it = m_Assets.find(key);
-                if (it != m_Assets.end()) {
-                    it->second.status = AssetStatus::Failed;
-                    it->second.isAsyncLoading = false;
-                    it->second.errorMessage = e.what();
-                    
-                    TriggerAssetFailedCallback(key.path, key.type, e.what());
-                    
-                    DRIFT_LOG_ERROR("[AssetsSystem] Falha ao carregar asset: ", key.path, " - ", e.what());
-                }
-            }
+    if (alreadyLoaded) {
+        if (completion) {
+            completion();
         }
+        return;
+    }
+    
+    // Cria a tarefa e enfileira; a fila respeita prioridade e maxConcurrentLoads
+    // e entrega os bytes já lidos pelo IO assíncrono quando disponíveis
+    auto task = [this, key, params](const IO::FileView& data) {
+        ExecuteLoad<T>(key, params, data);
     };
     
-    // Submete a tarefa ao sistema de threading
-    auto priority_enum = static_cast<Drift::Core::Threading::TaskPriority>(priority);
-    auto info = Drift::Core::Threading::TaskInfo{};
-    info.name = "LoadAsset_" + key.path;
-    info.priority = priority_enum;
+    EnqueueLoad(key, priority, task, std::move(completion));
+}
+
+template<typename T>
+void AssetsSystem::ExecuteLoad(const AssetKey& key, const std::any& params, const IO::FileView& prefetched) {
+    try {
+        IAssetLoader<T>* loader = GetLoader<T>();
+        if (!loader) {
+            throw std::runtime_error("Loader não encontrado");
+        }
+        
+        IO::FileView data = prefetched.IsValid() ? prefetched : OpenPayload(key.path);
+        uint64_t contentHash = DedupPayload(data);
+        uint64_t shareHash = params.has_value() ? 0 : contentHash;   // params mudam o resultado
+        
+        std::shared_ptr<T> asset;
+        if (shareHash != 0) {
+            std::lock_guard<ProfiledMutex> lock(m_Mutex);
+            asset = std::static_pointer_cast<T>(FindSharedAsset(key.type, shareHash));
+        }
+        const bool reused = asset != nullptr;
+        if (!asset) {
+            asset = InvokeLoader<T>(loader, key.path, data, params);
+        }
+        if (!asset) {
+            throw std::runtime_error("Falha ao carregar asset");
+        }
+        
+        // Atualiza o cache
+        std::lock_guard<ProfiledMutex> lock(m_Mutex);
+        auto it = m_Assets.find(key);
+        // Descarregado ou já concluído por outra carga: não troca o asset de um slot vivo
+        // (recarga de verdade passa por SwapSlotAsset, que respeita os pins)
+        if (it == m_Assets.end() || it->second.status != AssetStatus::Loading) {
+            return;
+        }
+        
+        // Abre espaço enquanto a entrada ainda está Loading (não é candidata ao despejo)
+        size_t assetMemory = asset->GetMemoryUsage();
+        MakeRoomFor(key.type, reused ? 0 : assetMemory);
+        SetEntryMemory(key.type, it->second, assetMemory);
+        it->second.asset = asset;
+        it->second.status = AssetStatus::Loaded;
+        it->second.isAsyncLoading = false;
+        AttachSharedAsset(key, it->second, shareHash);
+        AttachSlot(it->second);
+        PublishAsset(key, it->second);
+        it->second.loadTime = std::chrono::steady_clock::now();
+        
+        m_AsyncLoadCount++;
+        TriggerAssetLoadedCallback(key.path, key.type);
+        
+        DRIFT_LOG_INFO("[AssetsSystem] Asset carregado assincronamente: " << key.path);
+    } catch (const std::exception& e) {
+        // Marca como falhou
+        {
+            std::lock_guard<ProfiledMutex> lock(m_Mutex);
+            auto it = m_Assets.find(key);
+            if (it != m_Assets.end() && it->second.status == AssetStatus::Loading) {
+                it->second.status = AssetStatus::Failed;
+                it->second.isAsyncLoading = false;
+                it->second.errorMessage = e.what();
+                
+                TriggerAssetFailedCallback(key.path, key.type, e.what());
+                
+                DRIFT_LOG_ERROR("[AssetsSystem] Falha ao carregar asset: " << key.path << " - " << e.what());
+            }
+        }
+    }
+}
+
+template<typename T>
+void AssetsSystem::ExecuteDowngrade(const AssetKey& key, size_t level, const AssetQualityLevel& quality,
+                                    const IO::FileView& data) {
+    std::shared_ptr<T> asset;
+    try {
+        if (IAssetLoader<T>* loader = GetLoader<T>()) {
+            IO::FileView payload = data.Empty() ? OpenPayload(key.path) : data;
+            DedupPayload(payload);
+            asset = InvokeLoader<T>(loader, key.path, payload, quality.params);
+        }
+    } catch (const std::exception& e) {
+        DRIFT_LOG_ERROR("[AssetsSystem] Falha ao reduzir qualidade: " << key.path << " - " << e.what());
+    }
+    
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    auto it = m_Assets.find(key);
+    // Despejado ou recarregado enquanto a redução estava na fila: descarta o resultado
+    if (it == m_Assets.end() || !it->second.downgradePending || it->second.status != AssetStatus::Loaded) {
+        return;
+    }
+    
+    AssetCacheEntry& entry = it->second;
+    ClearPendingDowngrade(key.type, entry);
+    if (!asset) {
+        // Nível indisponível para este asset: não tenta novamente
+        entry.canDowngrade = false;
+        return;
+    }
+    
+    // Troca no lugar: handles e GetAsset passam a ver a variante mais barata; quem
+    // ainda segura a anterior (shared_ptr) a mantém até soltar a referência.
+    // Asset fixado não é trocado agora; volta a ser candidato na próxima pressão.
+    if (!SwapSlotAsset(entry, asset.get())) {
+        return;
+    }
+    DetachSharedAsset(key, entry);
+    SetEntryMemory(key.type, entry, asset->GetMemoryUsage());
+    entry.asset = asset;
+    entry.qualityLevel = level;
+    PublishAsset(key, entry);
+    m_DowngradeCount++;
+    
+    TriggerAssetLoadedCallback(key.path, key.type);
+    DRIFT_LOG_INFO("[AssetsSystem] Qualidade reduzida: " << key.path << " -> " << quality.variant);
     
-    Drift::Core::Threading::ThreadingSystem::GetInstance().SubmitWithInfo(info, task);
+    // A estimativa pode ter sido otimista
+    EnforceMemoryBudgets();
+}
+
+template<typename T>
+void AssetsSystem::RequestLoadUntyped(const std::string& path, const std::string& variant, AssetPriority priority,
+                                      LoadCompletion completion) {
+    AssetKey key(path, std::type_index(typeid(T)), variant);
+    LoadAssetAsyncInternal<T>(key, {}, priority, std::move(completion));
+}
+
+template<typename T>
+AssetHandle<T> AssetsSystem::GetHandle(AssetId id) const {
+    auto [index, generation] = FindPublishedSlot(id, std::type_index(typeid(T)));
+    return AssetHandle<T>(index, generation);
+}
+
+template<typename T>
+AssetHandle<T> AssetsSystem::LoadAssetHandle(const std::string& path, const std::string& variant,
+                                             const std::any& params, AssetPriority priority) {
+    AssetId id = AssetId::FromPath(path, variant);
+    AssetHandle<T> handle = GetHandle<T>(id);
+    if (handle.IsValid() || !LoadAsset<T>(path, variant, params, priority)) {
+        return handle;
+    }
+    return GetHandle<T>(id);
+}
+
+template<typename T>
+bool AssetHandle<T>::IsAlive() const {
+    return AssetsSystem::GetInstance().IsHandleAlive(m_Index, m_Generation);
+}
+
+template<typename T>
+AssetPin<T> AssetHandle<T>::Pin() const {
+    return AssetsSystem::GetInstance().Pin(*this);
+}
+
+template<typename T>
+void AssetPin<T>::Release() {
+    if (m_Asset) {
+        AssetsSystem::GetInstance().UnpinSlot(m_Index);
+        m_Asset = nullptr;
+    }
 }
 
 // Macros para facilitar o uso
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Drift/Core/IO/MappedFile.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Drift::Core::Assets {
+
+/**
+ * @brief Chave de um dado derivado
+ *
+ * Identifica o resultado de um processamento: quem processou (loader + versão),
+ * sobre qual conteúdo (hash dos bytes de origem) e com quais parâmetros.
+ * Incrementar loaderVersion invalida todas as entradas antigas do loader.
+ */
+struct DerivedDataKey {
+    std::string loaderName;
+    uint32_t loaderVersion = 0;
+    uint64_t sourceHash = 0;
+    uint64_t paramsHash = 0;
+
+    // Hash combinado (nome do arquivo no cache)
+    uint64_t GetHash() const;
+
+    static DerivedDataKey Make(std::string loaderName, uint32_t loaderVersion,
+                               const IO::FileView& source, std::string_view params = {});
+    static DerivedDataKey Make(std::string loaderName, uint32_t loaderVersion,
+                               const void* source, size_t sourceSize, std::string_view params = {});
+};
+
+/**
+ * @brief Configuração do cache de dados derivados
+ */
+struct DerivedDataCacheConfig {
+    std::string directory = "cache/ddc";
+    uint64_t maxCacheSize = 2ull * 1024 * 1024 * 1024;   // 2GB em disco
+    float trimTarget = 0.9f;                             // Após limpeza fica em 90% do limite
+    bool verifyOnRead = false;                           // Confere CRC do conteúdo a cada leitura
+};
+
+/**
+ * @brief Cache persistente de dados derivados (imagens decodificadas, mips, glifos...)
+ *
+ * Características:
+ * - Entradas chaveadas pelo hash do conteúdo de origem + versão do loader + parâmetros
+ * - Leitura por mapeamento em memória (zero-copy) na próxima execução
+ * - Escrita atômica (arquivo temporário + rename)
+ * - Limite de tamanho com limpeza LRU (data de modificação = último acesso)
+ */
+class DerivedDataCache {
+public:
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t writes = 0;
+        uint64_t evictions = 0;
+        uint64_t bytesOnDisk = 0;
+        size_t entryCount = 0;
+    };
+
+    using BuildFunction = std::function<bool(std::vector<uint8_t>& output)>;
+
+    static DerivedDataCache& GetInstance();
+
+    bool Initialize(const DerivedDataCacheConfig& config = {});
+    void Shutdown();
+    bool IsInitialized() const { return m_Initialized.load(); }
+
+    // Retorna o conteúdo mapeado, ou visão vazia em caso de ausência
+    IO::FileView Get(const DerivedDataKey& key);
+    bool Put(const DerivedDataKey& key, const void* data, size_t size);
+    bool Contains(const DerivedDataKey& key) const;
+    bool Remove(const DerivedDataKey& key);
+
+    // Busca no cache; na ausência executa build, grava e retorna o resultado
+    IO::FileView GetOrBuild(const DerivedDataKey& key, const BuildFunction& build);
+
+    // Limpeza
+    void Trim();
+    void Clear();
+
+    void SetMaxCacheSize(uint64_t bytes);
+    const DerivedDataCacheConfig& GetConfig() const { return m_Config; }
+    Stats GetStats() const;
+
+private:
+    struct Entry {
+        uint64_t size = 0;
+        int64_t lastAccess = 0;     // Ticks do relógio de arquivos
+    };
+
+    DerivedDataCache() = default;
+    ~DerivedDataCache() = default;
+    DerivedDataCache(const DerivedDataCache&) = delete;
+    DerivedDataCache& operator=(const DerivedDataCache&) = delete;
+
+    std::string GetEntryPath(uint64_t hash) const;
+    void ScanDirectory();
+    void TouchEntry(uint64_t hash, const std::string& path);
+    void TrimLocked(uint64_t targetSize);
+
+    DerivedDataCacheConfig m_Config;
+    std::unordered_map<uint64_t, Entry> m_Entries;
+    uint64_t m_BytesOnDisk = 0;
+    mutable std::mutex m_Mutex;
+    std::atomic<bool> m_Initialized{false};
+    std::atomic<uint64_t> m_TempCounter{0};
+
+    // Estatísticas
+    std::atomic<uint64_t> m_Hits{0};
+    std::atomic<uint64_t> m_Misses{0};
+    std::atomic<uint64_t> m_Writes{0};
+    std::atomic<uint64_t> m_Evictions{0};
+};
+
+} // namespace Drift::Core::Assets
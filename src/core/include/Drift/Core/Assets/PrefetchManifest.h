@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Drift::Core::Assets {
+
+/**
+ * @brief Pedido de asset registrado em uma sessão
+ */
+struct PrefetchManifestEntry {
+    std::string path;
+    std::string variant;
+    uint32_t timeMs = 0;        // Tempo desde o início da gravação
+};
+
+/**
+ * @brief Manifesto de pré-busca (.dpfm)
+ *
+ * Lista compacta, em ordem de pedido, dos assets solicitados no início de uma
+ * sessão. Formato: cabeçalho (magic, versão, contagem, CRC32) seguido das entradas
+ * (tempo, tamanhos, caminho e variante sem terminador).
+ */
+class PrefetchManifest {
+public:
+    static bool Load(const std::string& path, std::vector<PrefetchManifestEntry>& entries);
+    static bool Save(const std::string& path, const std::vector<PrefetchManifestEntry>& entries);
+};
+
+} // namespace Drift::Core::Assets
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define DRIFT_CLOCK_HAS_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define DRIFT_CLOCK_HAS_TSC 1
+#else
+#define DRIFT_CLOCK_HAS_TSC 0
+#endif
+
+namespace Drift::Core {
+
+/**
+ * @brief Relógio de baixo custo para instrumentação (profiler, tarefas, locks)
+ *
+ * Lê o TSC invariante e converte para nanossegundos com uma multiplicação em ponto
+ * fixo, calibrada contra CLOCK_MONOTONIC_RAW. A calibração é preguiçosa e não bloqueia:
+ * a primeira chamada de NowNs() grava o ponto inicial e, enquanto a janela de calibração
+ * não fecha, NowNs() responde com steady_clock. Sem TSC invariante (outras arquiteturas,
+ * VMs que não o expõem) usa steady_clock sempre.
+ *
+ * NowNs() usa a mesma época de steady_clock: os valores podem ser convertidos em
+ * time_point (ToTimePoint) e comparados com medições feitas por steady_clock.
+ */
+class Clock {
+public:
+    // Nanossegundos monotônicos (época de steady_clock)
+    static uint64_t NowNs() {
+#if DRIFT_CLOCK_HAS_TSC
+        if (s_UseTsc.load(std::memory_order_acquire)) {
+            return TicksToNs(ReadTicks());
+        }
+        return CalibratingNowNs();
+#else
+        return SteadyNowNs();
+#endif
+    }
+
+    // Contador bruto: rdtsc não espera instruções anteriores; ReadTicksOrdered (rdtscp) espera
+    static uint64_t ReadTicks() {
+#if DRIFT_CLOCK_HAS_TSC
+        return __rdtsc();
+#else
+        return SteadyNowNs();
+#endif
+    }
+
+    static uint64_t ReadTicksOrdered() {
+#if DRIFT_CLOCK_HAS_TSC
+        unsigned int aux;
+        return __rdtscp(&aux);
+#else
+        return SteadyNowNs();
+#endif
+    }
+
+    static uint64_t TicksToNs(uint64_t ticks) {
+        if (!s_UseTsc.load(std::memory_order_acquire)) {
+            return ticks;
+        }
+        // Leituras de outro núcleo podem ficar alguns ticks antes da base
+        return ticks >= s_BaseTicks ? s_BaseNs + ScaleTicks(ticks - s_BaseTicks)
+                                    : s_BaseNs - ScaleTicks(s_BaseTicks - ticks);
+    }
+
+    static std::chrono::steady_clock::time_point ToTimePoint(uint64_t ns) {
+        return std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(ns)));
+    }
+
+    // Informações da fonte escolhida na calibração ("steady_clock" até ela concluir)
+    static bool IsTscEnabled() { return s_UseTsc.load(std::memory_order_acquire); }
+    static double GetTscFrequencyGHz();
+    static const char* GetSourceName() { return IsTscEnabled() ? "TSC" : "steady_clock"; }
+
+private:
+    struct Calibrator;
+    
+    // Caminho lento de NowNs() (Clock.cpp): avança a calibração e lê steady_clock
+    static uint64_t CalibratingNowNs();
+
+    static uint64_t SteadyNowNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // ticks * ns/tick, com ns/tick em ponto fixo 32.32
+    static uint64_t ScaleTicks(uint64_t ticks) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        uint64_t high;
+        uint64_t low = _umul128(ticks, s_Multiplier, &high);
+        return __shiftright128(low, high, 32);
+#elif defined(__SIZEOF_INT128__)
+        return static_cast<uint64_t>((static_cast<unsigned __int128>(ticks) * s_Multiplier) >> 32);
+#else
+        return (ticks >> 32) * s_Multiplier + (((ticks & 0xFFFFFFFFull) * s_Multiplier) >> 32);
+#endif
+    }
+
+    // Escritos uma vez ao fim da calibração (Clock.cpp), publicados pelo store de s_UseTsc
+    static inline std::atomic<bool> s_UseTsc{false};
+    static inline uint64_t s_BaseTicks = 0;
+    static inline uint64_t s_BaseNs = 0;
+    static inline uint64_t s_Multiplier = 0;
+};
+
+} // namespace Drift::Core
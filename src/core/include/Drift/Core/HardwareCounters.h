@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Drift::Core {
+
+// Contadores lidos em cada seção quando ProfilerConfig::enableHardwareCounters está ligado
+enum class HardwareCounter : uint32_t {
+    Cycles,
+    Instructions,
+    L1DMisses,          // Leituras que erraram o L1 de dados
+    LLCMisses,          // Misses do último nível de cache
+    BranchMisses,
+    Count
+};
+
+constexpr uint32_t HARDWARE_COUNTER_COUNT = static_cast<uint32_t>(HardwareCounter::Count);
+
+/**
+ * @brief Grupo de contadores de hardware da thread atual (Linux, perf_event_open)
+ *
+ * Os contadores formam um grupo com os ciclos como líder, para o kernel agendá-los
+ * juntos na PMU. Cada descritor é mapeado em memória: com rdpmc liberado para user
+ * space a leitura não entra no kernel; senão cai em read() no descritor.
+ * Mede só a thread que chamou Open(), em modo usuário (funciona com
+ * perf_event_paranoid <= 2). Em outras plataformas Open() sempre falha.
+ */
+class HardwareCounterGroup {
+public:
+    HardwareCounterGroup() = default;
+    ~HardwareCounterGroup();
+
+    HardwareCounterGroup(const HardwareCounterGroup&) = delete;
+    HardwareCounterGroup& operator=(const HardwareCounterGroup&) = delete;
+
+    // Abre o grupo para a thread atual; false se a plataforma ou o kernel não permitirem
+    bool Open();
+    void Close();
+    bool IsOpen() const { return m_Open; }
+
+    // Valores acumulados desde Open(), na ordem de HardwareCounter
+    void Read(uint64_t values[HARDWARE_COUNTER_COUNT]) const;
+
+    // Mensagem do último Open() que falhou
+    const char* GetLastError() const { return m_LastError; }
+
+private:
+    uint64_t ReadCounter(uint32_t index) const;
+
+    int m_Fds[HARDWARE_COUNTER_COUNT] = {-1, -1, -1, -1, -1};
+    void* m_Pages[HARDWARE_COUNTER_COUNT] = {};
+    bool m_Open = false;
+    const char* m_LastError = "";
+};
+
+} // namespace Drift::Core
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Drift::Core {
+
+// CRC32 (IEEE 802.3) - usado para verificação de integridade de dados
+uint32_t Crc32(const void* data, size_t size, uint32_t previous = 0);
+
+// Hash 64-bit forte (XXH64) - usado para chaves de lookup e hashes de conteúdo
+uint64_t Hash64(const void* data, size_t size, uint64_t seed = 0);
+
+inline uint64_t Hash64(std::string_view text, uint64_t seed = 0) {
+    return Hash64(text.data(), text.size(), seed);
+}
+
+// Combina dois hashes 64-bit preservando a distribuição
+inline uint64_t HashCombine64(uint64_t a, uint64_t b) {
+    a ^= b + 0x9E3779B97F4A7C15ull + (a << 12) + (a >> 4);
+    a ^= a >> 33;
+    a *= 0xFF51AFD7ED558CCDull;
+    a ^= a >> 33;
+    return a;
+}
+
+} // namespace Drift::Core
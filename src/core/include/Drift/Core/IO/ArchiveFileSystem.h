@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Drift/Core/IO/MappedFile.h"
+#include "Drift/Core/IO/Compression.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Drift::Core::IO {
+
+/**
+ * @brief Formato de arquivo .dpak (Drift Package)
+ *
+ * Layout (little-endian):
+ *   [DpakHeader]                       64 bytes no offset 0
+ *   [dados das entradas]               cada entrada alinhada a 4K (64K para entradas grandes)
+ *   [tabela de nomes]                  caminhos UTF-8 concatenados, sem terminador
+ *   [TOC: DpakEntry x entryCount]      ordenada por (pathHash, nome) para busca binária
+ *
+ * O CRC32 de cada entrada cobre os dados descomprimidos; o tocCrc cobre TOC + nomes.
+ */
+constexpr uint32_t DPAK_MAGIC = 0x4B415044;    // "DPAK"
+constexpr uint32_t DPAK_VERSION = 1;
+
+struct DpakHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t flags;
+    uint64_t tocOffset;
+    uint64_t tocSize;
+    uint64_t namesOffset;
+    uint64_t namesSize;
+    uint32_t alignment;
+    uint32_t tocCrc;
+    uint32_t headerCrc;     // CRC32 do header com este campo zerado
+    uint32_t reserved;
+};
+static_assert(sizeof(DpakHeader) == 64, "DpakHeader deve ter 64 bytes");
+
+struct DpakEntry {
+    uint64_t pathHash;
+    uint64_t dataOffset;
+    uint64_t storedSize;
+    uint64_t originalSize;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t crc32;
+    uint8_t compression;    // CompressionMethod
+    uint8_t reserved[3];
+};
+static_assert(sizeof(DpakEntry) == 48, "DpakEntry deve ter 48 bytes");
+
+// Normaliza caminhos para o formato do TOC ('/' como separador, sem "./" inicial)
+std::string NormalizeArchivePath(std::string_view path);
+
+// Hash de caminho usado no TOC
+uint64_t HashArchivePath(std::string_view normalizedPath);
+
+/**
+ * @brief Informações públicas de uma entrada do arquivo
+ */
+struct ArchiveEntryInfo {
+    std::string path;
+    uint64_t originalSize = 0;
+    uint64_t storedSize = 0;
+    uint64_t dataOffset = 0;
+    CompressionMethod compression = CompressionMethod::None;
+    uint32_t crc32 = 0;
+};
+
+/**
+ * @brief Opções de abertura de um arquivo .dpak
+ */
+struct ArchiveOpenOptions {
+    bool verifyCrcOnRead = false;           // Verifica CRC32 a cada leitura (toca todas as páginas)
+    MapAccessHint accessHint = MapAccessHint::Normal;
+};
+
+/**
+ * @brief Sistema de arquivos somente-leitura sobre um arquivo .dpak mapeado
+ *
+ * Características:
+ * - Um único mmap para o arquivo inteiro
+ * - Lookup O(log n) por hash de caminho, sem alocações
+ * - Entradas sem compressão são entregues como FileView zero-copy
+ * - Entradas comprimidas são descomprimidas em um buffer próprio da visão
+ */
+class ArchiveFileSystem {
+public:
+    static std::shared_ptr<ArchiveFileSystem> Open(const std::string& archivePath, const ArchiveOpenOptions& options = {});
+
+    // Consulta
+    bool Exists(std::string_view path) const;
+    bool GetEntryInfo(std::string_view path, ArchiveEntryInfo& info) const;
+    std::vector<ArchiveEntryInfo> ListEntries() const;
+    size_t GetEntryCount() const { return m_EntryCount; }
+    const std::string& GetArchivePath() const { return m_File->GetPath(); }
+
+    // Leitura (visão inválida se a entrada não existir ou estiver corrompida; entradas de
+    // 0 bytes retornam uma visão válida e vazia)
+    FileView Read(std::string_view path) const;
+
+    // Dicas de acesso para uma entrada (ex.: pré-carregamento)
+    void Prefetch(std::string_view path) const;
+
+    // Verificação de integridade
+    bool VerifyEntry(std::string_view path) const;
+    bool VerifyAll() const;
+
+private:
+    ArchiveFileSystem() = default;
+    ArchiveFileSystem(const ArchiveFileSystem&) = delete;
+    ArchiveFileSystem& operator=(const ArchiveFileSystem&) = delete;
+
+    const DpakEntry* FindEntry(std::string_view path) const;
+    std::string_view GetEntryName(const DpakEntry& entry) const;
+    FileView ReadEntry(const DpakEntry& entry, bool verifyCrc) const;
+
+    std::shared_ptr<MappedFile> m_File;
+    ArchiveOpenOptions m_Options;
+    const DpakEntry* m_Entries = nullptr;
+    const char* m_Names = nullptr;
+    uint32_t m_EntryCount = 0;
+};
+
+} // namespace Drift::Core::IO
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Drift/Core/IO/ArchiveFileSystem.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Drift::Core::IO {
+
+/**
+ * @brief Configuração do gerador de arquivos .dpak
+ */
+struct ArchiveWriterConfig {
+    uint32_t alignment = 4 * 1024;                  // Alinhamento padrão das entradas (4K)
+    uint32_t largeAlignment = 64 * 1024;            // Alinhamento de entradas grandes (64K)
+    uint64_t largeEntryThreshold = 256 * 1024;      // A partir deste tamanho usa largeAlignment
+    bool enableCompression = false;                 // Comprime entradas com FastCompression
+    float minCompressionGain = 0.1f;                // Só mantém comprimido se economizar >= 10%
+};
+
+/**
+ * @brief Gera arquivos .dpak a partir de arquivos soltos ou buffers
+ *
+ * As entradas são gravadas em ordem de caminho (arquivos de um mesmo diretório
+ * ficam contíguos) e o TOC é ordenado por hash para busca binária.
+ */
+class ArchiveWriter {
+public:
+    struct Stats {
+        size_t entryCount = 0;
+        size_t compressedEntries = 0;
+        uint64_t originalBytes = 0;
+        uint64_t storedBytes = 0;
+        uint64_t paddingBytes = 0;
+        uint64_t archiveSize = 0;
+    };
+
+    explicit ArchiveWriter(const ArchiveWriterConfig& config = {});
+
+    // Adiciona entradas (o caminho no arquivo é normalizado)
+    bool AddFile(const std::string& archivePath, const std::string& sourcePath);
+    bool AddData(const std::string& archivePath, std::vector<uint8_t> data);
+
+    // Grava o arquivo final
+    bool Write(const std::string& outputPath);
+
+    size_t GetEntryCount() const { return m_Pending.size(); }
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    struct PendingEntry {
+        std::string path;
+        std::string sourcePath;     // Vazio quando os dados vêm de AddData
+        std::vector<uint8_t> data;
+    };
+
+    bool HasEntry(const std::string& normalizedPath) const;
+
+    ArchiveWriterConfig m_Config;
+    std::vector<PendingEntry> m_Pending;
+    Stats m_Stats;
+};
+
+} // namespace Drift::Core::IO
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Drift/Core/IO/MappedFile.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Drift::Core::IO {
+
+/**
+ * @brief Backend de leitura assíncrona
+ */
+enum class AsyncIOBackend {
+    Auto,           // io_uring quando disponível, senão ThreadPool
+    IoUring,        // Linux io_uring (uma thread de IO, sem bloqueio em read())
+    ThreadPool      // Threads dedicadas fazendo pread
+};
+
+/**
+ * @brief Resultado de uma leitura assíncrona
+ */
+struct AsyncReadResult {
+    std::string path;
+    uint64_t offset = 0;
+    FileView data;          // Buffer próprio da visão; vazio em caso de falha
+    int error = 0;          // errno (0 = sucesso)
+
+    bool Succeeded() const { return error == 0; }
+};
+
+using AsyncReadCallback = std::function<void(AsyncReadResult&&)>;
+
+/**
+ * @brief Pedido de leitura de um trecho de arquivo
+ */
+struct AsyncReadRequest {
+    std::string path;
+    uint64_t offset = 0;
+    uint64_t size = 0;                  // 0 = até o fim do arquivo
+    AsyncReadCallback callback;         // Executado na thread de IO: deve ser curto
+};
+
+/**
+ * @brief Configuração do sistema de IO assíncrono
+ */
+struct AsyncIOConfig {
+    AsyncIOBackend backend = AsyncIOBackend::Auto;
+    uint32_t queueDepth = 256;          // Leituras simultâneas no io_uring
+    uint32_t fallbackThreads = 4;       // Threads do backend ThreadPool
+};
+
+/**
+ * @brief Leitura assíncrona de arquivos
+ *
+ * Características:
+ * - io_uring no Linux (syscalls diretas, sem liburing), fallback com pread em threads
+ * - Pedidos acumulados são processados em lote, ordenados por arquivo e offset
+ * - Um descritor por arquivo dentro do lote
+ * - Conclusões entregues por callback na thread de IO
+ */
+class AsyncIO {
+public:
+    struct Stats {
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+        uint64_t failed = 0;
+        uint64_t bytesRead = 0;
+        uint64_t batches = 0;
+    };
+
+    static AsyncIO& GetInstance();
+
+    bool Initialize(const AsyncIOConfig& config = {});
+    void Shutdown();     // Conclui os pedidos pendentes antes de parar
+    bool IsInitialized() const { return m_Initialized.load(); }
+    AsyncIOBackend GetBackend() const { return m_ActiveBackend; }
+
+    // Submissão (chamadas de qualquer thread)
+    bool SubmitRead(AsyncReadRequest request);
+    bool SubmitReads(std::vector<AsyncReadRequest> requests);
+
+    size_t GetPendingCount() const { return m_Pending.load(); }
+    Stats GetStats() const;
+
+    class Backend;
+
+private:
+    AsyncIO() = default;
+    ~AsyncIO();
+    AsyncIO(const AsyncIO&) = delete;
+    AsyncIO& operator=(const AsyncIO&) = delete;
+
+    void Complete(AsyncReadRequest& request, AsyncReadResult&& result);
+
+    std::unique_ptr<Backend> m_Backend;
+    AsyncIOBackend m_ActiveBackend = AsyncIOBackend::ThreadPool;
+    std::atomic<bool> m_Initialized{false};
+    std::atomic<size_t> m_Pending{0};
+    std::mutex m_LifecycleMutex;        // Protege m_Backend entre submissões e Initialize/Shutdown
+
+    // Estatísticas
+    std::atomic<uint64_t> m_Submitted{0};
+    std::atomic<uint64_t> m_Completed{0};
+    std::atomic<uint64_t> m_Failed{0};
+    std::atomic<uint64_t> m_BytesRead{0};
+    std::atomic<uint64_t> m_Batches{0};
+};
+
+} // namespace Drift::Core::IO
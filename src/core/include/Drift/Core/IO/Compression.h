@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Drift::Core::IO {
+
+/**
+ * @brief Métodos de compressão suportados
+ */
+enum class CompressionMethod : uint8_t {
+    None = 0,       // Dados armazenados sem compressão
+    LZ4Block = 1    // Compressão rápida no formato de bloco LZ4
+};
+
+/**
+ * @brief Compressão rápida no formato de bloco LZ4
+ *
+ * Implementação própria (sem dependências externas) voltada para descompressão
+ * muito rápida durante o carregamento de assets. O compressor é guloso, com
+ * tabela hash de 4 bytes, e a descompressão valida todos os limites.
+ */
+namespace FastCompression {
+
+// Tamanho máximo que a saída comprimida pode ocupar no pior caso
+size_t GetMaxCompressedSize(size_t sourceSize);
+
+// Maior saída que um bloco de compressedSize bytes pode produzir (cada byte rende no máximo 255)
+size_t GetMaxDecompressedSize(size_t compressedSize);
+
+// Comprime src em dst; retorna bytes escritos ou 0 se dst for pequeno demais
+size_t Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity);
+
+// Descomprime exatamente dstSize bytes; retorna false se o bloco for inválido
+bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+// Conveniência: comprime para um vector (vazio em caso de falha)
+std::vector<uint8_t> Compress(const uint8_t* src, size_t srcSize);
+
+} // namespace FastCompression
+
+} // namespace Drift::Core::IO
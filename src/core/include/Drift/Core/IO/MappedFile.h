@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Drift::Core::IO {
+
+class MappedFile;
+
+/**
+ * @brief Dica de padrão de acesso para o kernel (madvise / PrefetchVirtualMemory)
+ */
+enum class MapAccessHint {
+    Normal,         // Sem dica específica
+    Sequential,     // Leitura sequencial (readahead agressivo)
+    Random,         // Acesso aleatório (desativa readahead)
+    WillNeed,       // Páginas serão usadas em breve (prefetch)
+    DontNeed        // Páginas podem ser descartadas do working set
+};
+
+/**
+ * @brief Visão somente-leitura (zero-copy) sobre um bloco de bytes
+ *
+ * owner mantém o armazenamento vivo enquanto existir alguma cópia da visão:
+ * um MappedFile, ou um buffer descomprimido de um arquivo .dpak. Para dados
+ * sem dono, o chamador é responsável pelo tempo de vida do buffer.
+ */
+struct FileView {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    std::shared_ptr<const void> owner;      // Mantém mapeamento/buffer vivo
+    const MappedFile* mapping = nullptr;    // Arquivo mapeado de origem, se houver
+
+    FileView() = default;
+    FileView(const uint8_t* d, size_t s, std::shared_ptr<const void> o = nullptr, const MappedFile* m = nullptr)
+        : data(d), size(s), owner(std::move(o)), mapping(m) {}
+
+    bool Empty() const { return data == nullptr || size == 0; }
+    bool IsValid() const { return data != nullptr; }    // Aponta para um payload, mesmo que de 0 bytes
+    bool IsOwned() const { return owner != nullptr; }
+    bool IsMapped() const { return mapping != nullptr; }
+    const uint8_t* begin() const { return data; }
+    const uint8_t* end() const { return data + size; }
+
+    // Sub-visão [offset, offset + length); length = 0 significa "até o fim"
+    FileView SubView(size_t offset, size_t length = 0) const;
+
+    // Repassa a dica de acesso ao mapeamento de origem (no-op para buffers)
+    void Advise(MapAccessHint hint) const;
+
+    // Cria uma visão que assume a posse de um buffer em memória
+    static FileView FromBuffer(std::vector<uint8_t>&& buffer);
+};
+
+/**
+ * @brief Arquivo mapeado em memória somente-leitura
+ *
+ * Características:
+ * - mmap (POSIX) / CreateFileMapping (Windows)
+ * - Dicas de acesso via madvise
+ * - Páginas compartilhadas com o page cache entre processos
+ * - Sempre gerenciado por shared_ptr para que FileViews possam reter o mapeamento
+ */
+class MappedFile : public std::enable_shared_from_this<MappedFile> {
+public:
+    ~MappedFile();
+
+    /**
+     * @brief Mapeia um arquivo inteiro
+     * @return nullptr se o arquivo não existir ou não puder ser mapeado
+     */
+    static std::shared_ptr<MappedFile> Open(const std::string& path, MapAccessHint hint = MapAccessHint::Normal);
+
+    // Acesso aos dados
+    const uint8_t* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+    const std::string& GetPath() const { return m_Path; }
+
+    // Visões zero-copy
+    FileView GetView() const;
+    FileView GetView(size_t offset, size_t length) const;
+
+    // Dicas de acesso (length = 0 significa "até o fim")
+    void Advise(MapAccessHint hint, size_t offset = 0, size_t length = 0) const;
+
+private:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string m_Path;
+    const uint8_t* m_Data = nullptr;
+    size_t m_Size = 0;
+
+#ifdef _WIN32
+    void* m_FileHandle = nullptr;
+    void* m_MappingHandle = nullptr;
+#endif
+};
+
+/**
+ * @brief Pede ao SO que traga um arquivo inteiro para o page cache, sem mapeá-lo
+ *
+ * posix_fadvise(WILLNEED) / F_RDADVISE; a leitura segue em segundo plano e as páginas
+ * continuam no cache depois que a função retorna. No Windows mapeia e usa
+ * PrefetchVirtualMemory: as páginas ficam na lista standby após o unmap.
+ */
+void PrefetchFileContents(const std::string& path);
+
+} // namespace Drift::Core::IO
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <vector>
 #include <mutex>
+#include "Drift/Core/ProfiledMutex.h"
 
 // Forward declaration para evitar dependência circular
 typedef long HRESULT;
@@ -114,7 +115,7 @@ private:
     
     LogConfig m_Config;
     std::vector<std::shared_ptr<ILogOutput>> m_Outputs;
-    std::mutex m_Mutex;
+    ProfiledMutex m_Mutex{"LogSystem"};
 };
 
 // Funções globais para compatibilidade
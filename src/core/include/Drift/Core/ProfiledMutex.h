@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Drift/Core/Clock.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Drift::Core {
+
+// Contadores de um lock nomeado; todos os ProfiledMutex com o mesmo nome somam aqui
+struct LockStats {
+    std::atomic<uint64_t> acquisitions{0};
+    std::atomic<uint64_t> contentions{0};       // Aquisições que precisaram esperar
+    std::atomic<uint64_t> waitNs{0};
+    std::atomic<uint64_t> maxWaitNs{0};
+    std::atomic<uint64_t> holdNs{0};
+    std::atomic<uint64_t> maxHoldNs{0};
+
+    void Reset();
+};
+
+// Cópia dos contadores para relatórios
+struct LockStatsSnapshot {
+    std::string name;
+    uint64_t acquisitions = 0;
+    uint64_t contentions = 0;
+    uint64_t waitNs = 0;
+    uint64_t maxWaitNs = 0;
+    uint64_t holdNs = 0;
+    uint64_t maxHoldNs = 0;
+
+    double GetContentionPercent() const {
+        return acquisitions > 0 ? 100.0 * contentions / acquisitions : 0.0;
+    }
+    double GetAverageWaitUs() const { return contentions > 0 ? waitNs / 1000.0 / contentions : 0.0; }
+    double GetAverageHoldUs() const { return acquisitions > 0 ? holdNs / 1000.0 / acquisitions : 0.0; }
+};
+
+/**
+ * @brief std::mutex que mede espera, posse e disputa por lock nomeado
+ *
+ * Sem disputa custa um try_lock, duas leituras de Clock::NowNs() e alguns incrementos
+ * relaxed; só quem precisa esperar entra no caminho lento. O tempo de posse vai de
+ * lock() a unlock(), então condition_variable precisa de condition_variable_any.
+ * Os contadores ficam num registro global que nunca é destruído, para locks de
+ * singletons poderem ser usados até o fim do processo.
+ */
+class ProfiledMutex {
+public:
+    explicit ProfiledMutex(const char* name = "Sem nome");
+
+    ProfiledMutex(const ProfiledMutex&) = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+    void lock() {
+        if (!m_Mutex.try_lock()) {
+            LockContended();
+        }
+        m_LockedAtNs = Clock::NowNs();
+        m_Stats->acquisitions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool try_lock() {
+        if (!m_Mutex.try_lock()) {
+            return false;
+        }
+        m_LockedAtNs = Clock::NowNs();
+        m_Stats->acquisitions.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void unlock() {
+        uint64_t heldNs = Clock::NowNs() - m_LockedAtNs;
+        m_Mutex.unlock();
+        m_Stats->holdNs.fetch_add(heldNs, std::memory_order_relaxed);
+        UpdateMax(m_Stats->maxHoldNs, heldNs);
+    }
+
+    const LockStats& GetStats() const { return *m_Stats; }
+    void ResetStats() { m_Stats->Reset(); }
+
+    // Todos os locks registrados, na ordem de criação
+    static std::vector<LockStatsSnapshot> GetAllStats();
+    static void ResetAllStats();
+
+private:
+    void LockContended();
+
+    static void UpdateMax(std::atomic<uint64_t>& target, uint64_t value) {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::mutex m_Mutex;
+    LockStats* m_Stats;
+    uint64_t m_LockedAtNs = 0;      // Só o dono do lock escreve
+};
+
+} // namespace Drift::Core
@@ -10,17 +10,60 @@
 #include <atomic>
 #include <thread>
 #include <fstream>
+#include <deque>
+#include <array>
+#include <cstdint>
+#include "Drift/Core/Clock.h"
+#include "Drift/Core/HardwareCounters.h"
+#include "Drift/Core/ProfiledMutex.h"
+#include "Drift/Core/ProfilerStream.h"
+
+// Instrumentação compilada (opção CMake DRIFT_ENABLE_PROFILING):
+// com 0 todas as macros PROFILE_* / DRIFT_PROFILE_* viram no-ops sem custo
+#ifndef DRIFT_PROFILING_ENABLED
+#define DRIFT_PROFILING_ENABLED 1
+#endif
+
+// Rastreamento de alocações (opção CMake DRIFT_ENABLE_ALLOCATION_TRACKING):
+// com 1 o Core substitui operator new/delete globais e PROFILE_MEMORY_TAG fica ativo
+#ifndef DRIFT_ALLOCATION_TRACKING
+#define DRIFT_ALLOCATION_TRACKING 0
+#endif
 
 namespace Drift::Core {
 
+// Identificador de seção, registrado uma vez por ponto de chamada
+using SectionId = uint32_t;
+constexpr SectionId INVALID_SECTION_ID = UINT32_MAX;
+
+// Identificador de contador/gauge, registrado uma vez por ponto de chamada
+using CounterId = uint32_t;
+constexpr size_t MAX_PROFILE_COUNTERS = 256;
+
+enum class CounterType : uint32_t {
+    Counter,    // Somado dentro do frame e zerado no EndFrame (draw calls, glyphs novos)
+    Gauge       // Último valor informado, mantido entre frames (fila, memória)
+};
+
 // Configuração do profiler
 struct ProfilerConfig {
     bool enableProfiling = true;
     bool enableThreadProfiling = false;
     bool enableMemoryProfiling = false;
     bool enableCallStack = false;
+    bool enableHardwareCounters = false;    // Ciclos, instruções e misses por seção (Linux, perf_event_open)
     size_t maxSections = 1000;
     size_t maxDepth = 32;
+    size_t eventBufferSize = 16384;     // Eventos por thread até a agregação (arredondado para potência de 2)
+    size_t captureEventLimit = 1 << 20; // Seções guardadas por uma captura de timeline
+    size_t frameHistorySize = 300;      // Frames na janela dos percentis
+    double spikeThresholdMs = 0.0;      // Frame mais longo grava a timeline recente (0 = desligado)
+    size_t spikeHistoryFrames = 30;     // Frames gravados por pico (incluindo o próprio)
+    size_t maxSpikeDumps = 16;          // Arquivos de pico por sessão
+    std::string spikeDirectory = "profiler_spikes";
+    uint32_t samplingFrequencyHz = 0;   // Amostragem de pilhas por SIGPROF (0 = desligada, só Linux)
+    size_t samplingBufferSize = 4096;   // Amostras pendentes até a agregação (alocado no primeiro uso)
+    std::string streamAddress = "";     // Streaming ao vivo: "unix:/caminho" ou "tcp:porta" (vazio = desligado)
     std::string outputFile = "";
     std::function<void(const std::string&)> customOutput = nullptr;
 };
@@ -44,6 +87,14 @@ struct SectionStats {
     size_t peakMemoryUsage = 0;
     size_t currentMemoryUsage = 0;
     
+    // Contadores de hardware, inclusivos como o tempo (ProfilerConfig::enableHardwareCounters)
+    uint64_t counterSamples = 0;        // Chamadas em que os contadores foram lidos
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t l1dMisses = 0;
+    uint64_t llcMisses = 0;
+    uint64_t branchMisses = 0;
+    
     // Informações de thread
     std::thread::id threadId;
     uint32_t threadIndex = 0;
@@ -65,23 +116,79 @@ struct SectionStats {
     double GetLastTimeMs() const { return lastTimeNs / 1000000.0; }
     double GetStandardDeviationMs() const { return standardDeviationNs / 1000000.0; }
     
+    // Instruções por ciclo e misses a cada mil instruções (0 sem contadores)
+    double GetIPC() const { return cycles > 0 ? static_cast<double>(instructions) / cycles : 0.0; }
+    double GetL1DMissesPerKInstr() const { return PerKiloInstructions(l1dMisses); }
+    double GetLLCMissesPerKInstr() const { return PerKiloInstructions(llcMisses); }
+    double GetBranchMissesPerKInstr() const { return PerKiloInstructions(branchMisses); }
+    
     void UpdateVariance(uint64_t newTimeNs);
     void Reset();
+    
+private:
+    double PerKiloInstructions(uint64_t count) const {
+        return instructions > 0 ? 1000.0 * static_cast<double>(count) / instructions : 0.0;
+    }
 };
 
-// Informações de uma seção ativa
-struct ActiveSection {
-    std::string name;
-    std::chrono::high_resolution_clock::time_point startTime;
-    std::string parentSection;
-    uint32_t depth;
-    std::thread::id threadId;
-    size_t memorySnapshot;
+// Registro gravado pelas threads instrumentadas (16 bytes, sem strings)
+enum class ProfileEventType : uint32_t {
+    Begin,
+    End,
+    Memory,     // Uso de memória no início/fim da seção aberta (timeNs carrega o valor)
+    Counter     // Um contador de hardware, em sequência na ordem de HardwareCounter (idem)
+};
+
+struct ProfileEvent {
+    uint64_t timeNs;
+    SectionId section;
+    ProfileEventType type;
+};
+
+// Percentis de tempo por frame na janela dos últimos frames
+struct FramePercentiles {
+    uint64_t p50Ns = 0;
+    uint64_t p95Ns = 0;
+    uint64_t p99Ns = 0;
+    uint64_t maxNs = 0;
+    uint32_t sampleCount = 0;       // Frames da janela em que a seção rodou
     
-    ActiveSection(const std::string& n, const std::string& parent = "", uint32_t d = 0)
-        : name(n), startTime(std::chrono::high_resolution_clock::now())
-        , parentSection(parent), depth(d), threadId(std::this_thread::get_id())
-        , memorySnapshot(0) {}
+    double GetP50Ms() const { return p50Ns / 1000000.0; }
+    double GetP95Ms() const { return p95Ns / 1000000.0; }
+    double GetP99Ms() const { return p99Ns / 1000000.0; }
+    double GetMaxMs() const { return maxNs / 1000000.0; }
+};
+
+// Tempo inclusivo de uma seção no último frame fechado
+struct ProfileFrameSection {
+    SectionId section;
+    uint64_t timeNs;
+};
+
+// Seção concluída guardada por uma captura de timeline
+struct ProfileTimelineEvent {
+    uint64_t startNs;
+    uint64_t endNs;
+    SectionId section;
+    uint32_t threadIndex;
+    uint32_t depth;
+};
+
+// Valor de um contador no fim de um frame (timeline das capturas)
+struct ProfileCounterSample {
+    uint64_t timeNs;
+    CounterId counter;
+    double value;
+};
+
+// Nó da árvore de chamadas: a mesma seção sob pais diferentes gera nós diferentes.
+// O nó 0 é a raiz (sem seção); threads diferentes são somadas no mesmo caminho.
+struct ProfileNode {
+    SectionId section = INVALID_SECTION_ID;
+    uint32_t parent = 0;
+    uint32_t depth = 0;
+    std::vector<uint32_t> children;
+    SectionStats stats;
 };
 
 // Interface para output do profiler
@@ -123,18 +230,73 @@ public:
     void AddOutput(std::shared_ptr<IProfilerOutput> output);
     void RemoveOutput(std::shared_ptr<IProfilerOutput> output);
     
-    // Controle de seções
+    // Registro de seções: o mesmo nome sempre devolve o mesmo id
+    SectionId RegisterSection(const std::string& name);
+    std::string GetSectionName(SectionId section) const;
+    
+    // Caminho quente: grava o evento no buffer da thread, sem locks nem strings.
+    // BeginSection retorna false quando não gravou (desabilitado ou profundidade máxima);
+    // nesse caso o EndSection correspondente não deve ser chamado. Com o buffer cheio a
+    // seção é descartada mas retorna true: o EndSection encerra o descarte da subárvore.
+    bool BeginSection(SectionId section);
+    void EndSection(SectionId section);
+    
+    // Controle de seções por nome (resolve o id a cada chamada)
     void BeginSection(const std::string& name);
     void EndSection(const std::string& name);
     
-    // Controle de seções com contexto
+    // Controle de seções com contexto (o pai vem do aninhamento real; mantido por compatibilidade)
     void BeginSection(const std::string& name, const std::string& parent);
     void EndSection(const std::string& name, const std::string& parent);
     
+    // Agrega os eventos pendentes de todas as threads (EndFrame e as consultas também agregam)
+    void Flush();
+    
+    // Delimitação de frames: EndFrame agrega os eventos, fecha o frame das capturas,
+    // alimenta a janela de percentis e grava a timeline recente se o frame passar de
+    // ProfilerConfig::spikeThresholdMs. Sem BeginFrame o frame começa no EndFrame anterior.
+    void BeginFrame();
+    void EndFrame();
+    uint64_t GetFrameIndex() const;
+    FramePercentiles GetFramePercentiles() const;
+    FramePercentiles GetSectionPercentiles(const std::string& name) const;
+    
+    // Cópias para overlays que desenham todo frame: escrevem em buffers do chamador, sem
+    // alocar, e retornam quantos itens foram escritos
+    size_t CopyFrameTimes(uint64_t* out, size_t capacity) const;                     // Mais recentes, do mais antigo ao mais novo
+    size_t CopyLastFrameSections(ProfileFrameSection* out, size_t capacity) const;   // Mais caras primeiro
+    size_t CopySectionName(SectionId section, char* out, size_t capacity) const;     // Trunca; sempre termina em '\0'
+    
+    // Contadores e gauges: caminho quente sem locks (um atômico por contador). Cada EndFrame
+    // guarda o valor do frame numa série dos últimos ProfilerConfig::frameHistorySize frames,
+    // que também entra nas timelines exportadas (capturas e picos).
+    CounterId RegisterCounter(const std::string& name, CounterType type);
+    void AddCounter(CounterId counter, double delta);
+    void SetGauge(CounterId counter, double value);
+    std::vector<double> GetCounterHistory(const std::string& name) const;  // Do mais antigo ao mais novo
+    
+    // Nome exibido na timeline para a thread atual
+    void SetThreadName(const std::string& name);
+    std::string GetThreadNameByIndex(uint32_t threadIndex) const;
+    
+    // Thread e seção aberta da thread atual; seguro dentro de handler de sinal (amostragem).
+    // false se a thread nunca gravou seções.
+    static bool GetSamplingContext(uint32_t& threadIndex, SectionId& section);
+    
+    // Captura de timeline: guarda cada seção concluída, com início e fim, nos próximos
+    // 'frameCount' frames (cada EndFrame() fecha um frame). ExportChromeTrace grava o JSON
+    // do formato Chrome trace, aberto por chrome://tracing e pelo Perfetto UI.
+    void StartCapture(uint32_t frameCount);
+    void StopCapture();
+    bool IsCapturing() const;
+    bool ExportChromeTrace(const std::string& filename) const;
+    
     // Consulta de estatísticas
     SectionStats GetSectionStats(const std::string& name) const;
     std::vector<std::string> GetSectionNames() const;
     std::vector<std::pair<std::string, SectionStats>> GetAllStats() const;
+    std::vector<ProfileNode> GetCallTree() const;
+    uint64_t GetDroppedEventCount() const;
     
     // Relatórios
     void PrintReport() const;
@@ -146,49 +308,178 @@ public:
     void Reset();
     
     // Utilitários
-    bool IsEnabled() const { return m_Config.enableProfiling; }
-    uint64_t GetCurrentTimeNs() const;
+    bool IsEnabled() const { return m_Enabled.load(std::memory_order_relaxed); }
+    uint64_t GetCurrentTimeNs() const { return Clock::NowNs(); }
     size_t GetCurrentMemoryUsage() const;
-    
-    // Thread-local storage para seções ativas
-    static thread_local std::vector<ActiveSection> s_ActiveSections;
 
 private:
-    Profiler() = default;
-    ~Profiler() = default;
+    // Buffer circular de eventos de uma thread: só a thread dona escreve,
+    // só o agregador (sob m_Mutex) lê
+    struct ThreadBuffer;
+    struct ThreadBufferOwner;
+    
+    // Tempos dos últimos frames (buffer circular) para os percentis
+    struct FrameWindow {
+        std::vector<uint64_t> samples;
+        size_t next = 0;
+        
+        void Push(uint64_t timeNs, size_t capacity);
+        FramePercentiles Compute() const;
+    };
+    
+    // Timeline de um frame guardada para o detector de picos
+    struct FrameTimeline {
+        uint64_t startNs = 0;
+        uint64_t endNs = 0;
+        std::vector<ProfileTimelineEvent> events;
+        std::vector<ProfileCounterSample> counters;
+    };
+    
+    // Série de valores por frame de um contador (buffer circular)
+    struct CounterSeries {
+        std::string name;
+        CounterType type = CounterType::Counter;
+        std::vector<double> samples;
+        size_t next = 0;
+    };
+    
+    Profiler();
+    ~Profiler();
     Profiler(const Profiler&) = delete;
     Profiler& operator=(const Profiler&) = delete;
     
-    void UpdateStats(const std::string& name, uint64_t durationNs, const std::string& parent = "", uint32_t depth = 0);
-    void UpdateMemoryStats(const std::string& name, size_t memoryUsage);
+    ThreadBuffer* GetThreadBuffer();
+    void PushEvent(ThreadBuffer& buffer, SectionId section, ProfileEventType type, uint64_t value);
+    bool OpenHardwareCounters(ThreadBuffer& buffer);
+    void TryFlush();
+    void CollectEvents() const;
+    void ProcessEvent(ThreadBuffer& buffer, const ProfileEvent& event) const;
+    uint32_t FindOrAddChild(uint32_t parent, SectionId section) const;
+    std::string GetSectionNameLocked(SectionId section) const;
+    void AppendCallTree(std::ostream& out, uint32_t node, uint64_t parentTimeNs) const;
+    void AppendPercentiles(std::ostream& out) const;
+    void AppendHardwareCounters(std::ostream& out, const std::vector<std::pair<std::string, SectionStats>>& sections) const;
+    void AppendCounters(std::ostream& out) const;
+    void AppendLockContention(std::ostream& out) const;
+    void SampleCounters(uint64_t endNs, std::vector<ProfileCounterSample>& samples);
+    void PublishStreamFrame(ProfilerStreamFrame& frame, const std::vector<ProfileCounterSample>& counters);
+    bool WriteChromeTrace(const std::string& filename, const std::vector<ProfileTimelineEvent>& events,
+                          const std::vector<ProfileCounterSample>& counters, const std::vector<uint64_t>& frameEnds,
+                          uint64_t startNs, uint64_t droppedEvents) const;
+    void DumpSpike(uint64_t frameNs);
     std::string FormatDuration(uint64_t nanoseconds) const;
     std::string FormatMemory(size_t bytes) const;
     std::string GetThreadName(std::thread::id threadId) const;
+    std::string GetThreadNameLocked(uint32_t threadIndex) const;
     
     ProfilerConfig m_Config;
-    mutable std::mutex m_Mutex;
-    std::unordered_map<std::string, SectionStats> m_Sections;
+    mutable ProfiledMutex m_Mutex{"Profiler"};
     std::vector<std::shared_ptr<IProfilerOutput>> m_Outputs;
+    
+    // Lidos no caminho quente sem lock
+    std::atomic<bool> m_Enabled{true};
+    std::atomic<bool> m_MemoryProfiling{false};
+    std::atomic<bool> m_HardwareCounters{false};
+    std::atomic<uint32_t> m_MaxDepth{32};
+    std::atomic<size_t> m_EventBufferSize{16384};
+    
+    // Registro de seções (ids estáveis até o fim do processo)
+    std::vector<std::string> m_SectionNames;
+    std::unordered_map<std::string, SectionId> m_SectionIds;
+    
+    // Dados agregados (atualizados pelas consultas, por isso mutable)
+    mutable std::vector<SectionStats> m_SectionStats;
+    mutable std::vector<ProfileNode> m_CallTree;
+    mutable std::vector<std::unique_ptr<ThreadBuffer>> m_ThreadBuffers;
+    mutable uint64_t m_RetiredDroppedEvents = 0;
     std::atomic<uint32_t> m_ThreadCounter{0};
-    std::unordered_map<std::thread::id, uint32_t> m_ThreadIndices;
+    std::unordered_map<uint32_t, std::string> m_ThreadNames;   // Por threadIndex, sobrevive à thread
+    
+    // Captura de timeline (protegida por m_Mutex)
+    mutable bool m_Capturing = false;
+    mutable uint32_t m_CaptureFramesRemaining = 0;
+    mutable uint64_t m_CaptureStartNs = 0;
+    mutable uint64_t m_CaptureDroppedEvents = 0;
+    mutable std::vector<ProfileTimelineEvent> m_CaptureEvents;
+    mutable std::vector<ProfileCounterSample> m_CaptureCounters;
+    mutable std::vector<uint64_t> m_CaptureFrameEnds;
+    
+    // Frames (protegidos por m_Mutex); os tempos do frame atual são somados pelo agregador
+    uint64_t m_FrameIndex = 0;
+    uint64_t m_FrameStartNs = 0;
+    mutable std::vector<uint64_t> m_FrameSectionTimes;      // Por SectionId
+    mutable std::vector<SectionId> m_FrameSections;         // Seções com tempo no frame atual
+    std::vector<ProfileFrameSection> m_LastFrameSections;   // Do último frame fechado (capacidade reaproveitada)
+    mutable std::vector<ProfileTimelineEvent> m_FrameEvents; // Só com o detector de picos ligado
+    FrameWindow m_FrameWindow;
+    std::vector<FrameWindow> m_SectionWindows;
+    std::deque<FrameTimeline> m_SpikeHistory;
+    size_t m_SpikeDumps = 0;
+    
+    // Contadores: valores do frame atual (bits de double) e séries por frame (sob m_Mutex)
+    std::array<std::atomic<uint64_t>, MAX_PROFILE_COUNTERS> m_CounterValues{};
+    std::vector<CounterSeries> m_Counters;
+    std::unordered_map<std::string, CounterId> m_CounterIds;
+    
+    // Nomes já enviados ao ProfilerStreamServer (recomeça quando o servidor reinicia)
+    size_t m_StreamedSections = 0;
+    size_t m_StreamedCounters = 0;
+    
+    static thread_local ThreadBuffer* s_ThreadBuffer;
 };
 
 // RAII helper para profiling automático
 class ScopedProfiler {
 public:
+    // Caminho rápido: id estático do ponto de chamada (ver PROFILE_SCOPE)
+    explicit ScopedProfiler(SectionId section, bool condition = true)
+        : m_Section(section)
+        , m_IsActive(condition && Profiler::GetInstance().BeginSection(section)) {}
+    
+    // Nome dinâmico: resolve o id a cada construção (ver PROFILE_SCOPE_DYNAMIC)
     ScopedProfiler(const std::string& name, const std::string& parent = "");
-    ~ScopedProfiler();
+    
+    ~ScopedProfiler() {
+        if (m_IsActive) {
+            End();
+        }
+    }
+    
+    ScopedProfiler(const ScopedProfiler&) = delete;
+    ScopedProfiler& operator=(const ScopedProfiler&) = delete;
     
     // Métodos para profiling manual
-    void End();
+    void End() {
+        if (m_IsActive) {
+            Profiler::GetInstance().EndSection(m_Section);
+            m_IsActive = false;
+        }
+    }
     bool IsActive() const { return m_IsActive; }
 
 private:
-    std::string m_Name;
-    std::string m_Parent;
+    SectionId m_Section;
     bool m_IsActive;
-    std::chrono::high_resolution_clock::time_point m_StartTime;
-    size_t m_StartMemory;
+};
+
+// Tag de alocação (subsistema ou seção); a tag 0 recebe o que não tem tag
+using MemoryTag = uint16_t;
+constexpr size_t MAX_MEMORY_TAGS = 64;
+
+// Alocações de uma tag (contadas pelos hooks de operator new/delete)
+struct MemoryTagStats {
+    std::string name;
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    uint64_t bytesAllocated = 0;
+    uint64_t liveBytes = 0;
+    uint64_t peakLiveBytes = 0;
+    
+    // Por frame (MemoryProfiler::EndFrame, chamado por Profiler::EndFrame)
+    uint64_t frameAllocations = 0;          // Último frame
+    uint64_t frameBytes = 0;
+    uint64_t peakFrameAllocations = 0;
+    double averageFrameAllocations = 0.0;
 };
 
 // Profiler de memória
@@ -196,41 +487,180 @@ class MemoryProfiler {
 public:
     static MemoryProfiler& GetInstance();
     
+    // Contagem manual (PROFILE_MEMORY_ALLOC/DEALLOC)
     void TrackAllocation(size_t size, const std::string& context = "");
     void TrackDeallocation(size_t size, const std::string& context = "");
     size_t GetCurrentUsage() const { return m_CurrentUsage.load(); }
     size_t GetPeakUsage() const { return m_PeakUsage.load(); }
     void Reset();
     
+    // Rastreamento automático: cada operator new/delete é contado na tag do topo da
+    // pilha da thread (ScopedMemoryTag / PROFILE_MEMORY_TAG). Sem a opção de build,
+    // IsAllocationTrackingEnabled() é false e as tags não contam nada.
+    static bool IsAllocationTrackingEnabled();
+    MemoryTag RegisterTag(const std::string& name);
+    static void PushTag(MemoryTag tag);
+    static void PopTag();
+    static MemoryTag GetCurrentTag();
+    
+    std::vector<MemoryTagStats> GetTagStats() const;
+    uint64_t GetTrackedLiveBytes() const;
+    void EndFrame();
+    std::string GenerateReport() const;
+    
 private:
-    MemoryProfiler() = default;
+    MemoryProfiler();
+    
+    // Totais no fim do frame anterior, para as diferenças por frame
+    struct TagFrameState {
+        uint64_t lastAllocations = 0;
+        uint64_t lastBytes = 0;
+        uint64_t frameAllocations = 0;
+        uint64_t frameBytes = 0;
+        uint64_t peakFrameAllocations = 0;
+    };
+    
     std::atomic<size_t> m_CurrentUsage{0};
     std::atomic<size_t> m_PeakUsage{0};
     mutable std::mutex m_Mutex;
     std::unordered_map<std::string, size_t> m_AllocationByContext;
+    
+    std::vector<std::string> m_TagNames;
+    std::vector<TagFrameState> m_TagFrames;
+    uint64_t m_FrameCount = 0;
+};
+
+/**
+ * @brief Profiler por amostragem: mostra para onde vai a CPU mesmo sem PROFILE_SCOPE
+ *
+ * Cada thread registrada tem um timer no próprio relógio de CPU (timer_create com
+ * SIGEV_THREAD_ID) que dispara SIGPROF nela; o handler percorre os frame pointers da pilha
+ * interrompida e a guarda, com a seção instrumentada aberta, num ring buffer sem locks. A
+ * agregação (Collect, chamado por Profiler::EndFrame) e a simbolização (ExportFoldedStacks,
+ * via dladdr) ficam fora do handler. Só Linux (x86-64 e AArch64 para as pilhas).
+ *
+ * Ligado por ProfilerConfig::samplingFrequencyHz ou diretamente por Start().
+ */
+class SamplingProfiler {
+public:
+    static SamplingProfiler& GetInstance();
+    
+    bool Start(uint32_t frequencyHz, size_t bufferSize = 4096);
+    void Stop();
+    bool IsRunning() const { return m_Running.load(std::memory_order_relaxed); }
+    
+    // Move as amostras do ring buffer para as pilhas agregadas
+    void Collect();
+    void Clear();
+    uint64_t GetSampleCount() const;
+    uint64_t GetDroppedSampleCount() const;
+    
+    // Threads amostradas: o Profiler registra cada thread ao criar o buffer dela e a remove
+    // ao fim da thread. Grava os limites da pilha para o handler e arma o timer se ativo.
+    static void RegisterCurrentThread();
+    static void UnregisterCurrentThread();
+    
+    // Uma linha por pilha: "thread;[seção];raiz;...;folha contagem" (flamegraph.pl, inferno,
+    // speedscope). Sem símbolo exportado o quadro sai como "módulo+0xoffset" para addr2line.
+    bool ExportFoldedStacks(const std::string& filename) const;
+    
+private:
+    SamplingProfiler() = default;
+    
+    // Chave da pilha: thread, seção e endereços da raiz para a folha
+    struct StackHash {
+        size_t operator()(const std::vector<uintptr_t>& stack) const;
+    };
+    
+    void CollectLocked() const;
+    
+    mutable std::mutex m_Mutex;
+    std::atomic<bool> m_Running{false};
+    mutable std::unordered_map<std::vector<uintptr_t>, uint64_t, StackHash> m_Stacks;
+    mutable uint64_t m_SampleCount = 0;
+};
+
+// RAII: alocações feitas no escopo contam na tag
+class ScopedMemoryTag {
+public:
+    explicit ScopedMemoryTag(MemoryTag tag) { MemoryProfiler::PushTag(tag); }
+    ~ScopedMemoryTag() { MemoryProfiler::PopTag(); }
+    
+    ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
 };
 
+#define DRIFT_PROFILE_CONCAT_INNER(a, b) a##b
+#define DRIFT_PROFILE_CONCAT(a, b) DRIFT_PROFILE_CONCAT_INNER(a, b)
+#define DRIFT_PROFILE_UNIQUE(prefix) DRIFT_PROFILE_CONCAT(prefix, __LINE__)
+
+// Só aceita const char*: um std::string montado em tempo de execução não compila em PROFILE_SCOPE
+inline const char* ProfileStaticName(const char* name) { return name; }
+
+#if DRIFT_PROFILING_ENABLED
+
+// Id registrado uma vez por ponto de chamada (static local): o nome precisa ser
+// constante naquele ponto. Para nomes montados em tempo de execução use PROFILE_SCOPE_DYNAMIC.
+#define DRIFT_PROFILE_SCOPE_IMPL(condition, name) \
+    static const ::Drift::Core::SectionId DRIFT_PROFILE_UNIQUE(driftSectionId_) = \
+        ::Drift::Core::Profiler::GetInstance().RegisterSection(::Drift::Core::ProfileStaticName(name)); \
+    ::Drift::Core::ScopedProfiler DRIFT_PROFILE_UNIQUE(driftProfiler_)(DRIFT_PROFILE_UNIQUE(driftSectionId_), (condition))
+
 // Macros para facilitar o uso
-#define PROFILE_SCOPE(name) Drift::Core::ScopedProfiler profiler##__LINE__(name)
+#define PROFILE_SCOPE(name) DRIFT_PROFILE_SCOPE_IMPL(true, name)
 #define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
-#define PROFILE_SCOPE_WITH_PARENT(name, parent) Drift::Core::ScopedProfiler profiler##__LINE__(name, parent)
+#define PROFILE_SCOPE_DYNAMIC(name) ::Drift::Core::ScopedProfiler DRIFT_PROFILE_UNIQUE(driftProfiler_)(name)
 
-// Macros DRIFT_PROFILE_* para compatibilidade com o sistema de fontes
-#define DRIFT_PROFILE_SCOPE(name) Drift::Core::ScopedProfiler driftProfiler##__LINE__(name)
-#define DRIFT_PROFILE_FUNCTION() DRIFT_PROFILE_SCOPE(__FUNCTION__)
-#define DRIFT_PROFILE_SCOPE_WITH_PARENT(name, parent) Drift::Core::ScopedProfiler driftProfiler##__LINE__(name, parent)
+// O pai vem do aninhamento real das seções; o argumento é mantido por compatibilidade
+#define PROFILE_SCOPE_WITH_PARENT(name, parent) PROFILE_SCOPE(name)
 
 // Macros condicionais
-#define PROFILE_SCOPE_IF(condition, name) \
-    std::unique_ptr<Drift::Core::ScopedProfiler> profiler##__LINE__; \
-    if (condition) profiler##__LINE__ = std::make_unique<Drift::Core::ScopedProfiler>(name)
-
+#define PROFILE_SCOPE_IF(condition, name) DRIFT_PROFILE_SCOPE_IMPL(condition, name)
 #define PROFILE_FUNCTION_IF(condition) PROFILE_SCOPE_IF(condition, __FUNCTION__)
 
 // Macros para profiling de memória
 #define PROFILE_MEMORY_ALLOC(size) Drift::Core::MemoryProfiler::GetInstance().TrackAllocation(size, __FUNCTION__)
 #define PROFILE_MEMORY_DEALLOC(size) Drift::Core::MemoryProfiler::GetInstance().TrackDeallocation(size, __FUNCTION__)
 
+// Contadores por frame: PROFILE_COUNTER soma no frame, PROFILE_GAUGE guarda o último valor
+#define DRIFT_PROFILE_COUNTER_IMPL(type, method, name, value) do { \
+        static const ::Drift::Core::CounterId driftCounter_ = ::Drift::Core::Profiler::GetInstance().RegisterCounter( \
+            ::Drift::Core::ProfileStaticName(name), ::Drift::Core::CounterType::type); \
+        ::Drift::Core::Profiler::GetInstance().method(driftCounter_, static_cast<double>(value)); \
+    } while (0)
+#define PROFILE_COUNTER(name, value) DRIFT_PROFILE_COUNTER_IMPL(Counter, AddCounter, name, value)
+#define PROFILE_GAUGE(name, value) DRIFT_PROFILE_COUNTER_IMPL(Gauge, SetGauge, name, value)
+
+#else
+
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+#define PROFILE_SCOPE_DYNAMIC(name) ((void)0)
+#define PROFILE_SCOPE_WITH_PARENT(name, parent) ((void)0)
+#define PROFILE_SCOPE_IF(condition, name) ((void)0)
+#define PROFILE_FUNCTION_IF(condition) ((void)0)
+#define PROFILE_MEMORY_ALLOC(size) ((void)0)
+#define PROFILE_MEMORY_DEALLOC(size) ((void)0)
+#define PROFILE_COUNTER(name, value) ((void)0)
+#define PROFILE_GAUGE(name, value) ((void)0)
+
+#endif
+
+#if DRIFT_ALLOCATION_TRACKING
+// Tag registrada uma vez por ponto de chamada, como PROFILE_SCOPE
+#define PROFILE_MEMORY_TAG(name) \
+    static const ::Drift::Core::MemoryTag DRIFT_PROFILE_UNIQUE(driftMemoryTag_) = \
+        ::Drift::Core::MemoryProfiler::GetInstance().RegisterTag(::Drift::Core::ProfileStaticName(name)); \
+    ::Drift::Core::ScopedMemoryTag DRIFT_PROFILE_UNIQUE(driftMemoryScope_)(DRIFT_PROFILE_UNIQUE(driftMemoryTag_))
+#else
+#define PROFILE_MEMORY_TAG(name) ((void)0)
+#endif
+
+// Macros DRIFT_PROFILE_* para compatibilidade com o sistema de fontes
+#define DRIFT_PROFILE_SCOPE(name) PROFILE_SCOPE(name)
+#define DRIFT_PROFILE_FUNCTION() PROFILE_FUNCTION()
+#define DRIFT_PROFILE_SCOPE_WITH_PARENT(name, parent) PROFILE_SCOPE_WITH_PARENT(name, parent)
+
 // Macros para profiling de performance específica
 #define PROFILE_PERF(name) PROFILE_SCOPE("[PERF]" name)
 #define PROFILE_RENDER(name) PROFILE_SCOPE("[RENDER]" name)
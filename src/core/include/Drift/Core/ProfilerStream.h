@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Drift::Core {
+
+/*
+ * Protocolo do streaming do profiler (versão 1)
+ *
+ * Cada mensagem é [u8 tipo][u32 tamanho do payload][payload], com inteiros e doubles
+ * na ordem de bytes nativa: servidor e visualizador rodam na mesma máquina (socket Unix
+ * ou TCP em 127.0.0.1; para outra máquina, use um túnel ssh).
+ *
+ *   Hello        u32 magic "DRFT", u16 versão                 primeira mensagem
+ *   SectionName  u32 id, u32 tamanho, bytes do nome           antes do primeiro uso do id
+ *   CounterName  u32 id, u8 tipo (0 contador, 1 gauge), u32 tamanho, bytes
+ *   Frame        u64 índice, u64 início (ns), u64 duração (ns), u32 seções, u32 contadores,
+ *                seções {u32 id, u64 tempo inclusivo no frame (ns)},
+ *                contadores {u32 id, f64 valor}
+ */
+constexpr uint32_t PROFILER_STREAM_MAGIC = 0x54465244;     // "DRFT"
+constexpr uint16_t PROFILER_STREAM_VERSION = 1;
+
+enum class ProfilerStreamMessage : uint8_t {
+    Hello = 1,
+    SectionName = 2,
+    CounterName = 3,
+    Frame = 4
+};
+
+// Um frame como trafega no stream
+struct ProfilerStreamFrame {
+    uint64_t index = 0;
+    uint64_t startNs = 0;
+    uint64_t durationNs = 0;
+    std::vector<std::pair<uint32_t, uint64_t>> sections;    // id, tempo no frame (ns)
+    std::vector<std::pair<uint32_t, double>> counters;      // id, valor no frame
+};
+
+// Codificação das mensagens (acrescenta ao fim de 'out')
+void AppendStreamSectionName(std::string& out, uint32_t section, const std::string& name);
+void AppendStreamCounterName(std::string& out, uint32_t counter, uint8_t type, const std::string& name);
+void AppendStreamFrame(std::string& out, const ProfilerStreamFrame& frame);
+
+/**
+ * @brief Servidor que transmite os frames do profiler para visualizadores locais
+ *
+ * Ligado por ProfilerConfig::streamAddress: "unix:/caminho/do/socket" ou "tcp:porta"
+ * (escuta só em 127.0.0.1). Uma thread própria aceita clientes e envia; EndFrame só
+ * enfileira bytes já codificados e, sem clientes, nem monta o frame. Cliente lento
+ * perde frames (nunca os nomes) em vez de segurar o jogo. Só em sistemas POSIX.
+ */
+class ProfilerStreamServer {
+public:
+    static ProfilerStreamServer& GetInstance();
+
+    bool Start(const std::string& address);
+    void Stop();
+    bool IsRunning() const { return m_Running.load(std::memory_order_acquire); }
+    bool HasClients() const { return m_ClientCount.load(std::memory_order_relaxed) > 0; }
+
+    // Nomes novos e o frame que os usa; os nomes são guardados para clientes futuros
+    void Publish(std::string definitions, std::string frame);
+
+    uint64_t GetDroppedFrameCount() const { return m_DroppedFrames.load(std::memory_order_relaxed); }
+
+private:
+    ProfilerStreamServer() = default;
+    ~ProfilerStreamServer();
+    ProfilerStreamServer(const ProfilerStreamServer&) = delete;
+    ProfilerStreamServer& operator=(const ProfilerStreamServer&) = delete;
+
+    void Run();
+
+    std::thread m_Thread;
+    std::atomic<bool> m_Running{false};
+    std::atomic<uint32_t> m_ClientCount{0};
+    std::atomic<uint64_t> m_DroppedFrames{0};
+    int m_ListenFd = -1;
+    int m_WakeFds[2] = {-1, -1};        // Pipe que acorda a thread quando há dados
+    std::string m_UnixPath;             // Removido no Stop()
+
+    // Fila entre EndFrame e a thread do servidor
+    std::mutex m_Mutex;
+    std::string m_PendingDefinitions;
+    std::deque<std::string> m_PendingFrames;
+};
+
+/**
+ * @brief Cliente do stream: reconstrói nomes e frames (usado pelo DriftProfilerViewer)
+ */
+class ProfilerStreamClient {
+public:
+    ProfilerStreamClient() = default;
+    ~ProfilerStreamClient();
+
+    ProfilerStreamClient(const ProfilerStreamClient&) = delete;
+    ProfilerStreamClient& operator=(const ProfilerStreamClient&) = delete;
+
+    bool Connect(const std::string& address);
+    void Close();
+    bool IsConnected() const { return m_Fd != -1; }
+
+    // Espera até timeoutMs por dados e decodifica as mensagens completas; false se a conexão caiu
+    bool Poll(int timeoutMs);
+
+    const std::vector<std::string>& GetSectionNames() const { return m_SectionNames; }
+    const std::vector<std::string>& GetCounterNames() const { return m_CounterNames; }
+    const std::vector<uint8_t>& GetCounterTypes() const { return m_CounterTypes; }
+
+    // Frames recebidos desde a última chamada
+    std::vector<ProfilerStreamFrame> TakeFrames();
+
+    const std::string& GetLastError() const { return m_LastError; }
+
+private:
+    bool Decode();
+
+    int m_Fd = -1;
+    std::string m_Buffer;
+    std::vector<std::string> m_SectionNames;
+    std::vector<std::string> m_CounterNames;
+    std::vector<uint8_t> m_CounterTypes;
+    std::vector<ProfilerStreamFrame> m_Frames;
+    std::string m_LastError;
+};
+
+} // namespace Drift::Core
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Drift/Core/Log.h"
+#include "Drift/Core/Clock.h"
+#include "Drift/Core/ProfiledMutex.h"
 #include <vector>
 #include <queue>
 #include <thread>
@@ -190,7 +192,7 @@ private:
         std::condition_variable condition;
         ThreadStats stats;
         size_t threadId;
-        bool shouldStop = false;
+        std::atomic<bool> shouldStop{false};
         std::chrono::steady_clock::time_point lastWorkTime;
     };
     
@@ -201,6 +203,7 @@ private:
     bool TryStealWork(size_t threadId);
     void SetThreadAffinity(std::thread& thread, size_t cpuId);
     void SetThreadName(std::thread& thread, const std::string& name);
+    void PublishQueueDepth();
     
     // Configuração e estado
     ThreadingConfig m_Config;
@@ -212,7 +215,7 @@ private:
     // Threads e filas
     std::vector<std::unique_ptr<ThreadData>> m_Threads;
     std::queue<Task> m_GlobalQueue;
-    std::mutex m_GlobalQueueMutex;
+    ProfiledMutex m_GlobalQueueMutex{"ThreadingSystem::GlobalQueue"};
     std::condition_variable m_GlobalCondition;
     
     // Estatísticas
@@ -263,12 +266,13 @@ auto ThreadingSystem::SubmitWithInfo(const TaskInfo& info, F&& f, Args&&... args
     
     // Adiciona à fila global
     {
-        std::lock_guard<std::mutex> lock(m_GlobalQueueMutex);
+        std::lock_guard<ProfiledMutex> lock(m_GlobalQueueMutex);
         m_GlobalQueue.push(std::move(systemTask));
         m_CurrentQueueSize++;
         m_PeakQueueSize = std::max(m_PeakQueueSize.load(), m_CurrentQueueSize.load());
         m_Stats.totalTasksSubmitted++;
     }
+    PublishQueueDepth();
     
     // Notifica uma thread
     m_GlobalCondition.notify_one();
@@ -292,11 +296,11 @@ auto ThreadingSystem::SubmitWithInfo(const TaskInfo& info, F&& f, Args&&... args
 
 // Macros para profiling
 #define DRIFT_PROFILE_THREAD_SCOPE(name) \
-    auto startTime = std::chrono::steady_clock::now(); \
-    auto endTime = startTime; \
+    uint64_t startTime = Drift::Core::Clock::NowNs(); \
+    uint64_t endTime = startTime; \
     auto profiler = [&]() { \
-        endTime = std::chrono::steady_clock::now(); \
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime); \
+        endTime = Drift::Core::Clock::NowNs(); \
+        auto duration = std::chrono::microseconds((endTime - startTime) / 1000); \
         if (Drift::Core::Threading::ThreadingSystem::GetInstance().IsProfilingEnabled()) { \
             LOG_INFO("[ThreadProfiler] {}: {}μs", std::string(name), duration.count()); \
         } \
@@ -1,15 +1,89 @@
 #include "Drift/Core/Assets/AssetsSystem.h"
+#include "Drift/Core/Profiler.h"
 #include <algorithm>
 #include <filesystem>
 #include <thread>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <iterator>
 
 namespace Drift::Core::Assets {
 
+namespace {
+
+// Menor contagem de acesso primeiro; no empate, o acesso mais antigo
+bool IsLessUsed(const AssetCacheEntry& entry, const AssetCacheEntry& other) {
+    size_t count = entry.access->accessCount.load(std::memory_order_relaxed);
+    size_t otherCount = other.access->accessCount.load(std::memory_order_relaxed);
+    return count < otherCount ||
+           (count == otherCount && entry.access->lastAccess.load(std::memory_order_relaxed) <
+                                   other.access->lastAccess.load(std::memory_order_relaxed));
+}
+
+size_t FindQualityLevel(const std::vector<AssetQualityLevel>& ladder, const std::string& variant) {
+    for (size_t i = 0; i < ladder.size(); ++i) {
+        if (ladder[i].variant == variant) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+// Cópia imutável de um shard do índice de leitura. Guarda referências fracas: o
+// índice não prolonga a vida do asset (UnloadUnusedAssets vê só o cache e quem usa)
+struct AssetsSystem::PublishedShard {
+    struct Item {
+        uint64_t id;
+        std::type_index type;
+        std::weak_ptr<IAsset> asset;
+        std::shared_ptr<AssetAccessCounters> access;
+        uint32_t slot;
+        uint32_t generation;
+    };
+    std::vector<Item> items;        // Ordenado por id
+};
+
+// Slot do handle. Estado: geração (32 bits altos) | vivo | ocupado (troca de variante) | fixações
+struct AssetsSystem::AssetSlot {
+    static constexpr uint64_t kPinMask = (1ull << 30) - 1;
+    static constexpr uint64_t kBusy = 1ull << 30;
+    static constexpr uint64_t kAlive = 1ull << 31;
+    
+    std::atomic<uint64_t> state{0};
+    std::atomic<IAsset*> asset{nullptr};
+    AssetAccessCounters* access = nullptr;      // Da entrada do cache; válido enquanto vivo
+};
+
+// Estado por thread: época de leitura ativa (0 = fora de leitura) e contadores de cache.
+// Slots nunca são liberados; ao fim da thread ficam livres para reaproveitamento.
+struct AssetsSystem::ThreadSlot {
+    std::atomic<uint64_t> epoch{0};
+    std::atomic<uint64_t> cacheHits{0};
+    std::atomic<uint64_t> cacheMisses{0};
+    std::atomic<bool> inUse{false};
+    ThreadSlot* next = nullptr;
+};
+
 AssetsSystem& AssetsSystem::GetInstance() {
     static AssetsSystem instance;
     return instance;
 }
 
+AssetsSystem::~AssetsSystem() {
+    for (auto& shard : m_PublishedShards) {
+        delete shard.exchange(nullptr);
+    }
+    for (auto& [epoch, shard] : m_RetiredShards) {
+        delete shard;
+    }
+    for (auto& chunk : m_SlotChunks) {
+        delete[] chunk.exchange(nullptr);
+    }
+}
+
 void AssetsSystem::Initialize(const AssetsConfig& config) {
     if (m_Initialized) {
         LOG_WARNING("[AssetsSystem] Sistema já inicializado");
@@ -19,11 +93,28 @@ void AssetsSystem::Initialize(const AssetsConfig& config) {
     m_Config = config;
     m_Initialized = true;
     
+    // O IO assíncrono é compartilhado; só é finalizado aqui se foi iniciado aqui
+    if (m_Config.enableAsyncIO && !IO::AsyncIO::GetInstance().IsInitialized()) {
+        m_OwnsAsyncIO = IO::AsyncIO::GetInstance().Initialize();
+    }
+    
     LOG_INFO("[AssetsSystem] Sistema inicializado");
     DRIFT_LOG_INFO("[AssetsSystem] - Max Assets: ", m_Config.maxAssets);
     DRIFT_LOG_INFO("[AssetsSystem] - Max Memory: ", m_Config.maxMemoryUsage / (1024 * 1024), " MB");
+    DRIFT_LOG_INFO("[AssetsSystem] - Memory Budgets: " << m_Config.memoryBudgets.size() << " tipos");
     DRIFT_LOG_INFO("[AssetsSystem] - Async Loading: ", m_Config.enableAsyncLoading ? "Enabled" : "Disabled");
     DRIFT_LOG_INFO("[AssetsSystem] - Preloading: ", m_Config.enablePreloading ? "Enabled" : "Disabled");
+    DRIFT_LOG_INFO("[AssetsSystem] - Async IO: " << (m_Config.enableAsyncIO ? "Enabled" : "Disabled"));
+    
+    // Reproduz o manifesto da sessão anterior antes de começar a gravar a atual
+    if (!m_Config.prefetchManifestPath.empty()) {
+        if (m_Config.replayPrefetchManifest) {
+            ReplayPrefetchManifest(m_Config.prefetchManifestPath);
+        }
+        if (m_Config.recordPrefetchManifest) {
+            StartManifestRecording();
+        }
+    }
 }
 
 void AssetsSystem::Shutdown() {
@@ -31,21 +122,47 @@ void AssetsSystem::Shutdown() {
     
     LOG_INFO("[AssetsSystem] Finalizando sistema...");
     
+    if (m_Config.recordPrefetchManifest && !m_Config.prefetchManifestPath.empty()) {
+        StopManifestRecording(m_Config.prefetchManifestPath);
+    }
+    {
+        std::lock_guard<std::mutex> manifestLock(m_ManifestMutex);
+        m_PendingReplay.clear();
+        m_ReplayPending = false;
+    }
+    
     // Aguarda todos os carregamentos terminarem
     WaitForAllLoads();
     
+    if (m_OwnsAsyncIO) {
+        IO::AsyncIO::GetInstance().Shutdown();
+        m_OwnsAsyncIO = false;
+    }
+    
     // Limpa o cache
     ClearCache();
     
     // Limpa loaders
-    m_Loaders.clear();
+    {
+        std::lock_guard<ProfiledMutex> lock(m_Mutex);
+        m_Loaders.clear();
+        m_LoaderBindings.clear();
+        m_ExtensionToType.clear();
+        m_Dependencies.clear();
+    }
+    
+    // Desmonta arquivos
+    {
+        std::lock_guard<std::mutex> archiveLock(m_ArchiveMutex);
+        m_Archives.clear();
+    }
     
     m_Initialized = false;
     LOG_INFO("[AssetsSystem] Sistema finalizado");
 }
 
 void AssetsSystem::SetConfig(const AssetsConfig& config) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     m_Config = config;
     
     // Aplica novos limites
@@ -57,383 +174,1883 @@ void AssetsSystem::SetConfig(const AssetsConfig& config) {
         }
     }
     
-    if (CalculateCurrentMemoryUsage() > m_Config.maxMemoryUsage) {
-        while (CalculateCurrentMemoryUsage() > m_Config.maxMemoryUsage) {
-            if (!EvictLeastUsedAsset()) {
-                break;
-            }
-        }
-    }
+    EnforceMemoryBudgets();
     
     LOG_INFO("[AssetsSystem] Configuração atualizada");
 }
 
-void AssetsSystem::PreloadAssets(const std::vector<std::string>& paths) {
-    if (!m_Config.enablePreloading) {
+// Estado compartilhado de um lote de pré-carregamento (grafo de dependências)
+struct AssetsSystem::PreloadBatch {
+    struct Node {
+        std::string path;
+        std::function<void(const std::string&, const std::string&, AssetPriority, std::function<void()>)> load;   // Vazio: arquivo bruto
+        std::vector<size_t> dependents;
+        std::atomic<size_t> pendingDependencies{0};
+    };
+    
+    std::vector<std::unique_ptr<Node>> nodes;
+    AssetPriority priority = AssetPriority::Low;
+};
+
+void AssetsSystem::PreloadAssets(const std::vector<std::string>& paths, AssetPriority priority) {
+    if (!m_Config.enablePreloading || paths.empty()) {
         return;
     }
     
-    DRIFT_LOG_INFO("[AssetsSystem] Pré-carregando ", paths.size(), " assets...");
-    
     for (const auto& path : paths) {
-        // Tenta determinar o tipo do asset pela extensão
-        std::filesystem::path fsPath(path);
-        std::string extension = fsPath.extension().string();
-        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
-        
-        // Por enquanto, logamos que o asset seria pré-carregado
-        DRIFT_LOG_INFO("[AssetsSystem] Asset para pré-carregamento: ", path, " (extensão: ", extension, ")");
+        RecordManifestRequest(AssetKey(path, std::type_index(typeid(void))));
     }
-}
-
-void AssetsSystem::UnloadAsset(const std::string& path, std::type_index type, const std::string& variant) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
     
-    AssetKey key(path, type, variant);
-    auto it = m_Assets.find(key);
+    auto batch = std::make_shared<PreloadBatch>();
+    batch->priority = priority;
+    std::unordered_map<std::string, size_t> indexByPath;
+    std::vector<std::vector<std::string>> dependenciesByNode;
     
-    if (it != m_Assets.end()) {
-        if (it->second.isAsyncLoading) {
-            while (it->second.status == AssetStatus::Loading) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // Resolve o loader de cada caminho e coleta o fecho transitivo das dependências
+    {
+        std::lock_guard<ProfiledMutex> lock(m_Mutex);
+        std::vector<std::string> pending(paths.begin(), paths.end());
+        
+        while (!pending.empty()) {
+            std::string path = std::move(pending.back());
+            pending.pop_back();
+            if (indexByPath.count(path)) {
+                continue;
+            }
+            
+            auto node = std::make_unique<PreloadBatch::Node>();
+            node->path = path;
+            std::vector<std::string> dependencies;
+            
+            auto typeIt = m_ExtensionToType.find(GetExtension(path));
+            if (typeIt != m_ExtensionToType.end()) {
+                const LoaderBinding& binding = m_LoaderBindings.at(typeIt->second);
+                if (binding.canLoad(path)) {
+                    node->load = binding.requestLoad;
+                    dependencies = binding.getDependencies(path);
+                }
+            }
+            
+            auto depIt = m_Dependencies.find(path);
+            if (depIt != m_Dependencies.end()) {
+                dependencies.insert(dependencies.end(), depIt->second.begin(), depIt->second.end());
+            }
+            
+            for (const auto& dependency : dependencies) {
+                pending.push_back(dependency);
             }
+            
+            indexByPath.emplace(path, batch->nodes.size());
+            batch->nodes.push_back(std::move(node));
+            dependenciesByNode.push_back(std::move(dependencies));
         }
-        
-        it->second.asset->Unload();
-        m_Assets.erase(it);
-        m_UnloadCount++;
-        
-        TriggerAssetUnloadedCallback(path, type);
-        DRIFT_LOG_INFO("[AssetsSystem] Asset descarregado: ", path);
     }
-}
-
-void AssetsSystem::UnloadAssets(std::type_index type) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
     
-    auto it = m_Assets.begin();
-    size_t unloadedCount = 0;
+    // Monta as arestas dependência -> dependente
+    const size_t nodeCount = batch->nodes.size();
+    std::vector<size_t> inDegree(nodeCount, 0);
+    for (size_t i = 0; i < nodeCount; ++i) {
+        auto& deps = dependenciesByNode[i];
+        std::sort(deps.begin(), deps.end());
+        deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+        for (const auto& dependency : deps) {
+            size_t depIndex = indexByPath.at(dependency);
+            if (depIndex == i) {
+                continue;
+            }
+            batch->nodes[depIndex]->dependents.push_back(i);
+            inDegree[i]++;
+        }
+    }
     
-    while (it != m_Assets.end()) {
-        if (it->first.type == type) {
-            if (it->second.isAsyncLoading) {
-                while (it->second.status == AssetStatus::Loading) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // Ordenação topológica (Kahn) apenas para detectar ciclos antes de despachar
+    std::vector<size_t> remaining = inDegree;
+    std::vector<size_t> order;
+    order.reserve(nodeCount);
+    for (size_t i = 0; i < nodeCount; ++i) {
+        if (remaining[i] == 0) {
+            order.push_back(i);
+        }
+    }
+    size_t head = 0;
+    while (order.size() != nodeCount) {
+        for (; head < order.size(); ++head) {
+            for (size_t dependent : batch->nodes[order[head]]->dependents) {
+                if (--remaining[dependent] == 0) {
+                    order.push_back(dependent);
                 }
             }
-            
-            it->second.asset->Unload();
-            TriggerAssetUnloadedCallback(it->first.path, type);
-            it = m_Assets.erase(it);
-            unloadedCount++;
-            m_UnloadCount++;
-        } else {
-            ++it;
+        }
+        if (order.size() == nodeCount) {
+            break;
+        }
+        
+        // Kahn travou: busca em profundidade entre os nós pendentes até a aresta que fecha um ciclo
+        // e remove só ela; o restante do grafo segue a ordem topológica normal
+        std::vector<uint8_t> state(nodeCount, 0); // 0 = não visitado, 1 = na pilha, 2 = concluído
+        std::vector<std::pair<size_t, size_t>> stack;
+        size_t from = nodeCount;
+        size_t edge = 0;
+        for (size_t start = 0; start < nodeCount && from == nodeCount; ++start) {
+            if (remaining[start] == 0 || state[start] != 0) {
+                continue;
+            }
+            state[start] = 1;
+            stack.emplace_back(start, 0);
+            while (!stack.empty() && from == nodeCount) {
+                auto& [node, next] = stack.back();
+                const auto& dependents = batch->nodes[node]->dependents;
+                if (next == dependents.size()) {
+                    state[node] = 2;
+                    stack.pop_back();
+                    continue;
+                }
+                size_t dependent = dependents[next++];
+                if (remaining[dependent] == 0) {
+                    continue;
+                }
+                if (state[dependent] == 1) {
+                    from = node;
+                    edge = next - 1;
+                } else if (state[dependent] == 0) {
+                    state[dependent] = 1;
+                    stack.emplace_back(dependent, 0);
+                }
+            }
+            stack.clear();
+        }
+        
+        auto& dependents = batch->nodes[from]->dependents;
+        size_t to = dependents[edge];
+        DRIFT_LOG_WARNING("[AssetsSystem] Dependência circular no pré-carregamento: " << batch->nodes[to]->path
+                          << " -> " << batch->nodes[from]->path);
+        dependents.erase(dependents.begin() + static_cast<std::ptrdiff_t>(edge));
+        inDegree[to]--;
+        if (--remaining[to] == 0) {
+            order.push_back(to);
         }
     }
     
-    DRIFT_LOG_INFO("[AssetsSystem] ", unloadedCount, " assets do tipo descarregados");
-}
-
-void AssetsSystem::UnloadUnusedAssets() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (size_t i = 0; i < nodeCount; ++i) {
+        batch->nodes[i]->pendingDependencies.store(inDegree[i], std::memory_order_relaxed);
+    }
     
-    auto it = m_Assets.begin();
-    size_t unloadedCount = 0;
+    DRIFT_LOG_INFO("[AssetsSystem] Pré-carregando " << paths.size() << " assets (" << nodeCount << " com dependências)");
     
-    while (it != m_Assets.end()) {
-        // Asset é considerado não usado se só tem 1 referência (a do cache)
-        if (it->second.asset.use_count() == 1) {
-            if (it->second.isAsyncLoading) {
-                while (it->second.status == AssetStatus::Loading) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                }
-            }
-            
-            it->second.asset->Unload();
-            TriggerAssetUnloadedCallback(it->first.path, it->first.type);
-            it = m_Assets.erase(it);
-            unloadedCount++;
-            m_UnloadCount++;
-        } else {
-            ++it;
+    m_PendingPreloads.fetch_add(nodeCount);
+    
+    for (size_t i = 0; i < nodeCount; ++i) {
+        if (inDegree[i] == 0) {
+            DispatchPreload(batch, i);
         }
     }
-    
-    DRIFT_LOG_INFO("[AssetsSystem] ", unloadedCount, " assets não utilizados descarregados");
 }
 
-void AssetsSystem::ClearCache() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+void AssetsSystem::DispatchPreload(const std::shared_ptr<PreloadBatch>& batch, size_t index) {
+    PreloadBatch::Node& node = *batch->nodes[index];
+    auto onDone = [this, batch, index]() { CompletePreload(batch, index); };
     
-    size_t totalAssets = m_Assets.size();
+    if (node.load) {
+        // Passa pela fila de carregamento: pedidos de maior prioridade passam na frente
+        node.load(node.path, std::string(), batch->priority, onDone);
+        return;
+    }
     
-    for (auto& [key, entry] : m_Assets) {
-        if (entry.isAsyncLoading) {
-            while (entry.status == AssetStatus::Loading) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // Arquivo bruto: apenas pré-busca
+    Drift::Core::Threading::TaskInfo info;
+    info.name = "PrefetchFile_" + node.path;
+    info.priority = static_cast<Drift::Core::Threading::TaskPriority>(batch->priority);
+    Drift::Core::Threading::ThreadingSystem::GetInstance().SubmitWithInfo(info, [this, path = node.path, onDone]() {
+        PrefetchFile(path);
+        onDone();
+    });
+}
+
+void AssetsSystem::CompletePreload(const std::shared_ptr<PreloadBatch>& batch, size_t index) {
+    // Libera os dependentes cujas dependências acabaram
+    for (size_t dependent : batch->nodes[index]->dependents) {
+        if (batch->nodes[dependent]->pendingDependencies.fetch_sub(1) == 1) {
+            DispatchPreload(batch, dependent);
+        }
+    }
+    m_PendingPreloads.fetch_sub(1);
+}
+
+void AssetsSystem::EnqueueLoad(const AssetKey& key, AssetPriority priority, std::function<void(const IO::FileView&)> execute,
+                               LoadCompletion completion) {
+    {
+        std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+        
+        auto it = m_LoadRequests.find(key);
+        if (it != m_LoadRequests.end()) {
+            // Pedido já existente: apenas aguarda o resultado, subindo a prioridade se preciso
+            LoadRequest& request = it->second;
+            if (completion) {
+                request.completions.push_back(std::move(completion));
+            }
+            if (!request.inFlight && priority > request.priority) {
+                m_LoadQueue.erase({-static_cast<int>(request.priority), request.sequence});
+                request.priority = priority;
+                m_LoadQueue.emplace(LoadQueueOrder{-static_cast<int>(priority), request.sequence}, key);
             }
+            return;
         }
         
-        entry.asset->Unload();
-        TriggerAssetUnloadedCallback(key.path, key.type);
+        LoadRequest request{key, priority, m_LoadSequence++, std::move(execute), {}, false};
+        if (completion) {
+            request.completions.push_back(std::move(completion));
+        }
+        
+        m_LoadQueue.emplace(LoadQueueOrder{-static_cast<int>(priority), request.sequence}, key);
+        m_LoadRequests.emplace(key, std::move(request));
     }
     
-    m_Assets.clear();
-    m_UnloadCount += totalAssets;
-    
-    DRIFT_LOG_INFO("[AssetsSystem] Cache limpo - ", totalAssets, " assets descarregados");
+    PumpLoadQueue();
 }
 
-void AssetsSystem::TrimCache() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+void AssetsSystem::PumpLoadQueue() {
+    std::vector<std::pair<AssetKey, AssetPriority>> toStart;
     
-    size_t currentMemory = CalculateCurrentMemoryUsage();
-    size_t targetMemory = static_cast<size_t>(m_Config.maxMemoryUsage * m_Config.trimThreshold);
+    {
+        std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+        const size_t maxInFlight = std::max<size_t>(1, m_Config.maxConcurrentLoads);
+        
+        while (m_InFlightLoads < maxInFlight && !m_LoadQueue.empty()) {
+            auto next = m_LoadQueue.begin();
+            LoadRequest& request = m_LoadRequests.at(next->second);
+            request.inFlight = true;
+            m_InFlightLoads++;
+            toStart.emplace_back(next->second, request.priority);
+            m_LoadQueue.erase(next);
+        }
+    }
     
-    if (currentMemory <= targetMemory) {
-        return; // Não precisa fazer trim
+    if (toStart.empty()) {
+        return;
     }
     
-    size_t initialCount = m_Assets.size();
+    // Arquivos soltos são lidos pelo IO assíncrono em um único lote (ordenado por arquivo/offset);
+    // a tarefa de CPU só é submetida quando os bytes chegam, então nenhum worker bloqueia em read()
+    auto& asyncIO = IO::AsyncIO::GetInstance();
+    std::vector<IO::AsyncReadRequest> reads;
     
-    // Remove assets menos usados até atingir o threshold
-    while (currentMemory > targetMemory && !m_Assets.empty()) {
-        if (!EvictLeastUsedAsset()) {
-            break;
+    for (auto& [key, priority] : toStart) {
+        if (m_Config.enableAsyncIO && asyncIO.IsInitialized() && !IsInMountedArchive(key.path)) {
+            IO::AsyncReadRequest read;
+            read.path = key.path;
+            read.callback = [this, key = key, priority = priority](IO::AsyncReadResult&& result) {
+                // Falha de leitura (ex.: caminho sintético) cai no carregamento tradicional
+                SubmitLoadTask(key, priority, result.Succeeded() ? std::move(result.data) : IO::FileView{});
+            };
+            reads.push_back(std::move(read));
+        } else {
+            SubmitLoadTask(key, priority, {});
         }
-        currentMemory = CalculateCurrentMemoryUsage();
     }
     
-    size_t removedCount = initialCount - m_Assets.size();
-    DRIFT_LOG_INFO("[AssetsSystem] Cache trimmed - ", removedCount, " assets removidos");
+    if (!reads.empty() && !asyncIO.SubmitReads(reads)) {
+        for (auto& read : reads) {
+            read.callback(IO::AsyncReadResult{read.path, 0, {}, ECANCELED});
+        }
+    }
 }
 
-AssetsStats AssetsSystem::GetStats() const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+void AssetsSystem::SubmitLoadTask(const AssetKey& key, AssetPriority priority, IO::FileView data) {
+    Drift::Core::Threading::TaskInfo info;
+    info.name = "LoadAsset_" + key.path;
+    info.priority = static_cast<Drift::Core::Threading::TaskPriority>(priority);
+    Drift::Core::Threading::ThreadingSystem::GetInstance().SubmitWithInfo(info, [this, key, data = std::move(data)]() {
+        RunQueuedLoad(key, data);
+    });
+}
+
+void AssetsSystem::RunQueuedLoad(const AssetKey& key, const IO::FileView& data) {
+    std::function<void(const IO::FileView&)> execute;
+    {
+        std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+        execute = std::move(m_LoadRequests.at(key).execute);
+    }
     
-    AssetsStats stats;
-    stats.totalAssets = m_Assets.size();
-    stats.memoryUsage = CalculateCurrentMemoryUsage();
-    stats.maxMemoryUsage = m_Config.maxMemoryUsage;
-    stats.cacheHits = m_CacheHits;
-    stats.cacheMisses = m_CacheMisses;
-    stats.loadCount = m_LoadCount;
-    stats.unloadCount = m_UnloadCount;
-    stats.asyncLoadCount = m_AsyncLoadCount;
-    stats.averageLoadTime = m_LoadCount > 0 ? m_TotalLoadTime / m_LoadCount : 0.0;
+    execute(data);
     
-    // Calcula estatísticas por tipo e status
-    for (const auto& [key, entry] : m_Assets) {
-        stats.assetsByType[key.type]++;
-        stats.memoryByType[key.type] += entry.memoryUsage;
-        stats.loadCountByType[key.type]++;
-        
-        switch (entry.status) {
-            case AssetStatus::Loaded:
-                stats.loadedAssets++;
-                break;
-            case AssetStatus::Loading:
-                stats.loadingAssets++;
-                break;
-            case AssetStatus::Failed:
-                stats.failedAssets++;
-                break;
-            default:
-                break;
-        }
+    std::vector<LoadCompletion> completions;
+    {
+        std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+        auto it = m_LoadRequests.find(key);
+        completions = std::move(it->second.completions);
+        m_LoadRequests.erase(it);
+        m_InFlightLoads--;
     }
     
-    return stats;
+    for (auto& completion : completions) {
+        completion();
+    }
+    
+    // Cada conclusão avança a reprodução do manifesto (tempos vencidos ou fila ociosa)
+    if (m_ReplayPending.load(std::memory_order_relaxed)) {
+        DispatchPendingReplay();
+    }
+    PumpLoadQueue();
 }
 
-void AssetsSystem::LogStats() const {
-    auto stats = GetStats();
-    
-    LOG_INFO("[AssetsSystem] === Estatísticas do Sistema ===");
-    DRIFT_LOG_INFO("[AssetsSystem] Total de Assets: ", stats.totalAssets);
-    DRIFT_LOG_INFO("[AssetsSystem] Assets Carregados: ", stats.loadedAssets);
-    DRIFT_LOG_INFO("[AssetsSystem] Assets Carregando: ", stats.loadingAssets);
-    DRIFT_LOG_INFO("[AssetsSystem] Assets Falharam: ", stats.failedAssets);
-    DRIFT_LOG_INFO("[AssetsSystem] Uso de Memória: ", stats.memoryUsage / (1024 * 1024), " MB / ", stats.maxMemoryUsage / (1024 * 1024), " MB");
-    DRIFT_LOG_INFO("[AssetsSystem] Cache Hits: ", stats.cacheHits);
-    DRIFT_LOG_INFO("[AssetsSystem] Cache Misses: ", stats.cacheMisses);
-    DRIFT_LOG_INFO("[AssetsSystem] Carregamentos: ", stats.loadCount);
-    DRIFT_LOG_INFO("[AssetsSystem] Carregamentos Assíncronos: ", stats.asyncLoadCount);
-    DRIFT_LOG_INFO("[AssetsSystem] Descarregamentos: ", stats.unloadCount);
-    DRIFT_LOG_INFO("[AssetsSystem] Tempo Médio de Carregamento: ", std::fixed, std::setprecision(2), stats.averageLoadTime * 1000.0, " ms");
-    
-    if (!stats.assetsByType.empty()) {
-        LOG_INFO("[AssetsSystem] === Assets por Tipo ===");
-        for (const auto& [type, count] : stats.assetsByType) {
-            size_t memory = stats.memoryByType.at(type);
-            size_t loads = stats.loadCountByType.at(type);
-            DRIFT_LOG_INFO("[AssetsSystem] ", std::string(type.name()), ": ", count, " assets, ", memory / (1024 * 1024), " MB, ", loads, " carregamentos");
+void AssetsSystem::FinishCancelledLoads(std::vector<LoadRequest>& cancelled) {
+    {
+        std::lock_guard<ProfiledMutex> lock(m_Mutex);
+        for (const auto& request : cancelled) {
+            auto it = m_Assets.find(request.key);
+            if (it != m_Assets.end() && it->second.status == AssetStatus::Loading) {
+                it->second.status = AssetStatus::Failed;
+                it->second.isAsyncLoading = false;
+                it->second.errorMessage = "Carregamento cancelado";
+            }
         }
     }
     
-    DRIFT_LOG_INFO("[AssetsSystem] ================================");
+    // Quem aguardava (futures, pré-carregamento) é liberado com falha
+    for (auto& request : cancelled) {
+        for (auto& completion : request.completions) {
+            completion();
+        }
+    }
 }
 
-void AssetsSystem::ResetStats() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    m_CacheHits = 0;
-    m_CacheMisses = 0;
-    m_LoadCount = 0;
-    m_UnloadCount = 0;
-    m_AsyncLoadCount = 0;
-    m_TotalLoadTime = 0.0;
-    LOG_INFO("[AssetsSystem] Estatísticas resetadas");
+bool AssetsSystem::SetLoadPriority(const std::string& path, std::type_index type, AssetPriority priority, const std::string& variant) {
+    return SetLoadPriority(AssetId::FromPath(path, variant), type, priority);
 }
 
-bool AssetsSystem::IsAssetLoaded(const std::string& path, std::type_index type, const std::string& variant) const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
-    AssetKey key(path, type, variant);
-    auto it = m_Assets.find(key);
+bool AssetsSystem::SetLoadPriority(AssetId id, std::type_index type, AssetPriority priority) {
+    const AssetKey key(id, type);
+    {
+        std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+        auto it = m_LoadRequests.find(key);
+        if (it == m_LoadRequests.end() || it->second.inFlight) {
+            return false;
+        }
+        
+        LoadRequest& request = it->second;
+        if (request.priority != priority) {
+            m_LoadQueue.erase({-static_cast<int>(request.priority), request.sequence});
+            request.priority = priority;
+            m_LoadQueue.emplace(LoadQueueOrder{-static_cast<int>(priority), request.sequence}, request.key);
+        }
+    }
     
-    return it != m_Assets.end() && it->second.status == AssetStatus::Loaded;
+    {
+        std::lock_guard<ProfiledMutex> lock(m_Mutex);
+        auto it = m_Assets.find(key);
+        if (it != m_Assets.end()) {
+            it->second.priority = priority;
+        }
+    }
+    return true;
 }
 
-bool AssetsSystem::IsAssetLoading(const std::string& path, std::type_index type, const std::string& variant) const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
-    AssetKey key(path, type, variant);
-    auto it = m_Assets.find(key);
-    
-    return it != m_Assets.end() && it->second.status == AssetStatus::Loading;
+bool AssetsSystem::CancelLoad(const std::string& path, std::type_index type, const std::string& variant) {
+    return CancelLoad(AssetId::FromPath(path, variant), type);
 }
 
-AssetStatus AssetsSystem::GetAssetStatus(const std::string& path, std::type_index type, const std::string& variant) const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
-    AssetKey key(path, type, variant);
-    auto it = m_Assets.find(key);
-    
-    if (it != m_Assets.end()) {
-        return it->second.status;
+bool AssetsSystem::CancelLoad(AssetId id, std::type_index type) {
+    std::vector<LoadRequest> cancelled;
+    {
+        std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+        auto it = m_LoadRequests.find(AssetKey(id, type));
+        if (it == m_LoadRequests.end() || it->second.inFlight) {
+            return false;
+        }
+        
+        m_LoadQueue.erase({-static_cast<int>(it->second.priority), it->second.sequence});
+        cancelled.push_back(std::move(it->second));
+        m_LoadRequests.erase(it);
     }
     
-    return AssetStatus::NotLoaded;
+    FinishCancelledLoads(cancelled);
+    DRIFT_LOG_INFO("[AssetsSystem] Carregamento cancelado: " << cancelled.front().key.path);
+    return true;
 }
 
-bool AssetsSystem::CanLoadAsset(const std::string& path, std::type_index type) const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
-    auto it = m_Loaders.find(type);
-    if (it == m_Loaders.end()) {
-        return false;
+std::string AssetsSystem::GetExtension(const std::string& path) {
+    std::string extension = std::filesystem::path(path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension;
+}
+
+void AssetsSystem::RegisterExtensions(std::type_index type, const std::vector<std::string>& extensions) {
+    for (auto extension : extensions) {
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (!extension.empty() && extension[0] != '.') {
+            extension.insert(extension.begin(), '.');
+        }
+        
+        auto [it, inserted] = m_ExtensionToType.emplace(extension, type);
+        if (!inserted && it->second != type) {
+            DRIFT_LOG_WARNING("[AssetsSystem] Extensão já associada a outro loader, substituindo: " << extension);
+            it->second = type;
+        }
     }
-    
-    // Por enquanto, assume que pode carregar
-    // Em uma implementação completa, seria necessário acessar o loader
-    return true;
 }
 
-std::vector<std::string> AssetsSystem::GetSupportedExtensions(std::type_index type) const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
-    auto it = m_Loaders.find(type);
-    if (it == m_Loaders.end()) {
-        return {};
+void AssetsSystem::UnregisterExtensions(std::type_index type) {
+    for (auto it = m_ExtensionToType.begin(); it != m_ExtensionToType.end();) {
+        if (it->second == type) {
+            it = m_ExtensionToType.erase(it);
+        } else {
+            ++it;
+        }
     }
-    
-    // Por enquanto, retorna vazio
-    // Em uma implementação completa, seria necessário acessar o loader
-    return {};
 }
 
-void AssetsSystem::WaitForAllLoads() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
-    for (auto& [key, entry] : m_Assets) {
-        if (entry.isAsyncLoading) {
-            while (entry.status == AssetStatus::Loading) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+void AssetsSystem::PrefetchFile(const std::string& path) const {
+    {
+        std::lock_guard<std::mutex> lock(m_ArchiveMutex);
+        std::string normalized = IO::NormalizeArchivePath(path);
+        for (auto it = m_Archives.rbegin(); it != m_Archives.rend(); ++it) {
+            const auto& mountPoint = it->mountPoint;
+            if (normalized.compare(0, mountPoint.size(), mountPoint) != 0) {
+                continue;
+            }
+            
+            std::string_view relative = std::string_view(normalized).substr(mountPoint.size());
+            if (it->archive->Exists(relative)) {
+                it->archive->Prefetch(relative);
+                return;
             }
         }
     }
     
-    DRIFT_LOG_INFO("[AssetsSystem] Aguardou todos os carregamentos");
+    // Arquivo solto: leitura antecipada para o page cache, sem manter mapeamento
+    IO::PrefetchFileContents(path);
 }
 
-void AssetsSystem::CancelAllLoads() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+void AssetsSystem::StartManifestRecording() {
+    std::lock_guard<std::mutex> lock(m_ManifestMutex);
+    m_ManifestEntries.clear();
+    m_ManifestSeen.clear();
+    m_ManifestStart = std::chrono::steady_clock::now();
+    m_RecordingManifest = true;
+    DRIFT_LOG_INFO("[AssetsSystem] Gravando manifesto de pré-busca (" << m_Config.prefetchManifestWindow << "s)");
+}
+
+bool AssetsSystem::StopManifestRecording(const std::string& path) {
+    std::vector<PrefetchManifestEntry> entries;
+    {
+        std::lock_guard<std::mutex> lock(m_ManifestMutex);
+        m_RecordingManifest = false;
+        entries.swap(m_ManifestEntries);
+        m_ManifestSeen.clear();
+    }
     
-    size_t cancelledCount = 0;
-    for (auto& [key, entry] : m_Assets) {
-        if (entry.status == AssetStatus::Loading) {
-            entry.status = AssetStatus::Failed;
-            entry.errorMessage = "Carregamento cancelado";
-            cancelledCount++;
-        }
+    // Sessão sem pedidos não substitui um manifesto útil
+    if (entries.empty()) {
+        return false;
     }
     
-    DRIFT_LOG_INFO("[AssetsSystem] Cancelou ", cancelledCount, " carregamentos");
+    if (!PrefetchManifest::Save(path, entries)) {
+        return false;
+    }
+    DRIFT_LOG_INFO("[AssetsSystem] Manifesto de pré-busca salvo: " << path << " (" << entries.size() << " pedidos)");
+    return true;
+}
+
+void AssetsSystem::RecordManifestRequest(const AssetKey& key) {
+    if (!m_RecordingManifest.load(std::memory_order_relaxed)) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_ManifestMutex);
+    if (!m_RecordingManifest.load(std::memory_order_relaxed)) {
+        return;
+    }
+    
+    auto elapsed = std::chrono::steady_clock::now() - m_ManifestStart;
+    if (std::chrono::duration<float>(elapsed).count() > m_Config.prefetchManifestWindow) {
+        // Fim da janela de inicialização: o restante da sessão não é gravado
+        m_RecordingManifest = false;
+        return;
+    }
+    
+    // Só o primeiro pedido de cada asset importa para a ordem
+    if (!m_ManifestSeen.insert(key.id.value).second) {
+        return;
+    }
+    
+    PrefetchManifestEntry entry;
+    entry.path = key.path;
+    entry.variant = key.variant;
+    entry.timeMs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    m_ManifestEntries.push_back(std::move(entry));
+}
+
+bool AssetsSystem::ReplayPrefetchManifest(const std::string& path) {
+    std::vector<PrefetchManifestEntry> entries;
+    if (!PrefetchManifest::Load(path, entries) || entries.empty()) {
+        DRIFT_LOG_INFO("[AssetsSystem] Nenhum manifesto de pré-busca em: " << path);
+        return false;
+    }
+    
+    DRIFT_LOG_INFO("[AssetsSystem] Reproduzindo manifesto de pré-busca: " << entries.size() << " pedidos");
+    
+    // Ordem dos tempos gravados (o arquivo já vem assim; manifestos editados ou mesclados não)
+    std::stable_sort(entries.begin(), entries.end(),
+        [](const PrefetchManifestEntry& a, const PrefetchManifestEntry& b) { return a.timeMs < b.timeMs; });
+    
+    // Leitura antecipada no SO (fadvise WillNeed / Prefetch do .dpak) na ordem gravada, sem
+    // esperar os loaders: só ocupa page cache, então não precisa respeitar os tempos
+    std::vector<std::string> files;
+    files.reserve(entries.size());
+    for (const auto& entry : entries) {
+        files.push_back(entry.path);
+    }
+    Drift::Core::Threading::TaskInfo info;
+    info.name = "PrefetchManifest";
+    info.priority = Drift::Core::Threading::TaskPriority::Low;
+    Drift::Core::Threading::ThreadingSystem::GetInstance().SubmitWithInfo(info, [this, files = std::move(files)]() {
+        for (const auto& file : files) {
+            PrefetchFile(file);
+        }
+    });
+    
+    // Carregamentos de baixa prioridade, despachados quando o loader da extensão existir e o
+    // tempo gravado estiver a menos de prefetchManifestLeadMs; pedidos de demanda com prioridade
+    // maior passam na frente na fila
+    {
+        std::lock_guard<std::mutex> lock(m_ManifestMutex);
+        m_PendingReplay.insert(m_PendingReplay.end(), std::make_move_iterator(entries.begin()),
+                               std::make_move_iterator(entries.end()));
+        m_ReplayStart = std::chrono::steady_clock::now();
+        m_ReplayPending = true;
+    }
+    DispatchPendingReplay();
+    return true;
+}
+
+void AssetsSystem::DispatchPendingReplay() {
+    using RequestLoad = std::function<void(const std::string&, const std::string&, AssetPriority, std::function<void()>)>;
+    std::vector<std::pair<RequestLoad, PrefetchManifestEntry>> ready;
+    
+    // Fila ociosa: o próximo pedido do manifesto sai mesmo antes do seu tempo
+    bool loadQueueIdle = false;
+    {
+        std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+        loadQueueIdle = m_InFlightLoads == 0 && m_LoadQueue.empty();
+    }
+    
+    {
+        std::lock_guard<ProfiledMutex> lock(m_Mutex);
+        std::lock_guard<std::mutex> manifestLock(m_ManifestMutex);
+        if (m_PendingReplay.empty()) {
+            m_ReplayPending = false;
+            return;
+        }
+        
+        // Os tempos gravados ditam o ritmo: cada pedido entra na fila prefetchManifestLeadMs antes
+        // do momento em que foi pedido na sessão gravada, sem disputar a fila com a demanda atual
+        const auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - m_ReplayStart).count();
+        const int64_t dueMs = elapsedMs + static_cast<int64_t>(m_Config.prefetchManifestLeadMs);
+        
+        std::vector<PrefetchManifestEntry> stillPending;
+        for (auto& entry : m_PendingReplay) {
+            auto typeIt = m_ExtensionToType.find(GetExtension(entry.path));
+            const bool due = static_cast<int64_t>(entry.timeMs) <= dueMs || (loadQueueIdle && ready.empty());
+            if (typeIt == m_ExtensionToType.end() || !due) {
+                stillPending.push_back(std::move(entry));
+                continue;
+            }
+            // Extensão conhecida mas recusada pelo loader: descarta
+            const LoaderBinding& binding = m_LoaderBindings.at(typeIt->second);
+            if (binding.canLoad(entry.path)) {
+                ready.emplace_back(binding.requestLoad, std::move(entry));
+            }
+        }
+        m_PendingReplay.swap(stillPending);
+        m_ReplayPending = !m_PendingReplay.empty();
+    }
+    
+    // Fora dos locks: o pedido entra na fila (mesma prioridade = ordem do manifesto)
+    for (auto& [requestLoad, entry] : ready) {
+        requestLoad(entry.path, entry.variant, AssetPriority::Low, {});
+    }
+}
+
+void AssetsSystem::AddDependency(const std::string& path, const std::string& dependency) {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    auto& dependencies = m_Dependencies[path];
+    if (std::find(dependencies.begin(), dependencies.end(), dependency) == dependencies.end()) {
+        dependencies.push_back(dependency);
+    }
+}
+
+void AssetsSystem::ClearDependencies(const std::string& path) {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    m_Dependencies.erase(path);
+}
+
+std::vector<std::string> AssetsSystem::GetDependencies(const std::string& path) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    std::vector<std::string> dependencies;
+    auto typeIt = m_ExtensionToType.find(GetExtension(path));
+    if (typeIt != m_ExtensionToType.end()) {
+        dependencies = m_LoaderBindings.at(typeIt->second).getDependencies(path);
+    }
+    
+    auto it = m_Dependencies.find(path);
+    if (it != m_Dependencies.end()) {
+        dependencies.insert(dependencies.end(), it->second.begin(), it->second.end());
+    }
+    return dependencies;
+}
+
+bool AssetsSystem::MountArchive(const std::string& archivePath, const std::string& mountPoint) {
+    auto archive = IO::ArchiveFileSystem::Open(archivePath);
+    if (!archive) {
+        DRIFT_LOG_ERROR("[AssetsSystem] Falha ao montar arquivo: " << archivePath);
+        return false;
+    }
+    
+    std::string normalizedMount = IO::NormalizeArchivePath(mountPoint);
+    if (!normalizedMount.empty() && normalizedMount.back() != '/') {
+        normalizedMount += '/';
+    }
+    
+    std::lock_guard<std::mutex> lock(m_ArchiveMutex);
+    m_Archives.push_back({normalizedMount, archive});
+    
+    DRIFT_LOG_INFO("[AssetsSystem] Arquivo montado: " << archivePath << " (" << archive->GetEntryCount() << " entradas)");
+    return true;
+}
+
+bool AssetsSystem::UnmountArchive(const std::string& archivePath) {
+    std::lock_guard<std::mutex> lock(m_ArchiveMutex);
+    
+    auto it = std::find_if(m_Archives.begin(), m_Archives.end(),
+        [&](const MountedArchive& mounted) { return mounted.archive->GetArchivePath() == archivePath; });
+    if (it == m_Archives.end()) {
+        return false;
+    }
+    
+    // Assets já carregados mantêm o mapeamento vivo através de seus FileViews
+    m_Archives.erase(it);
+    DRIFT_LOG_INFO("[AssetsSystem] Arquivo desmontado: " << archivePath);
+    return true;
+}
+
+std::vector<std::string> AssetsSystem::GetMountedArchives() const {
+    std::lock_guard<std::mutex> lock(m_ArchiveMutex);
+    
+    std::vector<std::string> paths;
+    paths.reserve(m_Archives.size());
+    for (const auto& mounted : m_Archives) {
+        paths.push_back(mounted.archive->GetArchivePath());
+    }
+    return paths;
+}
+
+bool AssetsSystem::IsInMountedArchive(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(m_ArchiveMutex);
+    if (m_Archives.empty()) {
+        return false;
+    }
+    
+    std::string normalized = IO::NormalizeArchivePath(path);
+    for (const auto& mounted : m_Archives) {
+        const auto& mountPoint = mounted.mountPoint;
+        if (normalized.compare(0, mountPoint.size(), mountPoint) == 0 &&
+            mounted.archive->Exists(std::string_view(normalized).substr(mountPoint.size()))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+IO::FileView AssetsSystem::OpenPayload(const std::string& path) const {
+    // Arquivos montados têm precedência sobre arquivos soltos
+    IO::FileView archived = ReadFromArchives(path);
+    if (archived.IsValid()) {
+        return archived;
+    }
+    
+    // Mapeia o arquivo quando existir em disco; vazio para paths sintéticos
+    if (m_Config.enableMemoryMappedIO) {
+        if (auto file = IO::MappedFile::Open(path, IO::MapAccessHint::Sequential)) {
+            return file->GetView();
+        }
+    }
+    return {};
+}
+
+uint64_t AssetsSystem::HashPayload(const IO::FileView& view) const {
+    if (!m_Config.enableContentDedup || view.Empty()) {
+        return 0;
+    }
+    return Hash64(view.data, view.size);
+}
+
+uint64_t AssetsSystem::DedupPayload(IO::FileView& view, uint64_t hash) {
+    if (hash == 0) {
+        return 0;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_PayloadMutex);
+    auto it = m_SharedPayloads.find(hash);
+    if (it != m_SharedPayloads.end() && it->second.size == view.size) {
+        if (auto owner = it->second.owner.lock()) {
+            // Mesmo conteúdo já vivo: o loader recebe (e retém) o buffer existente
+            if (owner != view.owner) {
+                view = IO::FileView(it->second.data, it->second.size, std::move(owner), it->second.mapping);
+                m_DedupPayloadHits.fetch_add(1, std::memory_order_relaxed);
+                m_DedupPayloadBytes.fetch_add(view.size, std::memory_order_relaxed);
+            }
+            return hash;
+        }
+    }
+    
+    // Só buffers com dono podem ser compartilhados
+    if (view.IsOwned()) {
+        m_SharedPayloads[hash] = SharedPayload{view.owner, view.data, view.size, view.mapping};
+        
+        // Remove de tempos em tempos os payloads que ninguém mais retém
+        if (m_SharedPayloads.size() >= m_PayloadPruneThreshold) {
+            for (auto payloadIt = m_SharedPayloads.begin(); payloadIt != m_SharedPayloads.end();) {
+                payloadIt = payloadIt->second.owner.expired() ? m_SharedPayloads.erase(payloadIt) : std::next(payloadIt);
+            }
+            m_PayloadPruneThreshold = std::max<size_t>(64, m_SharedPayloads.size() * 2);
+        }
+    }
+    return hash;
+}
+
+std::shared_ptr<IAsset> AssetsSystem::FindSharedAsset(std::type_index type, uint64_t contentHash) const {
+    if (contentHash == 0) {
+        return nullptr;
+    }
+    auto it = m_SharedAssets.find(HashCombine64(contentHash, type.hash_code()));
+    if (it == m_SharedAssets.end() || it->second.owners.empty()) {
+        return nullptr;
+    }
+    return it->second.asset.lock();
+}
+
+void AssetsSystem::AttachSharedAsset(const AssetKey& key, AssetCacheEntry& entry, uint64_t contentHash) {
+    if (contentHash == 0 || !entry.asset) {
+        return;
+    }
+    
+    const uint64_t recordKey = HashCombine64(contentHash, key.type.hash_code());
+    SharedAssetRecord& record = m_SharedAssets[recordKey];
+    std::shared_ptr<IAsset> existing = record.asset.lock();
+    if (!record.owners.empty() && existing) {
+        // Outro carregamento do mesmo conteúdo terminou antes: descarta esta cópia
+        entry.asset = existing;
+        SetEntryMemory(key.type, entry, 0);
+    } else {
+        record.owners.clear();
+        record.asset = entry.asset;
+        record.memory = entry.memoryUsage;
+    }
+    record.owners.push_back(key);
+    entry.contentHash = recordKey;
+}
+
+void AssetsSystem::DetachSharedAsset(const AssetKey& key, AssetCacheEntry& entry) {
+    if (entry.contentHash == 0) {
+        return;
+    }
+    
+    auto recordIt = m_SharedAssets.find(entry.contentHash);
+    entry.contentHash = 0;
+    if (recordIt == m_SharedAssets.end()) {
+        return;
+    }
+    
+    auto& owners = recordIt->second.owners;
+    auto ownerIt = std::find(owners.begin(), owners.end(), key);
+    if (ownerIt == owners.end()) {
+        return;
+    }
+    const bool charged = ownerIt == owners.begin();
+    owners.erase(ownerIt);
+    
+    if (owners.empty()) {
+        m_SharedAssets.erase(recordIt);
+        return;
+    }
+    
+    // A memória da instância passa para o próximo dono
+    if (charged) {
+        auto nextIt = m_Assets.find(owners.front());
+        if (nextIt != m_Assets.end()) {
+            SetEntryMemory(nextIt->first.type, nextIt->second, recordIt->second.memory);
+        }
+        SetEntryMemory(key.type, entry, 0);
+    }
+}
+
+size_t AssetsSystem::GetShareCount(const AssetCacheEntry& entry) const {
+    if (entry.contentHash == 0) {
+        return 1;
+    }
+    auto it = m_SharedAssets.find(entry.contentHash);
+    return it != m_SharedAssets.end() ? std::max<size_t>(1, it->second.owners.size()) : 1;
+}
+
+void AssetsSystem::UnloadEntryAsset(AssetCacheEntry& entry) {
+    // Instância compartilhada continua em uso pelas outras entradas
+    if (entry.asset && GetShareCount(entry) <= 1) {
+        entry.asset->Unload();
+    }
+}
+
+IO::FileView AssetsSystem::ReadFromArchives(const std::string& path) const {
+    std::string normalized = IO::NormalizeArchivePath(path);
+    
+    // Só a escolha dos candidatos acontece sob o lock; leitura e descompressão ficam fora
+    // dele para que cargas de arquivos montados não se serializem
+    std::vector<std::pair<std::shared_ptr<IO::ArchiveFileSystem>, size_t>> candidates;
+    {
+        std::lock_guard<std::mutex> lock(m_ArchiveMutex);
+        // Último montado primeiro, permitindo patches sobre o conteúdo base
+        for (auto it = m_Archives.rbegin(); it != m_Archives.rend(); ++it) {
+            const auto& mountPoint = it->mountPoint;
+            if (normalized.compare(0, mountPoint.size(), mountPoint) == 0 &&
+                it->archive->Exists(std::string_view(normalized).substr(mountPoint.size()))) {
+                candidates.emplace_back(it->archive, mountPoint.size());
+            }
+        }
+    }
+    
+    for (const auto& [archive, prefixLength] : candidates) {
+        // Entrada corrompida cai para o próximo arquivo montado
+        IO::FileView view = archive->Read(std::string_view(normalized).substr(prefixLength));
+        if (view.IsValid()) {
+            return view;
+        }
+    }
+    
+    return {};
+}
+
+void AssetsSystem::UnloadAsset(const std::string& path, std::type_index type, const std::string& variant) {
+    const AssetId id = AssetId::FromPath(path, variant);
+    
+    // Pedido ainda na fila não precisa ser executado
+    CancelLoad(id, type);
+    
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    auto it = m_Assets.find(AssetKey(id, type));
+    
+    if (it != m_Assets.end()) {
+        // Carregamento em execução: o resultado ainda será publicado
+        if (it->second.status == AssetStatus::Loading) {
+            DRIFT_LOG_WARNING("[AssetsSystem] Asset ainda carregando, não descarregado: " << path);
+            return;
+        }
+        if (!EraseAssetEntry(it)) {
+            DRIFT_LOG_WARNING("[AssetsSystem] Asset fixado, não descarregado: " << path);
+            return;
+        }
+        m_UnloadCount++;
+        
+        TriggerAssetUnloadedCallback(path, type);
+        DRIFT_LOG_INFO("[AssetsSystem] Asset descarregado: ", path);
+    }
+}
+
+void AssetsSystem::UnloadAssets(std::type_index type) {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    auto it = m_Assets.begin();
+    size_t unloadedCount = 0;
+    
+    while (it != m_Assets.end()) {
+        if (it->first.type == type && it->second.status != AssetStatus::Loading) {
+            std::string path = it->first.path;
+            if (EraseAssetEntry(it)) {
+                TriggerAssetUnloadedCallback(path, type);
+                unloadedCount++;
+                m_UnloadCount++;
+                continue;
+            }
+        }
+        ++it;
+    }
+    
+    DRIFT_LOG_INFO("[AssetsSystem] ", unloadedCount, " assets do tipo descarregados");
+}
+
+void AssetsSystem::UnloadUnusedAssets() {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    auto it = m_Assets.begin();
+    size_t unloadedCount = 0;
+    
+    while (it != m_Assets.end()) {
+        // Asset é considerado não usado se só o cache o referencia (uma vez por entrada que
+        // compartilha a instância) e não está fixado
+        if (it->second.asset && it->second.asset.use_count() == static_cast<long>(GetShareCount(it->second)) &&
+            it->second.status != AssetStatus::Loading) {
+            const AssetKey key = it->first;
+            if (EraseAssetEntry(it)) {
+                TriggerAssetUnloadedCallback(key.path, key.type);
+                unloadedCount++;
+                m_UnloadCount++;
+                continue;
+            }
+        }
+        ++it;
+    }
+    
+    DRIFT_LOG_INFO("[AssetsSystem] ", unloadedCount, " assets não utilizados descarregados");
+}
+
+void AssetsSystem::ClearCache() {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    size_t unloadedCount = 0;
+    size_t pinnedCount = 0;
+    
+    // Chamado após WaitForAllLoads no Shutdown; entradas ainda carregando descartam o resultado.
+    // Entradas fixadas ficam no cache: o AssetPin aponta para o asset delas
+    auto it = m_Assets.begin();
+    while (it != m_Assets.end()) {
+        const AssetKey key = it->first;
+        if (!EraseAssetEntry(it)) {
+            DRIFT_LOG_WARNING("[AssetsSystem] Asset ainda fixado ao limpar o cache: " << key.path);
+            pinnedCount++;
+            ++it;
+            continue;
+        }
+        TriggerAssetUnloadedCallback(key.path, key.type);
+        unloadedCount++;
+    }
+    
+    if (m_Assets.empty()) {
+        UnpublishAllAssets();
+        m_SharedAssets.clear();
+        m_MemoryByType.clear();
+        m_MemoryUsage = 0;
+        PROFILE_GAUGE("Assets/MemoryMB", 0);
+        m_PendingSavingsByType.clear();
+        m_PendingDowngradeSavings = 0;
+    }
+    m_UnloadCount += unloadedCount;
+    
+    DRIFT_LOG_INFO("[AssetsSystem] Cache limpo - " << unloadedCount << " assets descarregados, " << pinnedCount
+                   << " fixados mantidos");
+}
+
+void AssetsSystem::TrimCache() {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    size_t initialCount = m_Assets.size();
+    
+    // Tipos com orçamento próprio são reduzidos ao threshold do seu orçamento
+    for (const auto& [type, budget] : m_Config.memoryBudgets) {
+        if (budget.budget == 0) {
+            continue;
+        }
+        size_t typeTarget = static_cast<size_t>(budget.budget * m_Config.trimThreshold);
+        while (GetTypeMemoryUsage(type) > typeTarget) {
+            if (!EvictLeastUsedAsset(type, true)) {
+                break;
+            }
+        }
+    }
+    
+    // Remove assets menos usados até atingir o threshold global (respeitando reservas)
+    size_t targetMemory = static_cast<size_t>(m_Config.maxMemoryUsage * m_Config.trimThreshold);
+    while (CalculateCurrentMemoryUsage() > targetMemory && !m_Assets.empty()) {
+        if (!EvictLeastUsedAsset()) {
+            break;
+        }
+    }
+    
+    size_t removedCount = initialCount - m_Assets.size();
+    if (removedCount == 0) {
+        return; // Não precisou fazer trim
+    }
+    DRIFT_LOG_INFO("[AssetsSystem] Cache trimmed - ", removedCount, " assets removidos");
+}
+
+AssetsStats AssetsSystem::GetStats() const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    AssetsStats stats;
+    stats.totalAssets = m_Assets.size();
+    stats.memoryUsage = CalculateCurrentMemoryUsage();
+    stats.maxMemoryUsage = m_Config.maxMemoryUsage;
+    for (ThreadSlot* slot = m_ThreadSlots.load(std::memory_order_acquire); slot; slot = slot->next) {
+        stats.cacheHits += slot->cacheHits.load(std::memory_order_relaxed);
+        stats.cacheMisses += slot->cacheMisses.load(std::memory_order_relaxed);
+    }
+    stats.loadCount = m_LoadCount;
+    stats.unloadCount = m_UnloadCount;
+    stats.asyncLoadCount = m_AsyncLoadCount;
+    stats.downgradeCount = m_DowngradeCount;
+    stats.evictionCount = m_EvictionCount;
+    stats.evictionTime = m_EvictionTime;
+    const LockStats& lockStats = m_Mutex.GetStats();
+    stats.lockAcquisitions = lockStats.acquisitions.load(std::memory_order_relaxed);
+    stats.lockContentions = lockStats.contentions.load(std::memory_order_relaxed);
+    stats.lockWaitTime = lockStats.waitNs.load(std::memory_order_relaxed) / 1e9;
+    stats.dedupPayloadHits = m_DedupPayloadHits.load(std::memory_order_relaxed);
+    stats.dedupPayloadBytes = m_DedupPayloadBytes.load(std::memory_order_relaxed);
+    for (const auto& [hash, record] : m_SharedAssets) {
+        if (record.owners.size() > 1) {
+            stats.dedupSharedAssets += record.owners.size() - 1;
+            stats.dedupMemorySaved += record.memory * (record.owners.size() - 1);
+        }
+    }
+    stats.averageLoadTime = m_LoadCount > 0 ? m_TotalLoadTime / m_LoadCount : 0.0;
+    stats.memoryBudgets = m_Config.memoryBudgets;
+    
+    // Calcula estatísticas por tipo e status
+    for (const auto& [key, entry] : m_Assets) {
+        stats.assetsByType[key.type]++;
+        stats.memoryByType[key.type] += entry.memoryUsage;
+        stats.loadCountByType[key.type]++;
+        if (entry.downgradePending) {
+            stats.pendingDowngrades++;
+        }
+        if (entry.qualityLevel > 0) {
+            auto bindingIt = m_LoaderBindings.find(key.type);
+            if (bindingIt == m_LoaderBindings.end() ||
+                entry.qualityLevel > FindQualityLevel(bindingIt->second.qualityLadder, key.variant)) {
+                stats.downgradedAssets++;
+            }
+        }
+        
+        switch (entry.status) {
+            case AssetStatus::Loaded:
+                stats.loadedAssets++;
+                break;
+            case AssetStatus::Loading:
+                stats.loadingAssets++;
+                break;
+            case AssetStatus::Failed:
+                stats.failedAssets++;
+                break;
+            default:
+                break;
+        }
+    }
+    
+    return stats;
+}
+
+void AssetsSystem::LogStats() const {
+    auto stats = GetStats();
+    
+    LOG_INFO("[AssetsSystem] === Estatísticas do Sistema ===");
+    DRIFT_LOG_INFO("[AssetsSystem] Total de Assets: ", stats.totalAssets);
+    DRIFT_LOG_INFO("[AssetsSystem] Assets Carregados: ", stats.loadedAssets);
+    DRIFT_LOG_INFO("[AssetsSystem] Assets Carregando: ", stats.loadingAssets);
+    DRIFT_LOG_INFO("[AssetsSystem] Assets Falharam: ", stats.failedAssets);
+    DRIFT_LOG_INFO("[AssetsSystem] Uso de Memória: ", stats.memoryUsage / (1024 * 1024), " MB / ", stats.maxMemoryUsage / (1024 * 1024), " MB");
+    DRIFT_LOG_INFO("[AssetsSystem] Cache Hits: ", stats.cacheHits);
+    DRIFT_LOG_INFO("[AssetsSystem] Cache Misses: ", stats.cacheMisses);
+    DRIFT_LOG_INFO("[AssetsSystem] Carregamentos: ", stats.loadCount);
+    DRIFT_LOG_INFO("[AssetsSystem] Carregamentos Assíncronos: ", stats.asyncLoadCount);
+    DRIFT_LOG_INFO("[AssetsSystem] Descarregamentos: ", stats.unloadCount);
+    DRIFT_LOG_INFO("[AssetsSystem] Despejos: " << stats.evictionCount << " (" << std::fixed << std::setprecision(2)
+                   << stats.evictionTime * 1000.0 << " ms)");
+    DRIFT_LOG_INFO("[AssetsSystem] Lock do Cache: " << stats.lockContentions << " de " << stats.lockAcquisitions
+                   << " aquisições contestadas, " << std::fixed << std::setprecision(2) << stats.lockWaitTime * 1000.0 << " ms de espera");
+    DRIFT_LOG_INFO("[AssetsSystem] Deduplicação: " << stats.dedupSharedAssets << " assets compartilhados ("
+                   << stats.dedupMemorySaved / 1024 << " KB), " << stats.dedupPayloadHits << " payloads ("
+                   << stats.dedupPayloadBytes / 1024 << " KB)");
+    DRIFT_LOG_INFO("[AssetsSystem] Reduções de Qualidade: " << stats.downgradeCount << " (" << stats.downgradedAssets
+                   << " assets reduzidos, " << stats.pendingDowngrades << " pendentes)");
+    DRIFT_LOG_INFO("[AssetsSystem] Tempo Médio de Carregamento: ", std::fixed, std::setprecision(2), stats.averageLoadTime * 1000.0, " ms");
+    
+    if (!stats.assetsByType.empty()) {
+        LOG_INFO("[AssetsSystem] === Assets por Tipo ===");
+        for (const auto& [type, count] : stats.assetsByType) {
+            size_t memory = stats.memoryByType.at(type);
+            size_t loads = stats.loadCountByType.at(type);
+            DRIFT_LOG_INFO("[AssetsSystem] ", std::string(type.name()), ": ", count, " assets, ", memory / (1024 * 1024), " MB, ", loads, " carregamentos");
+            auto budgetIt = stats.memoryBudgets.find(type);
+            if (budgetIt != stats.memoryBudgets.end()) {
+                DRIFT_LOG_INFO("[AssetsSystem]   orçamento: " << budgetIt->second.budget / (1024 * 1024)
+                               << " MB, reserva: " << budgetIt->second.reservation / (1024 * 1024) << " MB");
+            }
+        }
+    }
+    
+    DRIFT_LOG_INFO("[AssetsSystem] ================================");
+}
+
+void AssetsSystem::ResetStats() {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    for (ThreadSlot* slot = m_ThreadSlots.load(std::memory_order_acquire); slot; slot = slot->next) {
+        slot->cacheHits.store(0, std::memory_order_relaxed);
+        slot->cacheMisses.store(0, std::memory_order_relaxed);
+    }
+    m_LoadCount = 0;
+    m_UnloadCount = 0;
+    m_AsyncLoadCount = 0;
+    m_DowngradeCount = 0;
+    m_EvictionCount = 0;
+    m_EvictionTime = 0.0;
+    m_Mutex.ResetStats();
+    m_DedupPayloadHits = 0;
+    m_DedupPayloadBytes = 0;
+    m_TotalLoadTime = 0.0;
+    LOG_INFO("[AssetsSystem] Estatísticas resetadas");
+}
+
+bool AssetsSystem::IsAssetLoaded(const std::string& path, std::type_index type, const std::string& variant) const {
+    return IsAssetLoaded(AssetId::FromPath(path, variant), type);
+}
+
+bool AssetsSystem::IsAssetLoaded(AssetId id, std::type_index type) const {
+    return FindPublishedAsset(id, type, false) != nullptr;
+}
+
+bool AssetsSystem::IsAssetLoading(const std::string& path, std::type_index type, const std::string& variant) const {
+    return IsAssetLoading(AssetId::FromPath(path, variant), type);
+}
+
+bool AssetsSystem::IsAssetLoading(AssetId id, std::type_index type) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    auto it = m_Assets.find(AssetKey(id, type));
+    
+    return it != m_Assets.end() && it->second.status == AssetStatus::Loading;
+}
+
+AssetStatus AssetsSystem::GetAssetStatus(const std::string& path, std::type_index type, const std::string& variant) const {
+    return GetAssetStatus(AssetId::FromPath(path, variant), type);
+}
+
+AssetStatus AssetsSystem::GetAssetStatus(AssetId id, std::type_index type) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    auto it = m_Assets.find(AssetKey(id, type));
+    
+    if (it != m_Assets.end()) {
+        return it->second.status;
+    }
+    
+    return AssetStatus::NotLoaded;
+}
+
+size_t AssetsSystem::GetQualityLevel(AssetId id, std::type_index type) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    auto it = m_Assets.find(AssetKey(id, type));
+    if (it == m_Assets.end()) {
+        return 0;
+    }
+    if (it->second.qualityLevel != 0) {
+        return it->second.qualityLevel;
+    }
+    auto bindingIt = m_LoaderBindings.find(type);
+    return bindingIt != m_LoaderBindings.end() ? FindQualityLevel(bindingIt->second.qualityLadder, it->first.variant) : 0;
+}
+
+bool AssetsSystem::CanLoadAsset(const std::string& path, std::type_index type) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    auto it = m_LoaderBindings.find(type);
+    if (it == m_LoaderBindings.end()) {
+        return false;
+    }
+    
+    return it->second.canLoad(path);
 }
 
-size_t AssetsSystem::GetLoadingCount() const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+std::vector<std::string> AssetsSystem::GetSupportedExtensions(std::type_index type) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     
-    size_t count = 0;
-    for (const auto& [key, entry] : m_Assets) {
-        if (entry.status == AssetStatus::Loading) {
-            count++;
+    auto it = m_LoaderBindings.find(type);
+    if (it == m_LoaderBindings.end()) {
+        return {};
+    }
+    
+    return it->second.extensions;
+}
+
+void AssetsSystem::WaitForAllLoads() {
+    // Não segura m_Mutex durante a espera: as tarefas precisam dele para publicar o resultado
+    while (GetLoadingCount() > 0 || GetQueuedCount() > 0 || m_PendingPreloads.load() > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    
+    DRIFT_LOG_INFO("[AssetsSystem] Aguardou todos os carregamentos");
+}
+
+void AssetsSystem::CancelAllLoads() {
+    // Cancela apenas o que ainda está na fila; carregamentos em execução terminam normalmente
+    std::vector<LoadRequest> cancelled;
+    {
+        std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+        cancelled.reserve(m_LoadQueue.size());
+        for (const auto& [order, key] : m_LoadQueue) {
+            auto it = m_LoadRequests.find(key);
+            cancelled.push_back(std::move(it->second));
+            m_LoadRequests.erase(it);
         }
+        m_LoadQueue.clear();
     }
     
-    return count;
+    FinishCancelledLoads(cancelled);
+    DRIFT_LOG_INFO("[AssetsSystem] Cancelou " << cancelled.size() << " carregamentos");
+}
+
+size_t AssetsSystem::GetLoadingCount() const {
+    std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+    return m_InFlightLoads;
 }
 
 size_t AssetsSystem::GetQueuedCount() const {
-    // Por enquanto, retorna 0
-    // Em uma implementação completa, seria necessário rastrear a fila de carregamento
-    return 0;
+    std::lock_guard<std::mutex> lock(m_LoadQueueMutex);
+    return m_LoadQueue.size();
 }
 
 bool AssetsSystem::EvictLeastUsedAsset() {
-    if (m_Assets.empty()) {
+    // Sem tipo solicitante: nenhum tipo é despejado abaixo da sua reserva
+    return EvictLeastUsedAsset(std::type_index(typeid(void)), false);
+}
+
+bool AssetsSystem::EvictLeastUsedAsset(std::type_index requester, bool sameTypeOnly) {
+    // Custo do despejo (busca incluída, mesmo sem candidato) para as estatísticas
+    uint64_t start = Clock::NowNs();
+    bool evicted = EvictLeastUsedAssetUntimed(requester, sameTypeOnly);
+    m_EvictionTime += (Clock::NowNs() - start) / 1e9;
+    if (evicted) {
+        m_EvictionCount++;
+    }
+    return evicted;
+}
+
+bool AssetsSystem::EvictLeastUsedAssetUntimed(std::type_index requester, bool sameTypeOnly) {
+    // Encontra o asset menos usado (LRU) entre os candidatos:
+    // - entradas ainda carregando nunca são candidatas
+    // - com sameTypeOnly, apenas assets do tipo solicitante
+    // - assets de outros tipos só se o tipo continuar acima da sua reserva
+    auto leastUsed = m_Assets.end();
+    for (auto it = m_Assets.begin(); it != m_Assets.end(); ++it) {
+        const auto& [key, entry] = *it;
+        if (entry.status == AssetStatus::Loading || IsSlotPinned(entry)) {
+            continue;
+        }
+        if (key.type != requester) {
+            if (sameTypeOnly) {
+                continue;
+            }
+            const AssetMemoryBudget* budget = FindMemoryBudget(key.type);
+            if (budget && GetTypeMemoryUsage(key.type) < budget->reservation + entry.memoryUsage) {
+                continue;
+            }
+        }
+        
+        // Prioriza assets com menor contagem de acesso e mais antigos
+        if (leastUsed == m_Assets.end() || IsLessUsed(entry, leastUsed->second)) {
+            leastUsed = it;
+        }
+    }
+    
+    if (leastUsed == m_Assets.end()) {
         return false;
     }
     
-    // Encontra o asset menos usado (LRU)
-    auto leastUsed = std::min_element(m_Assets.begin(), m_Assets.end(),
-        [](const auto& a, const auto& b) {
-            // Prioriza assets com menor contagem de acesso e mais antigos
-            if (a.second.accessCount != b.second.accessCount) {
-                return a.second.accessCount < b.second.accessCount;
+    // Fixado entre a busca e agora: procura outro candidato
+    const AssetKey key = leastUsed->first;
+    if (!EraseAssetEntry(leastUsed)) {
+        return EvictLeastUsedAssetUntimed(requester, sameTypeOnly);
+    }
+    
+    TriggerAssetUnloadedCallback(key.path, key.type);
+    m_UnloadCount++;
+    return true;
+}
+
+bool AssetsSystem::MakeRoomFor(std::type_index type, size_t memory) {
+    bool fits = true;
+    
+    // Reduções de qualidade agendadas contam como memória já liberada; só despeja
+    // quando não há mais nada a reduzir
+    
+    // Orçamento do tipo: só cede memória do próprio tipo
+    const AssetMemoryBudget* budget = FindMemoryBudget(type);
+    if (budget && budget->budget > 0) {
+        while (GetProjectedTypeMemory(type) + memory > budget->budget) {
+            if (!ScheduleDowngrade(type, true) && !EvictLeastUsedAsset(type, true)) {
+                fits = false;
+                break;
+            }
+        }
+    }
+    
+    // Limite global, descontando a parte ainda livre das reservas dos outros tipos
+    while (m_MemoryUsage - m_PendingDowngradeSavings + memory + GetUnusedReservations(type) > m_Config.maxMemoryUsage) {
+        if (!ScheduleDowngrade(type, false) && !EvictLeastUsedAsset(type, false)) {
+            fits = false;
+            break;
+        }
+    }
+    
+    if (!fits) {
+        DRIFT_LOG_WARNING("[AssetsSystem] Orçamento de memória excedido para tipo: " << std::string(type.name())
+                          << " (" << GetTypeMemoryUsage(type) / (1024 * 1024) << " MB + " << memory / 1024 << " KB)");
+    }
+    return fits;
+}
+
+void AssetsSystem::EnforceMemoryBudgets() {
+    for (const auto& [type, budget] : m_Config.memoryBudgets) {
+        if (budget.budget == 0) {
+            continue;
+        }
+        while (GetProjectedTypeMemory(type) > budget.budget) {
+            if (!ScheduleDowngrade(type, true) && !EvictLeastUsedAsset(type, true)) {
+                break;
             }
-            return a.second.lastAccess < b.second.lastAccess;
-        });
+        }
+    }
+    
+    const std::type_index noRequester(typeid(void));
+    while (m_MemoryUsage - m_PendingDowngradeSavings + GetUnusedReservations(noRequester) > m_Config.maxMemoryUsage) {
+        if (!ScheduleDowngrade(noRequester, false) && !EvictLeastUsedAsset()) {
+            break;
+        }
+    }
+}
+
+bool AssetsSystem::ScheduleDowngrade(std::type_index requester, bool sameTypeOnly) {
+    if (!m_Config.enableQualityDowngrade) {
+        return false;
+    }
+    
+    // Mesmos critérios do despejo (LRU, reservas), restritos a assets com nível mais barato
+    auto candidate = m_Assets.end();
+    const LoaderBinding* candidateBinding = nullptr;
+    size_t candidateLevel = 0;
+    size_t candidateSavings = 0;
     
-    if (leastUsed != m_Assets.end()) {
-        if (leastUsed->second.isAsyncLoading) {
-            while (leastUsed->second.status == AssetStatus::Loading) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    for (auto it = m_Assets.begin(); it != m_Assets.end(); ++it) {
+        const auto& [key, entry] = *it;
+        // Instância compartilhada: trocar uma entrada não libera memória
+        if (entry.status != AssetStatus::Loaded || entry.downgradePending || !entry.canDowngrade || !entry.asset ||
+            IsSlotPinned(entry) || GetShareCount(entry) > 1) {
+            continue;
+        }
+        if (sameTypeOnly && key.type != requester) {
+            continue;
+        }
+        
+        auto bindingIt = m_LoaderBindings.find(key.type);
+        if (bindingIt == m_LoaderBindings.end()) {
+            continue;
+        }
+        const auto& ladder = bindingIt->second.qualityLadder;
+        size_t level = entry.qualityLevel != 0 ? entry.qualityLevel : FindQualityLevel(ladder, key.variant);
+        if (level + 1 >= ladder.size() || ladder[level].memoryScale <= 0.0f) {
+            continue;
+        }
+        
+        float ratio = ladder[level + 1].memoryScale / ladder[level].memoryScale;
+        size_t savings = ratio < 1.0f ? static_cast<size_t>(entry.memoryUsage * (1.0f - ratio)) : 0;
+        if (savings == 0) {
+            continue;
+        }
+        if (key.type != requester) {
+            const AssetMemoryBudget* budget = FindMemoryBudget(key.type);
+            if (budget && GetTypeMemoryUsage(key.type) < budget->reservation + savings) {
+                continue;
             }
         }
         
-        leastUsed->second.asset->Unload();
-        TriggerAssetUnloadedCallback(leastUsed->first.path, leastUsed->first.type);
-        m_Assets.erase(leastUsed);
-        m_UnloadCount++;
-        return true;
+        if (candidate == m_Assets.end() || IsLessUsed(entry, candidate->second)) {
+            candidate = it;
+            candidateBinding = &bindingIt->second;
+            candidateLevel = level;
+            candidateSavings = savings;
+        }
     }
     
-    return false;
+    if (candidate == m_Assets.end()) {
+        return false;
+    }
+    
+    AssetCacheEntry& entry = candidate->second;
+    entry.qualityLevel = candidateLevel;
+    entry.downgradePending = true;
+    entry.pendingSavings = candidateSavings;
+    m_PendingDowngradeSavings += candidateSavings;
+    m_PendingSavingsByType[candidate->first.type] += candidateSavings;
+    
+    candidateBinding->requestDowngrade(candidate->first, candidateLevel + 1, candidateBinding->qualityLadder[candidateLevel + 1]);
+    return true;
+}
+
+void AssetsSystem::EnqueueDowngrade(const AssetKey& key, size_t level, std::function<void(const IO::FileView&)> execute) {
+    // Chave própria na fila: não se funde com pedidos normais do mesmo asset
+    AssetKey queueKey = key;
+    queueKey.id = AssetId(Hash64(std::string_view("#quality"), HashCombine64(key.id.value, level)));
+    
+    // A conclusão também roda em cancelamentos; aí a economia prevista é descartada
+    EnqueueLoad(queueKey, AssetPriority::Low, std::move(execute), [this, key]() { FinishDowngrade(key); });
+}
+
+void AssetsSystem::FinishDowngrade(const AssetKey& key) {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    auto it = m_Assets.find(key);
+    if (it != m_Assets.end() && it->second.downgradePending) {
+        ClearPendingDowngrade(key.type, it->second);
+    }
+}
+
+void AssetsSystem::ClearPendingDowngrade(std::type_index type, AssetCacheEntry& entry) {
+    if (!entry.downgradePending) {
+        return;
+    }
+    m_PendingDowngradeSavings -= entry.pendingSavings;
+    m_PendingSavingsByType[type] -= entry.pendingSavings;
+    entry.downgradePending = false;
+    entry.pendingSavings = 0;
+}
+
+size_t AssetsSystem::GetProjectedTypeMemory(std::type_index type) const {
+    size_t usage = GetTypeMemoryUsage(type);
+    auto it = m_PendingSavingsByType.find(type);
+    return it != m_PendingSavingsByType.end() ? usage - it->second : usage;
+}
+
+size_t AssetsSystem::GetUnusedReservations(std::type_index excluded) const {
+    size_t unused = 0;
+    for (const auto& [type, budget] : m_Config.memoryBudgets) {
+        if (type == excluded) {
+            continue;
+        }
+        size_t used = GetTypeMemoryUsage(type);
+        if (budget.reservation > used) {
+            unused += budget.reservation - used;
+        }
+    }
+    return unused;
+}
+
+const AssetMemoryBudget* AssetsSystem::FindMemoryBudget(std::type_index type) const {
+    auto it = m_Config.memoryBudgets.find(type);
+    return it != m_Config.memoryBudgets.end() ? &it->second : nullptr;
+}
+
+void AssetsSystem::SetEntryMemory(std::type_index type, AssetCacheEntry& entry, size_t memory) {
+    size_t& typeMemory = m_MemoryByType[type];
+    typeMemory = typeMemory - entry.memoryUsage + memory;
+    m_MemoryUsage = m_MemoryUsage - entry.memoryUsage + memory;
+    entry.memoryUsage = memory;
+    PROFILE_GAUGE("Assets/MemoryMB", m_MemoryUsage / (1024.0 * 1024.0));
+}
+
+bool AssetsSystem::EraseAssetEntry(AssetMap::iterator& it) {
+    // Fixada: o slot ainda aponta para o asset da entrada, que fica no cache
+    if (!ReleaseSlot(it->second)) {
+        return false;
+    }
+    UnloadEntryAsset(it->second);
+    DetachSharedAsset(it->first, it->second);
+    ClearPendingDowngrade(it->first.type, it->second);
+    SetEntryMemory(it->first.type, it->second, 0);
+    UnpublishAsset(it->first);
+    it = m_Assets.erase(it);
+    return true;
+}
+
+void AssetsSystem::SetMemoryBudget(std::type_index type, const AssetMemoryBudget& budget) {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    
+    AssetMemoryBudget value = budget;
+    if (value.budget > 0 && value.reservation > value.budget) {
+        DRIFT_LOG_WARNING("[AssetsSystem] Reserva maior que o orçamento, ajustando: " << std::string(type.name()));
+        value.reservation = value.budget;
+    }
+    
+    if (value.budget == 0 && value.reservation == 0) {
+        m_Config.memoryBudgets.erase(type);
+    } else {
+        m_Config.memoryBudgets[type] = value;
+    }
+    
+    size_t reserved = 0;
+    for (const auto& [budgetType, budgetValue] : m_Config.memoryBudgets) {
+        reserved += budgetValue.reservation;
+    }
+    if (reserved > m_Config.maxMemoryUsage) {
+        DRIFT_LOG_WARNING("[AssetsSystem] Soma das reservas (" << reserved / (1024 * 1024)
+                          << " MB) excede o limite global de memória");
+    }
+    
+    EnforceMemoryBudgets();
+    DRIFT_LOG_INFO("[AssetsSystem] Orçamento de memória atualizado: " << std::string(type.name()) << " ("
+                   << value.budget / (1024 * 1024) << " MB, reserva " << value.reservation / (1024 * 1024) << " MB)");
+}
+
+void AssetsSystem::ClearMemoryBudget(std::type_index type) {
+    SetMemoryBudget(type, AssetMemoryBudget{});
+}
+
+AssetMemoryBudget AssetsSystem::GetMemoryBudget(std::type_index type) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    const AssetMemoryBudget* budget = FindMemoryBudget(type);
+    return budget ? *budget : AssetMemoryBudget{};
+}
+
+void AssetsSystem::SetMaxMemoryUsage(size_t bytes) {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    m_Config.maxMemoryUsage = bytes;
+    EnforceMemoryBudgets();
+}
+
+size_t AssetsSystem::GetMemoryUsage(std::type_index type) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    return GetTypeMemoryUsage(type);
+}
+
+size_t AssetsSystem::GetTypeMemoryUsage(std::type_index type) const {
+    auto it = m_MemoryByType.find(type);
+    return it != m_MemoryByType.end() ? it->second : 0;
 }
 
 void AssetsSystem::UpdateAccessStats(AssetCacheEntry& entry) {
-    entry.lastAccess = ++m_AccessCounter;
-    entry.accessCount++;
+    entry.access->lastAccess.store(m_AccessCounter.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    entry.access->accessCount.fetch_add(1, std::memory_order_relaxed);
 }
 
-size_t AssetsSystem::CalculateCurrentMemoryUsage() const {
-    size_t totalMemory = 0;
-    for (const auto& [key, entry] : m_Assets) {
-        totalMemory += entry.memoryUsage;
+AssetsSystem::ThreadSlot& AssetsSystem::GetThreadSlot() const {
+    // Devolve o slot quando a thread termina
+    struct SlotOwner {
+        ThreadSlot* slot = nullptr;
+        ~SlotOwner() {
+            if (slot) {
+                slot->epoch.store(0);
+                slot->inUse.store(false, std::memory_order_release);
+            }
+        }
+    };
+    thread_local SlotOwner owner;
+    if (owner.slot) {
+        return *owner.slot;
+    }
+    
+    // Reaproveita o slot de uma thread encerrada (os contadores continuam somando)
+    for (ThreadSlot* slot = m_ThreadSlots.load(std::memory_order_acquire); slot; slot = slot->next) {
+        bool expected = false;
+        if (!slot->inUse.load(std::memory_order_relaxed) &&
+            slot->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            owner.slot = slot;
+            return *slot;
+        }
+    }
+    
+    auto* slot = new ThreadSlot();
+    slot->inUse.store(true, std::memory_order_relaxed);
+    slot->next = m_ThreadSlots.load(std::memory_order_relaxed);
+    while (!m_ThreadSlots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    owner.slot = slot;
+    return *slot;
+}
+
+void AssetsSystem::RecordCacheHit() const {
+    GetThreadSlot().cacheHits.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AssetsSystem::RecordCacheMiss() const {
+    GetThreadSlot().cacheMisses.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AssetsSystem::RecordAccess(AssetAccessCounters& access) const {
+    access.lastAccess.store(m_AccessCounter.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    access.accessCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+AssetsSystem::AssetSlot* AssetsSystem::GetSlot(uint32_t index) const {
+    size_t chunk = index / kSlotChunkSize;
+    if (chunk >= kMaxSlotChunks) {
+        return nullptr;
+    }
+    AssetSlot* slots = m_SlotChunks[chunk].load(std::memory_order_acquire);
+    return slots ? &slots[index % kSlotChunkSize] : nullptr;
+}
+
+void AssetsSystem::AttachSlot(AssetCacheEntry& entry) {
+    if (entry.slot != 0) {
+        if (AssetSlot* slot = GetSlot(entry.slot)) {
+            slot->asset.store(entry.asset.get(), std::memory_order_release);
+        }
+        return;
+    }
+    
+    uint32_t index;
+    if (!m_FreeSlots.empty()) {
+        index = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    } else {
+        if (m_SlotCount >= kSlotChunkSize * kMaxSlotChunks) {
+            DRIFT_LOG_ERROR("[AssetsSystem] Slots de handle esgotados");
+            return;
+        }
+        index = m_SlotCount++;
+        auto& chunk = m_SlotChunks[index / kSlotChunkSize];
+        if (!chunk.load(std::memory_order_relaxed)) {
+            chunk.store(new AssetSlot[kSlotChunkSize], std::memory_order_release);
+        }
+    }
+    
+    AssetSlot* slot = GetSlot(index);
+    if (!slot) {
+        return;
+    }
+    uint32_t generation = static_cast<uint32_t>(slot->state.load(std::memory_order_relaxed) >> 32) + 1;
+    if (generation == 0) {
+        generation = 1;     // 0 é reservado ao handle nulo
+    }
+    slot->asset.store(entry.asset.get(), std::memory_order_relaxed);
+    slot->access = entry.access.get();
+    slot->state.store((static_cast<uint64_t>(generation) << 32) | AssetSlot::kAlive, std::memory_order_release);
+    entry.slot = index;
+}
+
+bool AssetsSystem::ReleaseSlot(AssetCacheEntry& entry) {
+    if (entry.slot == 0) {
+        return true;
+    }
+    
+    // Avança a geração só sem fixações: handles antigos passam a ser rejeitados
+    AssetSlot& slot = *GetSlot(entry.slot);
+    uint64_t state = slot.state.load(std::memory_order_acquire);
+    do {
+        if (state & (AssetSlot::kPinMask | AssetSlot::kBusy)) {
+            return false;
+        }
+    } while (!slot.state.compare_exchange_weak(state, state & ~(AssetSlot::kAlive | 0xFFFFFFFFull),
+                                               std::memory_order_acq_rel, std::memory_order_acquire));
+    
+    slot.asset.store(nullptr, std::memory_order_relaxed);
+    slot.access = nullptr;
+    m_FreeSlots.push_back(entry.slot);
+    entry.slot = 0;
+    return true;
+}
+
+bool AssetsSystem::SwapSlotAsset(AssetCacheEntry& entry, IAsset* asset) {
+    if (entry.slot == 0) {
+        return true;
+    }
+    
+    // Marca como ocupado (sem fixações) para que nenhum Pin leia o ponteiro durante a troca
+    AssetSlot& slot = *GetSlot(entry.slot);
+    uint64_t state = slot.state.load(std::memory_order_acquire);
+    do {
+        if (state & (AssetSlot::kPinMask | AssetSlot::kBusy)) {
+            return false;
+        }
+    } while (!slot.state.compare_exchange_weak(state, state | AssetSlot::kBusy,
+                                               std::memory_order_acq_rel, std::memory_order_acquire));
+    
+    slot.asset.store(asset, std::memory_order_relaxed);
+    slot.state.fetch_and(~AssetSlot::kBusy, std::memory_order_release);
+    return true;
+}
+
+bool AssetsSystem::IsSlotPinned(const AssetCacheEntry& entry) const {
+    return entry.slot != 0 && (GetSlot(entry.slot)->state.load(std::memory_order_acquire) & AssetSlot::kPinMask) != 0;
+}
+
+uint32_t AssetsSystem::GetSlotGeneration(uint32_t index) const {
+    AssetSlot* slot = index != 0 ? GetSlot(index) : nullptr;
+    return slot ? static_cast<uint32_t>(slot->state.load(std::memory_order_acquire) >> 32) : 0;
+}
+
+bool AssetsSystem::IsHandleAlive(uint32_t index, uint32_t generation) const {
+    AssetSlot* slot = generation != 0 ? GetSlot(index) : nullptr;
+    if (!slot) {
+        return false;
+    }
+    uint64_t state = slot->state.load(std::memory_order_acquire);
+    return static_cast<uint32_t>(state >> 32) == generation && (state & AssetSlot::kAlive);
+}
+
+IAsset* AssetsSystem::PinSlot(uint32_t index, uint32_t generation) const {
+    AssetSlot* slot = generation != 0 ? GetSlot(index) : nullptr;
+    if (!slot) {
+        return nullptr;
+    }
+    
+    uint64_t state = slot->state.load(std::memory_order_acquire);
+    for (;;) {
+        if (static_cast<uint32_t>(state >> 32) != generation || !(state & AssetSlot::kAlive)) {
+            return nullptr;
+        }
+        if (state & AssetSlot::kBusy) {
+            // Troca de variante em andamento (curta)
+            std::this_thread::yield();
+            state = slot->state.load(std::memory_order_acquire);
+            continue;
+        }
+        if (slot->state.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_acquire)) {
+            break;
+        }
+    }
+    
+    RecordAccess(*slot->access);
+    return slot->asset.load(std::memory_order_acquire);
+}
+
+void AssetsSystem::UnpinSlot(uint32_t index) const {
+    GetSlot(index)->state.fetch_sub(1, std::memory_order_release);
+}
+
+std::shared_ptr<IAsset> AssetsSystem::FindPublishedAsset(AssetId id, std::type_index type, bool recordAccess) const {
+    ThreadSlot& slot = GetThreadSlot();
+    
+    // Anuncia a época antes de ler o shard: escritores não liberam nada que esta leitura possa ver
+    slot.epoch.store(m_ReadEpoch.load());
+    const PublishedShard* shard = m_PublishedShards[id.value % kPublishedShardCount].load();
+    
+    std::shared_ptr<IAsset> asset;
+    if (shard) {
+        auto it = std::lower_bound(shard->items.begin(), shard->items.end(), id.value,
+            [](const PublishedShard::Item& item, uint64_t value) { return item.id < value; });
+        for (; it != shard->items.end() && it->id == id.value; ++it) {
+            if (it->type == type) {
+                asset = it->asset.lock();
+                if (recordAccess && asset) {
+                    RecordAccess(*it->access);
+                }
+                break;
+            }
+        }
+    }
+    slot.epoch.store(0, std::memory_order_release);
+    
+    if (recordAccess) {
+        (asset ? slot.cacheHits : slot.cacheMisses).fetch_add(1, std::memory_order_relaxed);
+    }
+    return asset;
+}
+
+std::pair<uint32_t, uint32_t> AssetsSystem::FindPublishedSlot(AssetId id, std::type_index type) const {
+    ThreadSlot& slot = GetThreadSlot();
+    
+    slot.epoch.store(m_ReadEpoch.load());
+    const PublishedShard* shard = m_PublishedShards[id.value % kPublishedShardCount].load();
+    
+    std::pair<uint32_t, uint32_t> result{0, 0};
+    if (shard) {
+        auto it = std::lower_bound(shard->items.begin(), shard->items.end(), id.value,
+            [](const PublishedShard::Item& item, uint64_t value) { return item.id < value; });
+        for (; it != shard->items.end() && it->id == id.value; ++it) {
+            if (it->type == type) {
+                result = {it->slot, it->generation};
+                RecordAccess(*it->access);
+                break;
+            }
+        }
+    }
+    slot.epoch.store(0, std::memory_order_release);
+    
+    (result.second != 0 ? slot.cacheHits : slot.cacheMisses).fetch_add(1, std::memory_order_relaxed);
+    return result;
+}
+
+void AssetsSystem::PublishAsset(const AssetKey& key, const AssetCacheEntry& entry) {
+    size_t index = key.id.value % kPublishedShardCount;
+    const PublishedShard* current = m_PublishedShards[index].load();
+    auto* next = current ? new PublishedShard(*current) : new PublishedShard();
+    
+    auto it = std::lower_bound(next->items.begin(), next->items.end(), key.id.value,
+        [](const PublishedShard::Item& item, uint64_t value) { return item.id < value; });
+    while (it != next->items.end() && it->id == key.id.value && it->type != key.type) {
+        ++it;
     }
-    return totalMemory;
+    
+    const uint32_t generation = GetSlotGeneration(entry.slot);
+    if (it != next->items.end() && it->id == key.id.value) {
+        it->asset = entry.asset;
+        it->access = entry.access;
+        it->slot = entry.slot;
+        it->generation = generation;
+    } else {
+        next->items.insert(it, PublishedShard::Item{key.id.value, key.type, entry.asset, entry.access,
+                                                    entry.slot, generation});
+    }
+    
+    ReplacePublishedShard(index, next);
+}
+
+void AssetsSystem::UnpublishAsset(const AssetKey& key) {
+    size_t index = key.id.value % kPublishedShardCount;
+    const PublishedShard* current = m_PublishedShards[index].load();
+    if (!current) {
+        return;
+    }
+    
+    auto matches = [&](const PublishedShard::Item& item) {
+        return item.id == key.id.value && item.type == key.type;
+    };
+    if (std::none_of(current->items.begin(), current->items.end(), matches)) {
+        return;
+    }
+    
+    auto* next = new PublishedShard();
+    next->items.reserve(current->items.size() - 1);
+    std::copy_if(current->items.begin(), current->items.end(), std::back_inserter(next->items),
+                 [&](const PublishedShard::Item& item) { return !matches(item); });
+    
+    if (next->items.empty()) {
+        delete next;
+        next = nullptr;
+    }
+    ReplacePublishedShard(index, next);
+}
+
+void AssetsSystem::UnpublishAllAssets() {
+    for (size_t index = 0; index < kPublishedShardCount; ++index) {
+        if (m_PublishedShards[index].load()) {
+            ReplacePublishedShard(index, nullptr);
+        }
+    }
+}
+
+void AssetsSystem::ReplacePublishedShard(size_t index, const PublishedShard* shard) {
+    const PublishedShard* previous = m_PublishedShards[index].exchange(shard);
+    if (previous) {
+        // Leitores que anunciaram esta época (ou anterior) ainda podem estar usando a cópia antiga
+        m_RetiredShards.emplace_back(m_ReadEpoch.fetch_add(1), previous);
+    }
+    ReclaimRetiredShards();
+}
+
+void AssetsSystem::ReclaimRetiredShards() {
+    if (m_RetiredShards.empty()) {
+        return;
+    }
+    
+    uint64_t oldestActive = UINT64_MAX;
+    for (ThreadSlot* slot = m_ThreadSlots.load(std::memory_order_acquire); slot; slot = slot->next) {
+        uint64_t epoch = slot->epoch.load();
+        if (epoch != 0 && epoch < oldestActive) {
+            oldestActive = epoch;
+        }
+    }
+    
+    auto reclaimable = std::partition(m_RetiredShards.begin(), m_RetiredShards.end(),
+        [&](const auto& retired) { return retired.first >= oldestActive; });
+    for (auto it = reclaimable; it != m_RetiredShards.end(); ++it) {
+        delete it->second;
+    }
+    m_RetiredShards.erase(reclaimable, m_RetiredShards.end());
+}
+
+size_t AssetsSystem::CalculateCurrentMemoryUsage() const {
+    return m_MemoryUsage;
 }
 
 void AssetsSystem::TriggerAssetLoadedCallback(const std::string& path, std::type_index type) {
@@ -460,7 +2077,7 @@ void AssetsSystem::ProcessAsyncLoads() {
 }
 
 void AssetsSystem::CleanupCompletedLoads() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     
     for (auto& [key, entry] : m_Assets) {
         if (entry.isAsyncLoading && entry.status != AssetStatus::Loading) {
@@ -0,0 +1,411 @@
+#include "Drift/Core/Assets/DerivedDataCache.h"
+#include "Drift/Core/Hash.h"
+#include "Drift/Core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace Drift::Core::Assets {
+
+namespace {
+
+constexpr uint32_t DDC_MAGIC = 0x42434444;     // "DDCB"
+constexpr uint32_t DDC_FORMAT_VERSION = 1;
+constexpr const char* DDC_EXTENSION = ".ddc";
+
+// Cabeçalho de cada blob; 64 bytes para manter o conteúdo alinhado no mapeamento
+struct DdcBlobHeader {
+    uint32_t magic;
+    uint32_t formatVersion;
+    uint64_t keyHash;
+    uint64_t nameHash;
+    uint64_t sourceHash;
+    uint64_t paramsHash;
+    uint32_t loaderVersion;
+    uint32_t payloadCrc;
+    uint64_t payloadSize;
+    uint64_t reserved;
+};
+static_assert(sizeof(DdcBlobHeader) == 64, "DdcBlobHeader deve ter 64 bytes");
+
+// Atualiza a data de acesso em disco no máximo uma vez por minuto por entrada
+constexpr auto TOUCH_INTERVAL = std::chrono::minutes(1);
+
+int64_t NowTicks() {
+    return fs::file_time_type::clock::now().time_since_epoch().count();
+}
+
+bool ParseHexHash(const std::string& text, uint64_t& out) {
+    if (text.size() != 16) {
+        return false;
+    }
+    uint64_t value = 0;
+    for (char c : text) {
+        value <<= 4;
+        if (c >= '0' && c <= '9') {
+            value |= static_cast<uint64_t>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            value |= static_cast<uint64_t>(c - 'a' + 10);
+        } else {
+            return false;
+        }
+    }
+    out = value;
+    return true;
+}
+
+} // namespace
+
+uint64_t DerivedDataKey::GetHash() const {
+    uint64_t hash = Hash64(loaderName);
+    hash = HashCombine64(hash, loaderVersion);
+    hash = HashCombine64(hash, sourceHash);
+    return HashCombine64(hash, paramsHash);
+}
+
+DerivedDataKey DerivedDataKey::Make(std::string loaderName, uint32_t loaderVersion,
+                                    const IO::FileView& source, std::string_view params) {
+    return Make(std::move(loaderName), loaderVersion, source.data, source.size, params);
+}
+
+DerivedDataKey DerivedDataKey::Make(std::string loaderName, uint32_t loaderVersion,
+                                    const void* source, size_t sourceSize, std::string_view params) {
+    DerivedDataKey key;
+    key.loaderName = std::move(loaderName);
+    key.loaderVersion = loaderVersion;
+    key.sourceHash = Hash64(source, sourceSize);
+    key.paramsHash = Hash64(params);
+    return key;
+}
+
+DerivedDataCache& DerivedDataCache::GetInstance() {
+    static DerivedDataCache instance;
+    return instance;
+}
+
+bool DerivedDataCache::Initialize(const DerivedDataCacheConfig& config) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Initialized.load()) {
+        DRIFT_LOG_WARNING("[DerivedDataCache] Já inicializado");
+        return true;
+    }
+
+    m_Config = config;
+    std::error_code ec;
+    fs::create_directories(m_Config.directory, ec);
+    if (ec) {
+        DRIFT_LOG_ERROR("[DerivedDataCache] Não foi possível criar o diretório: " << m_Config.directory);
+        return false;
+    }
+
+    ScanDirectory();
+    if (m_BytesOnDisk > m_Config.maxCacheSize) {
+        TrimLocked(static_cast<uint64_t>(m_Config.maxCacheSize * m_Config.trimTarget));
+    }
+
+    m_Initialized = true;
+    DRIFT_LOG_INFO("[DerivedDataCache] Inicializado em " << m_Config.directory << " ("
+                   << m_Entries.size() << " entradas, " << m_BytesOnDisk / (1024 * 1024) << " MB)");
+    return true;
+}
+
+void DerivedDataCache::Shutdown() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Initialized.load()) {
+        return;
+    }
+    m_Initialized = false;
+    m_Entries.clear();
+    m_BytesOnDisk = 0;
+    DRIFT_LOG_INFO("[DerivedDataCache] Finalizado (hits: " << m_Hits.load() << ", misses: " << m_Misses.load() << ")");
+}
+
+std::string DerivedDataCache::GetEntryPath(uint64_t hash) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+    // Subdiretórios pelos dois primeiros dígitos evitam diretórios enormes
+    return (fs::path(m_Config.directory) / std::string(name, 2) / (std::string(name) + DDC_EXTENSION)).string();
+}
+
+void DerivedDataCache::ScanDirectory() {
+    m_Entries.clear();
+    m_BytesOnDisk = 0;
+
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(m_Config.directory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+
+        const fs::path& path = it->path();
+        // Temporários de execuções interrompidas
+        if (path.filename().string().find(".tmp") != std::string::npos) {
+            fs::remove(path, ec);
+            continue;
+        }
+
+        uint64_t hash = 0;
+        if (path.extension() != DDC_EXTENSION || !ParseHexHash(path.stem().string(), hash)) {
+            continue;
+        }
+
+        Entry entry;
+        entry.size = it->file_size(ec);
+        entry.lastAccess = fs::last_write_time(path, ec).time_since_epoch().count();
+        m_BytesOnDisk += entry.size;
+        m_Entries[hash] = entry;
+    }
+}
+
+IO::FileView DerivedDataCache::Get(const DerivedDataKey& key) {
+    if (!m_Initialized.load()) {
+        return {};
+    }
+
+    uint64_t hash = key.GetHash();
+    std::string path = GetEntryPath(hash);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Entries.find(hash) == m_Entries.end()) {
+            m_Misses++;
+            return {};
+        }
+    }
+
+    auto file = IO::MappedFile::Open(path, IO::MapAccessHint::Sequential);
+    if (!file || file->GetSize() < sizeof(DdcBlobHeader)) {
+        DRIFT_LOG_WARNING("[DerivedDataCache] Entrada ilegível, removendo: " << path);
+        Remove(key);
+        m_Misses++;
+        return {};
+    }
+
+    DdcBlobHeader header;
+    std::memcpy(&header, file->GetData(), sizeof(header));
+    bool valid = header.magic == DDC_MAGIC &&
+                 header.formatVersion == DDC_FORMAT_VERSION &&
+                 header.keyHash == hash &&
+                 header.nameHash == Hash64(key.loaderName) &&
+                 header.sourceHash == key.sourceHash &&
+                 header.paramsHash == key.paramsHash &&
+                 header.loaderVersion == key.loaderVersion &&
+                 header.payloadSize == file->GetSize() - sizeof(DdcBlobHeader);
+
+    IO::FileView payload;
+    if (valid) {
+        payload = file->GetView().SubView(sizeof(DdcBlobHeader));
+        if (m_Config.verifyOnRead && Crc32(payload.data, payload.size) != header.payloadCrc) {
+            valid = false;
+        }
+    }
+
+    if (!valid) {
+        DRIFT_LOG_WARNING("[DerivedDataCache] Entrada inválida, removendo: " << path);
+        file.reset();
+        Remove(key);
+        m_Misses++;
+        return {};
+    }
+
+    TouchEntry(hash, path);
+    m_Hits++;
+    return payload;
+}
+
+void DerivedDataCache::TouchEntry(uint64_t hash, const std::string& path) {
+    int64_t now = NowTicks();
+    int64_t interval = std::chrono::duration_cast<fs::file_time_type::duration>(TOUCH_INTERVAL).count();
+
+    bool touchDisk = false;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Entries.find(hash);
+        if (it == m_Entries.end()) {
+            return;
+        }
+        touchDisk = now - it->second.lastAccess >= interval;
+        it->second.lastAccess = now;
+    }
+
+    // A data de modificação em disco guarda o LRU entre execuções
+    if (touchDisk) {
+        std::error_code ec;
+        fs::last_write_time(path, fs::file_time_type(fs::file_time_type::duration(now)), ec);
+    }
+}
+
+bool DerivedDataCache::Put(const DerivedDataKey& key, const void* data, size_t size) {
+    if (!m_Initialized.load() || data == nullptr || size == 0) {
+        return false;
+    }
+
+    uint64_t totalSize = sizeof(DdcBlobHeader) + size;
+    if (totalSize > m_Config.maxCacheSize) {
+        DRIFT_LOG_WARNING("[DerivedDataCache] Entrada maior que o limite do cache: " << key.loaderName);
+        return false;
+    }
+
+    uint64_t hash = key.GetHash();
+    std::string path = GetEntryPath(hash);
+    std::string tempPath = path + ".tmp" + std::to_string(m_TempCounter.fetch_add(1));
+
+    DdcBlobHeader header{};
+    header.magic = DDC_MAGIC;
+    header.formatVersion = DDC_FORMAT_VERSION;
+    header.keyHash = hash;
+    header.nameHash = Hash64(key.loaderName);
+    header.sourceHash = key.sourceHash;
+    header.paramsHash = key.paramsHash;
+    header.loaderVersion = key.loaderVersion;
+    header.payloadCrc = Crc32(data, size);
+    header.payloadSize = size;
+
+    std::error_code ec;
+    fs::create_directories(fs::path(path).parent_path(), ec);
+
+    // Grava em arquivo temporário e renomeia: leitores nunca veem um blob parcial
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            DRIFT_LOG_ERROR("[DerivedDataCache] Não foi possível criar: " << tempPath);
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        out.close();
+        if (!out) {
+            DRIFT_LOG_ERROR("[DerivedDataCache] Falha de escrita: " << tempPath);
+            fs::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    fs::rename(tempPath, path, ec);
+    if (ec) {
+        // Ex.: Windows com a entrada antiga ainda mapeada
+        DRIFT_LOG_WARNING("[DerivedDataCache] Falha ao publicar entrada: " << path);
+        fs::remove(tempPath, ec);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto& entry = m_Entries[hash];
+    m_BytesOnDisk -= entry.size;
+    entry.size = totalSize;
+    entry.lastAccess = NowTicks();
+    m_BytesOnDisk += totalSize;
+    m_Writes++;
+
+    if (m_BytesOnDisk > m_Config.maxCacheSize) {
+        TrimLocked(static_cast<uint64_t>(m_Config.maxCacheSize * m_Config.trimTarget));
+    }
+    return true;
+}
+
+bool DerivedDataCache::Contains(const DerivedDataKey& key) const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Entries.find(key.GetHash()) != m_Entries.end();
+}
+
+bool DerivedDataCache::Remove(const DerivedDataKey& key) {
+    uint64_t hash = key.GetHash();
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_Entries.find(hash);
+    if (it == m_Entries.end()) {
+        return false;
+    }
+
+    std::error_code ec;
+    fs::remove(GetEntryPath(hash), ec);
+    m_BytesOnDisk -= it->second.size;
+    m_Entries.erase(it);
+    return true;
+}
+
+IO::FileView DerivedDataCache::GetOrBuild(const DerivedDataKey& key, const BuildFunction& build) {
+    IO::FileView cached = Get(key);
+    if (!cached.Empty()) {
+        return cached;
+    }
+
+    std::vector<uint8_t> output;
+    if (!build || !build(output) || output.empty()) {
+        return {};
+    }
+
+    Put(key, output.data(), output.size());
+    return IO::FileView::FromBuffer(std::move(output));
+}
+
+void DerivedDataCache::Trim() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_BytesOnDisk > m_Config.maxCacheSize) {
+        TrimLocked(static_cast<uint64_t>(m_Config.maxCacheSize * m_Config.trimTarget));
+    }
+}
+
+void DerivedDataCache::TrimLocked(uint64_t targetSize) {
+    std::vector<std::pair<int64_t, uint64_t>> byAge;
+    byAge.reserve(m_Entries.size());
+    for (const auto& [hash, entry] : m_Entries) {
+        byAge.emplace_back(entry.lastAccess, hash);
+    }
+    std::sort(byAge.begin(), byAge.end());
+
+    size_t removed = 0;
+    for (const auto& [lastAccess, hash] : byAge) {
+        if (m_BytesOnDisk <= targetSize) {
+            break;
+        }
+
+        std::error_code ec;
+        fs::remove(GetEntryPath(hash), ec);
+        if (ec) {
+            continue;   // Ainda mapeada em outro processo (Windows)
+        }
+
+        auto it = m_Entries.find(hash);
+        m_BytesOnDisk -= it->second.size;
+        m_Entries.erase(it);
+        m_Evictions++;
+        removed++;
+    }
+
+    if (removed > 0) {
+        DRIFT_LOG_INFO("[DerivedDataCache] Limpeza LRU: " << removed << " entradas removidas, "
+                       << m_BytesOnDisk / (1024 * 1024) << " MB em disco");
+    }
+}
+
+void DerivedDataCache::Clear() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    TrimLocked(0);
+}
+
+void DerivedDataCache::SetMaxCacheSize(uint64_t bytes) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Config.maxCacheSize = bytes;
+    if (m_BytesOnDisk > m_Config.maxCacheSize) {
+        TrimLocked(static_cast<uint64_t>(m_Config.maxCacheSize * m_Config.trimTarget));
+    }
+}
+
+DerivedDataCache::Stats DerivedDataCache::GetStats() const {
+    Stats stats;
+    stats.hits = m_Hits.load();
+    stats.misses = m_Misses.load();
+    stats.writes = m_Writes.load();
+    stats.evictions = m_Evictions.load();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    stats.bytesOnDisk = m_BytesOnDisk;
+    stats.entryCount = m_Entries.size();
+    return stats;
+}
+
+} // namespace Drift::Core::Assets
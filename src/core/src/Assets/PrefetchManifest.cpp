@@ -0,0 +1,142 @@
+#include "Drift/Core/Assets/PrefetchManifest.h"
+#include "Drift/Core/IO/MappedFile.h"
+#include "Drift/Core/Hash.h"
+#include "Drift/Core/Log.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Drift::Core::Assets {
+
+namespace {
+
+constexpr uint32_t MANIFEST_MAGIC = 0x4D465044;    // "DPFM"
+constexpr uint32_t MANIFEST_VERSION = 1;
+
+struct ManifestHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t dataCrc;
+};
+
+struct ManifestEntryHeader {
+    uint32_t timeMs;
+    uint16_t pathLength;
+    uint16_t variantLength;
+};
+
+template<typename T>
+void AppendPod(std::vector<uint8_t>& out, const T& value) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+} // namespace
+
+bool PrefetchManifest::Load(const std::string& path, std::vector<PrefetchManifestEntry>& entries) {
+    entries.clear();
+
+    auto file = IO::MappedFile::Open(path, IO::MapAccessHint::Sequential);
+    if (!file) {
+        return false;
+    }
+
+    IO::FileView view = file->GetView();
+    if (view.size < sizeof(ManifestHeader)) {
+        DRIFT_LOG_WARNING("[PrefetchManifest] Arquivo truncado: " << path);
+        return false;
+    }
+
+    ManifestHeader header;
+    std::memcpy(&header, view.data, sizeof(header));
+    const uint8_t* cursor = view.data + sizeof(header);
+    const uint8_t* end = view.data + view.size;
+
+    if (header.magic != MANIFEST_MAGIC || header.version != MANIFEST_VERSION ||
+        Crc32(cursor, static_cast<size_t>(end - cursor)) != header.dataCrc) {
+        DRIFT_LOG_WARNING("[PrefetchManifest] Manifesto inválido ou de outra versão: " << path);
+        return false;
+    }
+
+    entries.reserve(header.entryCount);
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        ManifestEntryHeader entryHeader;
+        if (static_cast<size_t>(end - cursor) < sizeof(entryHeader)) {
+            break;
+        }
+        std::memcpy(&entryHeader, cursor, sizeof(entryHeader));
+        cursor += sizeof(entryHeader);
+
+        size_t textLength = static_cast<size_t>(entryHeader.pathLength) + entryHeader.variantLength;
+        if (static_cast<size_t>(end - cursor) < textLength) {
+            break;
+        }
+
+        PrefetchManifestEntry entry;
+        entry.timeMs = entryHeader.timeMs;
+        entry.path.assign(reinterpret_cast<const char*>(cursor), entryHeader.pathLength);
+        entry.variant.assign(reinterpret_cast<const char*>(cursor) + entryHeader.pathLength, entryHeader.variantLength);
+        cursor += textLength;
+        entries.push_back(std::move(entry));
+    }
+
+    if (entries.size() != header.entryCount) {
+        DRIFT_LOG_WARNING("[PrefetchManifest] Entradas corrompidas: " << path);
+        entries.clear();
+        return false;
+    }
+    return true;
+}
+
+bool PrefetchManifest::Save(const std::string& path, const std::vector<PrefetchManifestEntry>& entries) {
+    std::vector<uint8_t> data;
+    uint32_t count = 0;
+    for (const auto& entry : entries) {
+        if (entry.path.size() > UINT16_MAX || entry.variant.size() > UINT16_MAX) {
+            continue;
+        }
+        ManifestEntryHeader entryHeader{entry.timeMs, static_cast<uint16_t>(entry.path.size()),
+                                        static_cast<uint16_t>(entry.variant.size())};
+        AppendPod(data, entryHeader);
+        data.insert(data.end(), entry.path.begin(), entry.path.end());
+        data.insert(data.end(), entry.variant.begin(), entry.variant.end());
+        count++;
+    }
+
+    ManifestHeader header{MANIFEST_MAGIC, MANIFEST_VERSION, count, Crc32(data.data(), data.size())};
+
+    std::error_code ec;
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    if (!parent.empty()) {
+        std::filesystem::create_directories(parent, ec);
+    }
+
+    // Temporário + rename: uma sessão interrompida não deixa manifesto parcial
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            DRIFT_LOG_ERROR("[PrefetchManifest] Não foi possível criar: " << tempPath);
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        out.close();
+        if (!out) {
+            DRIFT_LOG_ERROR("[PrefetchManifest] Falha de escrita: " << tempPath);
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        DRIFT_LOG_ERROR("[PrefetchManifest] Falha ao substituir: " << path);
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+} // namespace Drift::Core::Assets
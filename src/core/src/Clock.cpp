@@ -0,0 +1,141 @@
+#include "Drift/Core/Clock.h"
+
+#if DRIFT_CLOCK_HAS_TSC && !defined(_MSC_VER)
+#include <cpuid.h>
+#endif
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+namespace Drift::Core {
+
+namespace {
+
+constexpr uint64_t CALIBRATION_WINDOW_NS = 10000000;      // 10 ms
+
+struct ClockSample {
+    uint64_t ticks;
+    uint64_t ns;
+};
+
+// Relógio de referência da calibração: CLOCK_MONOTONIC_RAW não sofre ajustes de NTP
+uint64_t ReferenceNowNs() {
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_RAW)
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+// Par (ticks, ns) com a leitura de referência cercada pelo TSC; fica a de menor intervalo
+template<typename NowFn>
+ClockSample SampleClock(NowFn now) {
+    ClockSample best{0, 0};
+    uint64_t bestSpread = UINT64_MAX;
+    for (int attempt = 0; attempt < 8; ++attempt) {
+        uint64_t before = Clock::ReadTicksOrdered();
+        uint64_t ns = now();
+        uint64_t after = Clock::ReadTicksOrdered();
+        if (after - before < bestSpread) {
+            bestSpread = after - before;
+            best = {before + (after - before) / 2, ns};
+        }
+    }
+    return best;
+}
+
+bool HasInvariantTsc() {
+#if DRIFT_CLOCK_HAS_TSC
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0x80000000);
+    if (static_cast<unsigned>(regs[0]) < 0x80000007u) {
+        return false;
+    }
+    __cpuid(regs, 0x80000007);
+    return (regs[3] & (1 << 8)) != 0;
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    return (edx & (1u << 8)) != 0;
+#endif
+#else
+    return false;
+#endif
+}
+
+} // namespace
+
+// Calibração em dois pontos sem espera: o início é gravado na primeira chamada de NowNs() e
+// o fim na primeira chamada depois de CALIBRATION_WINDOW_NS; até lá NowNs() usa steady_clock
+struct Clock::Calibrator {
+    Calibrator() {
+        if (!HasInvariantTsc()) {
+            finished = true;
+            return;
+        }
+        start = SampleClock(ReferenceNowNs);
+    }
+
+    void Advance() {
+        if (finished.load(std::memory_order_acquire)) {
+            return;
+        }
+        if (ReferenceNowNs() - start.ns < CALIBRATION_WINDOW_NS) {
+            return;
+        }
+        // Uma thread fecha a calibração; as demais seguem com steady_clock
+        if (closing.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        Finish();
+        finished.store(true, std::memory_order_release);
+    }
+
+    void Finish() {
+        ClockSample end = SampleClock(ReferenceNowNs);
+
+        uint64_t ticks = end.ticks - start.ticks;
+        uint64_t ns = end.ns - start.ns;
+        if (ticks == 0 || ns == 0) {
+            return;
+        }
+
+        // Descarta frequências implausíveis (TSC parado ou emulado de forma errada)
+        double ghz = static_cast<double>(ticks) / static_cast<double>(ns);
+        if (ghz < 0.1 || ghz > 10.0) {
+            return;
+        }
+
+        // A janela pode ter passado de segundos (ns << 32 estouraria): ponto fixo via double
+        uint64_t multiplier = static_cast<uint64_t>(static_cast<double>(ns) * 4294967296.0 / static_cast<double>(ticks));
+
+        // A base vem de steady_clock para NowNs() manter a época dele
+        ClockSample base = SampleClock(SteadyNowNs);
+        s_Multiplier = multiplier;
+        s_BaseTicks = base.ticks;
+        s_BaseNs = base.ns;
+        s_UseTsc.store(true, std::memory_order_release);
+    }
+
+    ClockSample start{0, 0};
+    std::atomic<bool> closing{false};
+    std::atomic<bool> finished{false};
+};
+
+uint64_t Clock::CalibratingNowNs() {
+    static Calibrator calibrator;
+    calibrator.Advance();
+    return SteadyNowNs();
+}
+
+double Clock::GetTscFrequencyGHz() {
+    return IsTscEnabled() && s_Multiplier > 0 ? 4294967296.0 / static_cast<double>(s_Multiplier) : 0.0;
+}
+
+} // namespace Drift::Core
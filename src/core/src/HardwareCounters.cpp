@@ -0,0 +1,159 @@
+#include "Drift/Core/HardwareCounters.h"
+#include "Drift/Core/Clock.h"
+#include <atomic>
+#include <cerrno>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Drift::Core {
+
+#if defined(__linux__)
+
+namespace {
+
+struct CounterDesc {
+    uint32_t type;
+    uint64_t config;
+    bool required;      // Sem ciclos e instruções o grupo não serve para nada
+};
+
+constexpr uint64_t CacheConfig(uint64_t cache, uint64_t op, uint64_t result) {
+    return cache | (op << 8) | (result << 16);
+}
+
+// Na ordem de HardwareCounter
+const CounterDesc COUNTER_DESCS[HARDWARE_COUNTER_COUNT] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, true},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, true},
+    {PERF_TYPE_HW_CACHE, CacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS), false},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, false},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, false},
+};
+
+int OpenCounter(const CounterDesc& desc, int groupFd) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = desc.type;
+    attr.config = desc.config;
+    attr.disabled = groupFd == -1 ? 1 : 0;     // O líder liga o grupo inteiro no fim
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+}
+
+} // namespace
+
+HardwareCounterGroup::~HardwareCounterGroup() {
+    Close();
+}
+
+bool HardwareCounterGroup::Open() {
+    Close();
+
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    for (uint32_t i = 0; i < HARDWARE_COUNTER_COUNT; ++i) {
+        m_Fds[i] = OpenCounter(COUNTER_DESCS[i], m_Fds[0]);
+        if (m_Fds[i] == -1) {
+            if (COUNTER_DESCS[i].required) {
+                m_LastError = errno == EACCES || errno == EPERM
+                    ? "perf_event_open negado (veja /proc/sys/kernel/perf_event_paranoid)"
+                    : "PMU indisponível para perf_event_open (VM ou kernel sem suporte)";
+                Close();
+                return false;
+            }
+            continue; // Contador opcional sem suporte nesta CPU: fica em zero
+        }
+
+        // A página de metadados permite ler com rdpmc; sem ela a leitura usa read()
+        void* page = mmap(nullptr, static_cast<size_t>(pageSize), PROT_READ, MAP_SHARED, m_Fds[i], 0);
+        m_Pages[i] = page == MAP_FAILED ? nullptr : page;
+    }
+
+    ioctl(m_Fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_Fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    m_Open = true;
+    return true;
+}
+
+void HardwareCounterGroup::Close() {
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    for (uint32_t i = HARDWARE_COUNTER_COUNT; i-- > 0;) {
+        if (m_Pages[i]) {
+            munmap(m_Pages[i], static_cast<size_t>(pageSize));
+            m_Pages[i] = nullptr;
+        }
+        if (m_Fds[i] != -1) {
+            close(m_Fds[i]);
+            m_Fds[i] = -1;
+        }
+    }
+    m_Open = false;
+}
+
+uint64_t HardwareCounterGroup::ReadCounter(uint32_t index) const {
+    if (m_Fds[index] == -1) {
+        return 0;
+    }
+
+#if DRIFT_CLOCK_HAS_TSC
+    // Protocolo da página do perf: repete se o kernel trocou o contador no meio da leitura
+    if (const auto* page = static_cast<const volatile perf_event_mmap_page*>(m_Pages[index])) {
+        for (;;) {
+            uint32_t seq = page->lock;
+            std::atomic_signal_fence(std::memory_order_acquire);
+            uint32_t counterIndex = page->index;
+            if (!page->cap_user_rdpmc || counterIndex == 0) {
+                break; // rdpmc bloqueado ou contador fora da PMU agora
+            }
+            int64_t count = page->offset;
+            uint32_t width = page->pmc_width;
+            int64_t pmc = static_cast<int64_t>(__rdpmc(static_cast<int>(counterIndex - 1)));
+            pmc = static_cast<int64_t>(static_cast<uint64_t>(pmc) << (64 - width)) >> (64 - width);
+            count += pmc;
+            std::atomic_signal_fence(std::memory_order_acquire);
+            if (page->lock == seq) {
+                return static_cast<uint64_t>(count);
+            }
+        }
+    }
+#endif
+
+    uint64_t value = 0;
+    if (read(m_Fds[index], &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) {
+        return 0;
+    }
+    return value;
+}
+
+#else
+
+HardwareCounterGroup::~HardwareCounterGroup() = default;
+
+bool HardwareCounterGroup::Open() {
+    m_LastError = "contadores de hardware só estão disponíveis no Linux";
+    return false;
+}
+
+void HardwareCounterGroup::Close() {
+    m_Open = false;
+}
+
+uint64_t HardwareCounterGroup::ReadCounter(uint32_t) const {
+    return 0;
+}
+
+#endif
+
+void HardwareCounterGroup::Read(uint64_t values[HARDWARE_COUNTER_COUNT]) const {
+    for (uint32_t i = 0; i < HARDWARE_COUNTER_COUNT; ++i) {
+        values[i] = m_Open ? ReadCounter(i) : 0;
+    }
+}
+
+} // namespace Drift::Core
@@ -0,0 +1,245 @@
+#include "Drift/Core/IO/ArchiveFileSystem.h"
+#include "Drift/Core/Hash.h"
+#include "Drift/Core/Log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Drift::Core::IO {
+
+std::string NormalizeArchivePath(std::string_view path) {
+    std::string normalized(path);
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+
+    size_t start = 0;
+    while (true) {
+        if (normalized.compare(start, 2, "./") == 0) {
+            start += 2;
+        } else if (start < normalized.size() && normalized[start] == '/') {
+            start += 1;
+        } else {
+            break;
+        }
+    }
+
+    return normalized.substr(start);
+}
+
+uint64_t HashArchivePath(std::string_view normalizedPath) {
+    return Hash64(normalizedPath);
+}
+
+std::shared_ptr<ArchiveFileSystem> ArchiveFileSystem::Open(const std::string& archivePath, const ArchiveOpenOptions& options) {
+    auto file = MappedFile::Open(archivePath, options.accessHint);
+    if (!file) {
+        DRIFT_LOG_ERROR("[ArchiveFileSystem] Não foi possível abrir: " << archivePath);
+        return nullptr;
+    }
+
+    const size_t fileSize = file->GetSize();
+    if (fileSize < sizeof(DpakHeader)) {
+        DRIFT_LOG_ERROR("[ArchiveFileSystem] Arquivo muito pequeno: " << archivePath);
+        return nullptr;
+    }
+
+    DpakHeader header;
+    std::memcpy(&header, file->GetData(), sizeof(header));
+
+    if (header.magic != DPAK_MAGIC || header.version != DPAK_VERSION) {
+        DRIFT_LOG_ERROR("[ArchiveFileSystem] Cabeçalho inválido ou versão não suportada: " << archivePath);
+        return nullptr;
+    }
+
+    uint32_t storedHeaderCrc = header.headerCrc;
+    header.headerCrc = 0;
+    if (Crc32(&header, sizeof(header)) != storedHeaderCrc) {
+        DRIFT_LOG_ERROR("[ArchiveFileSystem] CRC do cabeçalho não confere: " << archivePath);
+        return nullptr;
+    }
+
+    const uint64_t expectedTocSize = static_cast<uint64_t>(header.entryCount) * sizeof(DpakEntry);
+    if (header.tocSize != expectedTocSize ||
+        header.tocOffset % alignof(DpakEntry) != 0 ||
+        header.tocOffset > fileSize || header.tocSize > fileSize - header.tocOffset ||
+        header.namesOffset > fileSize || header.namesSize > fileSize - header.namesOffset) {
+        DRIFT_LOG_ERROR("[ArchiveFileSystem] TOC fora dos limites: " << archivePath);
+        return nullptr;
+    }
+
+    const uint8_t* base = file->GetData();
+    uint32_t tocCrc = Crc32(base + header.tocOffset, static_cast<size_t>(header.tocSize));
+    tocCrc = Crc32(base + header.namesOffset, static_cast<size_t>(header.namesSize), tocCrc);
+    if (tocCrc != header.tocCrc) {
+        DRIFT_LOG_ERROR("[ArchiveFileSystem] CRC do TOC não confere: " << archivePath);
+        return nullptr;
+    }
+
+    std::shared_ptr<ArchiveFileSystem> archive(new ArchiveFileSystem());
+    archive->m_File = file;
+    archive->m_Options = options;
+    archive->m_Entries = reinterpret_cast<const DpakEntry*>(base + header.tocOffset);
+    archive->m_Names = reinterpret_cast<const char*>(base + header.namesOffset);
+    archive->m_EntryCount = header.entryCount;
+
+    // Valida limites de todas as entradas uma única vez
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        const DpakEntry& entry = archive->m_Entries[i];
+        if (entry.dataOffset > fileSize || entry.storedSize > fileSize - entry.dataOffset ||
+            static_cast<uint64_t>(entry.nameOffset) + entry.nameLength > header.namesSize ||
+            entry.compression > static_cast<uint8_t>(CompressionMethod::LZ4Block)) {
+            DRIFT_LOG_ERROR("[ArchiveFileSystem] Entrada corrompida no TOC: " << archivePath);
+            return nullptr;
+        }
+
+        // originalSize define a alocação na leitura: limita ao que os dados armazenados podem gerar
+        const bool compressed = entry.compression != static_cast<uint8_t>(CompressionMethod::None);
+        const uint64_t maxOriginalSize = compressed
+            ? FastCompression::GetMaxDecompressedSize(static_cast<size_t>(entry.storedSize))
+            : entry.storedSize;
+        if (compressed ? entry.originalSize > maxOriginalSize : entry.originalSize != entry.storedSize) {
+            DRIFT_LOG_ERROR("[ArchiveFileSystem] Tamanho original inválido no TOC: " << archivePath);
+            return nullptr;
+        }
+    }
+
+    DRIFT_LOG_INFO("[ArchiveFileSystem] Arquivo aberto: " << archivePath << " (" << header.entryCount << " entradas)");
+    return archive;
+}
+
+std::string_view ArchiveFileSystem::GetEntryName(const DpakEntry& entry) const {
+    return std::string_view(m_Names + entry.nameOffset, entry.nameLength);
+}
+
+const DpakEntry* ArchiveFileSystem::FindEntry(std::string_view path) const {
+    // Caminho já normalizado evita alocação no caminho comum
+    std::string normalizedStorage;
+    if (path.find('\\') != std::string_view::npos || (!path.empty() && (path[0] == '/' || path[0] == '.'))) {
+        normalizedStorage = NormalizeArchivePath(path);
+        path = normalizedStorage;
+    }
+
+    const uint64_t hash = HashArchivePath(path);
+    const DpakEntry* first = m_Entries;
+    const DpakEntry* last = m_Entries + m_EntryCount;
+
+    auto it = std::lower_bound(first, last, hash,
+        [](const DpakEntry& entry, uint64_t value) { return entry.pathHash < value; });
+
+    // Colisões de hash: compara nomes entre entradas com o mesmo hash
+    for (; it != last && it->pathHash == hash; ++it) {
+        if (GetEntryName(*it) == path) {
+            return it;
+        }
+    }
+
+    return nullptr;
+}
+
+bool ArchiveFileSystem::Exists(std::string_view path) const {
+    return FindEntry(path) != nullptr;
+}
+
+bool ArchiveFileSystem::GetEntryInfo(std::string_view path, ArchiveEntryInfo& info) const {
+    const DpakEntry* entry = FindEntry(path);
+    if (!entry) {
+        return false;
+    }
+
+    info.path = std::string(GetEntryName(*entry));
+    info.originalSize = entry->originalSize;
+    info.storedSize = entry->storedSize;
+    info.dataOffset = entry->dataOffset;
+    info.compression = static_cast<CompressionMethod>(entry->compression);
+    info.crc32 = entry->crc32;
+    return true;
+}
+
+std::vector<ArchiveEntryInfo> ArchiveFileSystem::ListEntries() const {
+    std::vector<ArchiveEntryInfo> entries;
+    entries.reserve(m_EntryCount);
+
+    for (uint32_t i = 0; i < m_EntryCount; ++i) {
+        const DpakEntry& entry = m_Entries[i];
+        ArchiveEntryInfo info;
+        info.path = std::string(GetEntryName(entry));
+        info.originalSize = entry.originalSize;
+        info.storedSize = entry.storedSize;
+        info.dataOffset = entry.dataOffset;
+        info.compression = static_cast<CompressionMethod>(entry.compression);
+        info.crc32 = entry.crc32;
+        entries.push_back(std::move(info));
+    }
+
+    // Ordem física no arquivo (útil para leituras sequenciais)
+    std::sort(entries.begin(), entries.end(),
+        [](const ArchiveEntryInfo& a, const ArchiveEntryInfo& b) { return a.dataOffset < b.dataOffset; });
+
+    return entries;
+}
+
+FileView ArchiveFileSystem::Read(std::string_view path) const {
+    const DpakEntry* entry = FindEntry(path);
+    if (!entry) {
+        return FileView{};
+    }
+    return ReadEntry(*entry, m_Options.verifyCrcOnRead);
+}
+
+FileView ArchiveFileSystem::ReadEntry(const DpakEntry& entry, bool verifyCrc) const {
+    // Entrada vazia: visão válida de 0 bytes (GetView com tamanho 0 significaria "até o fim")
+    if (entry.originalSize == 0) {
+        if (verifyCrc && entry.crc32 != Crc32(nullptr, 0)) {
+            DRIFT_LOG_ERROR("[ArchiveFileSystem] CRC não confere: " << GetEntryName(entry));
+            return FileView{};
+        }
+        return FileView(m_File->GetData() + entry.dataOffset, 0, m_File, m_File.get());
+    }
+
+    FileView stored = m_File->GetView(static_cast<size_t>(entry.dataOffset), static_cast<size_t>(entry.storedSize));
+
+    if (static_cast<CompressionMethod>(entry.compression) == CompressionMethod::None) {
+        if (verifyCrc && Crc32(stored.data, stored.size) != entry.crc32) {
+            DRIFT_LOG_ERROR("[ArchiveFileSystem] CRC não confere: " << std::string(GetEntryName(entry)));
+            return FileView{};
+        }
+        return stored;
+    }
+
+    std::vector<uint8_t> buffer(static_cast<size_t>(entry.originalSize));
+    if (!FastCompression::Decompress(stored.data, stored.size, buffer.data(), buffer.size())) {
+        DRIFT_LOG_ERROR("[ArchiveFileSystem] Falha ao descomprimir: " << std::string(GetEntryName(entry)));
+        return FileView{};
+    }
+
+    // Os dados comprimidos não são mais necessários no working set
+    stored.Advise(MapAccessHint::DontNeed);
+
+    if (verifyCrc && Crc32(buffer.data(), buffer.size()) != entry.crc32) {
+        DRIFT_LOG_ERROR("[ArchiveFileSystem] CRC não confere: " << std::string(GetEntryName(entry)));
+        return FileView{};
+    }
+
+    return FileView::FromBuffer(std::move(buffer));
+}
+
+void ArchiveFileSystem::Prefetch(std::string_view path) const {
+    if (const DpakEntry* entry = FindEntry(path)) {
+        m_File->Advise(MapAccessHint::WillNeed, static_cast<size_t>(entry->dataOffset), static_cast<size_t>(entry->storedSize));
+    }
+}
+
+bool ArchiveFileSystem::VerifyEntry(std::string_view path) const {
+    const DpakEntry* entry = FindEntry(path);
+    return entry && ReadEntry(*entry, true).IsValid();
+}
+
+bool ArchiveFileSystem::VerifyAll() const {
+    bool ok = true;
+    for (uint32_t i = 0; i < m_EntryCount; ++i) {
+        if (!ReadEntry(m_Entries[i], true).IsValid()) {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+} // namespace Drift::Core::IO
@@ -0,0 +1,203 @@
+#include "Drift/Core/IO/ArchiveWriter.h"
+#include "Drift/Core/Hash.h"
+#include "Drift/Core/Log.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Drift::Core::IO {
+
+namespace {
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+}
+
+bool WritePadding(std::ofstream& out, uint64_t count) {
+    static const char zeros[4096] = {};
+    while (count > 0) {
+        size_t chunk = static_cast<size_t>(std::min<uint64_t>(count, sizeof(zeros)));
+        out.write(zeros, chunk);
+        count -= chunk;
+    }
+    return out.good();
+}
+
+} // namespace
+
+ArchiveWriter::ArchiveWriter(const ArchiveWriterConfig& config)
+    : m_Config(config) {
+}
+
+bool ArchiveWriter::HasEntry(const std::string& normalizedPath) const {
+    return std::any_of(m_Pending.begin(), m_Pending.end(),
+        [&](const PendingEntry& entry) { return entry.path == normalizedPath; });
+}
+
+bool ArchiveWriter::AddFile(const std::string& archivePath, const std::string& sourcePath) {
+    std::string path = NormalizeArchivePath(archivePath);
+    if (path.empty() || HasEntry(path)) {
+        DRIFT_LOG_ERROR("[ArchiveWriter] Caminho inválido ou duplicado: " << archivePath);
+        return false;
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(sourcePath, ec)) {
+        DRIFT_LOG_ERROR("[ArchiveWriter] Arquivo não encontrado: " << sourcePath);
+        return false;
+    }
+
+    // O conteúdo só é lido durante Write() para manter o pico de memória baixo
+    m_Pending.push_back({path, sourcePath, {}});
+    return true;
+}
+
+bool ArchiveWriter::AddData(const std::string& archivePath, std::vector<uint8_t> data) {
+    std::string path = NormalizeArchivePath(archivePath);
+    if (path.empty() || HasEntry(path)) {
+        DRIFT_LOG_ERROR("[ArchiveWriter] Caminho inválido ou duplicado: " << archivePath);
+        return false;
+    }
+
+    m_Pending.push_back({path, std::string(), std::move(data)});
+    return true;
+}
+
+bool ArchiveWriter::Write(const std::string& outputPath) {
+    m_Stats = Stats{};
+
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        DRIFT_LOG_ERROR("[ArchiveWriter] Não foi possível criar: " << outputPath);
+        return false;
+    }
+
+    // Ordem física por caminho: diretórios ficam contíguos no disco
+    std::sort(m_Pending.begin(), m_Pending.end(),
+        [](const PendingEntry& a, const PendingEntry& b) { return a.path < b.path; });
+
+    // Reserva espaço para o cabeçalho (gravado no final)
+    DpakHeader header{};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    uint64_t offset = sizeof(header);
+
+    std::vector<DpakEntry> toc;
+    toc.reserve(m_Pending.size());
+    std::string names;
+
+    for (auto& pending : m_Pending) {
+        FileView source;
+        std::shared_ptr<MappedFile> mapped;
+        if (!pending.sourcePath.empty()) {
+            mapped = MappedFile::Open(pending.sourcePath, MapAccessHint::Sequential);
+            if (!mapped) {
+                DRIFT_LOG_ERROR("[ArchiveWriter] Falha ao ler: " << pending.sourcePath);
+                return false;
+            }
+            source = mapped->GetView();
+        } else {
+            source = FileView(pending.data.data(), pending.data.size());
+        }
+
+        DpakEntry entry{};
+        entry.pathHash = HashArchivePath(pending.path);
+        entry.originalSize = source.size;
+        entry.crc32 = Crc32(source.data, source.size);
+        entry.nameOffset = static_cast<uint32_t>(names.size());
+        entry.nameLength = static_cast<uint32_t>(pending.path.size());
+        entry.compression = static_cast<uint8_t>(CompressionMethod::None);
+        names += pending.path;
+
+        const uint8_t* payload = source.data;
+        size_t payloadSize = source.size;
+        std::vector<uint8_t> compressed;
+
+        if (m_Config.enableCompression && source.size > 0) {
+            compressed = FastCompression::Compress(source.data, source.size);
+            double limit = static_cast<double>(source.size) * (1.0 - m_Config.minCompressionGain);
+            if (!compressed.empty() && static_cast<double>(compressed.size()) <= limit) {
+                payload = compressed.data();
+                payloadSize = compressed.size();
+                entry.compression = static_cast<uint8_t>(CompressionMethod::LZ4Block);
+                m_Stats.compressedEntries++;
+            }
+        }
+
+        uint64_t alignment = payloadSize >= m_Config.largeEntryThreshold ? m_Config.largeAlignment : m_Config.alignment;
+        uint64_t aligned = AlignUp(offset, alignment);
+        if (!WritePadding(out, aligned - offset)) {
+            DRIFT_LOG_ERROR("[ArchiveWriter] Falha de escrita: " << outputPath);
+            return false;
+        }
+        m_Stats.paddingBytes += aligned - offset;
+        offset = aligned;
+
+        entry.dataOffset = offset;
+        entry.storedSize = payloadSize;
+        if (payloadSize > 0) {
+            out.write(reinterpret_cast<const char*>(payload), static_cast<std::streamsize>(payloadSize));
+        }
+        offset += payloadSize;
+
+        m_Stats.originalBytes += source.size;
+        m_Stats.storedBytes += payloadSize;
+        toc.push_back(entry);
+
+        // Libera dados em memória assim que gravados
+        std::vector<uint8_t>().swap(pending.data);
+    }
+
+    // Tabela de nomes
+    header.namesOffset = offset;
+    header.namesSize = names.size();
+    out.write(names.data(), static_cast<std::streamsize>(names.size()));
+    offset += names.size();
+
+    // TOC ordenado por (hash, nome) e alinhado para acesso direto no mapeamento
+    std::sort(toc.begin(), toc.end(), [&](const DpakEntry& a, const DpakEntry& b) {
+        if (a.pathHash != b.pathHash) {
+            return a.pathHash < b.pathHash;
+        }
+        return names.compare(a.nameOffset, a.nameLength, names, b.nameOffset, b.nameLength) < 0;
+    });
+
+    uint64_t tocOffset = AlignUp(offset, alignof(DpakEntry));
+    if (!WritePadding(out, tocOffset - offset)) {
+        DRIFT_LOG_ERROR("[ArchiveWriter] Falha de escrita: " << outputPath);
+        return false;
+    }
+    offset = tocOffset;
+
+    header.tocOffset = tocOffset;
+    header.tocSize = toc.size() * sizeof(DpakEntry);
+    out.write(reinterpret_cast<const char*>(toc.data()), static_cast<std::streamsize>(header.tocSize));
+    offset += header.tocSize;
+
+    header.magic = DPAK_MAGIC;
+    header.version = DPAK_VERSION;
+    header.entryCount = static_cast<uint32_t>(toc.size());
+    header.flags = 0;
+    header.alignment = m_Config.alignment;
+    header.tocCrc = Crc32(toc.data(), static_cast<size_t>(header.tocSize));
+    header.tocCrc = Crc32(names.data(), names.size(), header.tocCrc);
+    header.headerCrc = 0;
+    header.headerCrc = Crc32(&header, sizeof(header));
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+
+    if (!out) {
+        DRIFT_LOG_ERROR("[ArchiveWriter] Falha de escrita: " << outputPath);
+        return false;
+    }
+
+    m_Stats.entryCount = toc.size();
+    m_Stats.archiveSize = offset;
+
+    DRIFT_LOG_INFO("[ArchiveWriter] Arquivo gerado: " << outputPath << " (" << toc.size() << " entradas)");
+    return true;
+}
+
+} // namespace Drift::Core::IO
@@ -0,0 +1,794 @@
+#include "Drift/Core/IO/AsyncIO.h"
+#include "Drift/Core/Log.h"
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <filesystem>
+#include <thread>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define DRIFT_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#else
+#define DRIFT_HAS_IO_URING 0
+#endif
+
+namespace Drift::Core::IO {
+
+namespace {
+
+// Descritor de arquivo compartilhado pelas leituras de um lote
+struct OpenFile {
+#ifdef _WIN32
+    HANDLE handle = INVALID_HANDLE_VALUE;
+    ~OpenFile() { if (handle != INVALID_HANDLE_VALUE) CloseHandle(handle); }
+#else
+    int fd = -1;
+    ~OpenFile() { if (fd >= 0) close(fd); }
+#endif
+    uint64_t size = 0;
+};
+
+std::shared_ptr<OpenFile> OpenForRead(const std::string& path, int& error) {
+    auto file = std::make_shared<OpenFile>();
+#ifdef _WIN32
+    std::wstring widePath = std::filesystem::u8path(path).wstring();
+    file->handle = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                               OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file->handle == INVALID_HANDLE_VALUE) {
+        error = ENOENT;
+        return nullptr;
+    }
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file->handle, &fileSize)) {
+        error = EIO;
+        return nullptr;
+    }
+    file->size = static_cast<uint64_t>(fileSize.QuadPart);
+#else
+    file->fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file->fd < 0) {
+        error = errno;
+        return nullptr;
+    }
+    struct stat st {};
+    if (fstat(file->fd, &st) != 0) {
+        error = errno;
+        return nullptr;
+    }
+    file->size = static_cast<uint64_t>(st.st_size);
+#endif
+    return file;
+}
+
+// Tamanho efetivo do pedido, limitado ao fim do arquivo
+uint64_t ResolveReadSize(const AsyncReadRequest& request, uint64_t fileSize) {
+    if (request.offset >= fileSize) {
+        return 0;
+    }
+    uint64_t available = fileSize - request.offset;
+    return request.size == 0 ? available : std::min(request.size, available);
+}
+
+// Abre cada arquivo uma única vez por lote
+class FileCache {
+public:
+    std::shared_ptr<OpenFile> Get(const std::string& path, int& error) {
+        auto it = m_Files.find(path);
+        if (it != m_Files.end()) {
+            error = it->second.error;
+            return it->second.file;
+        }
+        Entry entry;
+        entry.file = OpenForRead(path, entry.error);
+        error = entry.error;
+        return m_Files.emplace(path, std::move(entry)).first->second.file;
+    }
+
+private:
+    struct Entry {
+        std::shared_ptr<OpenFile> file;
+        int error = 0;
+    };
+    std::unordered_map<std::string, Entry> m_Files;
+};
+
+} // namespace
+
+/**
+ * @brief Base dos backends: fila de pedidos compartilhada
+ */
+class AsyncIO::Backend {
+public:
+    explicit Backend(AsyncIO& owner) : m_Owner(owner) {}
+    virtual ~Backend() = default;
+
+    virtual bool Start(const AsyncIOConfig& config) = 0;
+    virtual void Stop() = 0;
+
+    bool Enqueue(std::vector<AsyncReadRequest>&& requests) {
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            if (m_Stopping) {
+                return false;
+            }
+            for (auto& request : requests) {
+                m_Queue.push_back(std::move(request));
+            }
+        }
+        Wake();
+        return true;
+    }
+
+protected:
+    virtual void Wake() = 0;
+
+    // Retira até maxCount pedidos ordenados por arquivo e offset (chamar com m_QueueMutex)
+    std::vector<AsyncReadRequest> TakeBatchLocked(size_t maxCount) {
+        std::vector<AsyncReadRequest> batch;
+        if (m_Queue.empty() || maxCount == 0) {
+            return batch;
+        }
+
+        if (m_Queue.size() <= maxCount) {
+            batch.swap(m_Queue);
+        } else {
+            batch.assign(std::make_move_iterator(m_Queue.begin()),
+                         std::make_move_iterator(m_Queue.begin() + maxCount));
+            m_Queue.erase(m_Queue.begin(), m_Queue.begin() + maxCount);
+        }
+
+        std::sort(batch.begin(), batch.end(), [](const AsyncReadRequest& a, const AsyncReadRequest& b) {
+            if (a.path != b.path) {
+                return a.path < b.path;
+            }
+            return a.offset < b.offset;
+        });
+
+        m_Owner.m_Batches++;
+        return batch;
+    }
+
+    void Complete(AsyncReadRequest& request, AsyncReadResult&& result) {
+        m_Owner.Complete(request, std::move(result));
+    }
+
+    void Fail(AsyncReadRequest& request, int error) {
+        AsyncReadResult result;
+        result.path = request.path;
+        result.offset = request.offset;
+        result.error = error;
+        Complete(request, std::move(result));
+    }
+
+    void Succeed(AsyncReadRequest& request, std::vector<uint8_t>&& buffer) {
+        AsyncReadResult result;
+        result.path = request.path;
+        result.offset = request.offset;
+        result.data = FileView::FromBuffer(std::move(buffer));
+        Complete(request, std::move(result));
+    }
+
+    AsyncIO& m_Owner;
+    std::mutex m_QueueMutex;
+    std::vector<AsyncReadRequest> m_Queue;
+    bool m_Stopping = false;
+};
+
+namespace {
+
+/**
+ * @brief Backend de fallback: threads fazendo pread em lotes ordenados
+ */
+class ThreadPoolBackend final : public AsyncIO::Backend {
+public:
+    using Backend::Backend;
+
+    ~ThreadPoolBackend() override { Stop(); }
+
+    bool Start(const AsyncIOConfig& config) override {
+        size_t threadCount = std::max<uint32_t>(1, config.fallbackThreads);
+        for (size_t i = 0; i < threadCount; ++i) {
+            m_Threads.emplace_back(&ThreadPoolBackend::WorkerLoop, this);
+        }
+        return true;
+    }
+
+    void Stop() override {
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_Stopping = true;
+        }
+        m_Condition.notify_all();
+        for (auto& thread : m_Threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        m_Threads.clear();
+    }
+
+protected:
+    void Wake() override {
+        m_Condition.notify_one();
+    }
+
+private:
+    static constexpr size_t kBatchSize = 64;
+
+    void WorkerLoop() {
+        while (true) {
+            std::vector<AsyncReadRequest> batch;
+            {
+                std::unique_lock<std::mutex> lock(m_QueueMutex);
+                m_Condition.wait(lock, [this] { return m_Stopping || !m_Queue.empty(); });
+                if (m_Queue.empty()) {
+                    return;     // Parando e sem pedidos pendentes
+                }
+                batch = TakeBatchLocked(kBatchSize);
+            }
+
+            FileCache files;
+            for (auto& request : batch) {
+                int error = 0;
+                auto file = files.Get(request.path, error);
+                if (!file) {
+                    Fail(request, error);
+                    continue;
+                }
+
+                std::vector<uint8_t> buffer(static_cast<size_t>(ResolveReadSize(request, file->size)));
+                if (!ReadRange(*file, request.offset, buffer, error)) {
+                    Fail(request, error);
+                    continue;
+                }
+                Succeed(request, std::move(buffer));
+            }
+        }
+    }
+
+    static bool ReadRange(const OpenFile& file, uint64_t offset, std::vector<uint8_t>& buffer, int& error) {
+        size_t done = 0;
+        while (done < buffer.size()) {
+#ifdef _WIN32
+            OVERLAPPED overlapped{};
+            uint64_t position = offset + done;
+            overlapped.Offset = static_cast<DWORD>(position & 0xFFFFFFFFull);
+            overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+            DWORD chunk = static_cast<DWORD>(std::min<size_t>(buffer.size() - done, 1u << 30));
+            DWORD bytesRead = 0;
+            if (!ReadFile(file.handle, buffer.data() + done, chunk, &bytesRead, &overlapped)) {
+                error = EIO;
+                return false;
+            }
+            if (bytesRead == 0) {
+                break;
+            }
+            done += bytesRead;
+#else
+            ssize_t result = pread(file.fd, buffer.data() + done, buffer.size() - done,
+                                   static_cast<off_t>(offset + done));
+            if (result < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                error = errno;
+                return false;
+            }
+            if (result == 0) {
+                break;      // Arquivo encolheu
+            }
+            done += static_cast<size_t>(result);
+#endif
+        }
+        buffer.resize(done);
+        return true;
+    }
+
+    std::condition_variable m_Condition;
+    std::vector<std::thread> m_Threads;
+};
+
+#if DRIFT_HAS_IO_URING
+
+/**
+ * @brief Backend io_uring: uma thread de IO mantém até queueDepth leituras em voo
+ *
+ * A thread bloqueia apenas em io_uring_enter; novos pedidos a acordam por meio de
+ * uma leitura pendente em um eventfd dentro do próprio anel.
+ */
+class IoUringBackend final : public AsyncIO::Backend {
+public:
+    using Backend::Backend;
+
+    ~IoUringBackend() override {
+        Stop();
+        if (m_SqRing && m_SqRing != MAP_FAILED) munmap(m_SqRing, m_SqRingSize);
+        if (m_CqRing && m_CqRing != MAP_FAILED && m_CqRing != m_SqRing) munmap(m_CqRing, m_CqRingSize);
+        if (m_Sqes && m_Sqes != MAP_FAILED) munmap(m_Sqes, m_SqesSize);
+        if (m_RingFd >= 0) close(m_RingFd);
+        if (m_WakeFd >= 0) close(m_WakeFd);
+    }
+
+    bool Start(const AsyncIOConfig& config) override {
+        io_uring_params params{};
+        m_RingFd = static_cast<int>(syscall(__NR_io_uring_setup, std::max<uint32_t>(config.queueDepth, 2), &params));
+        if (m_RingFd < 0) {
+            DRIFT_LOG_WARNING("[AsyncIO] io_uring indisponível (errno " << errno << ")");
+            return false;
+        }
+
+        m_SqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_CqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMmap) {
+            m_SqRingSize = m_CqRingSize = std::max(m_SqRingSize, m_CqRingSize);
+        }
+
+        m_SqRing = mmap(nullptr, m_SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, IORING_OFF_SQ_RING);
+        if (m_SqRing == MAP_FAILED) {
+            return false;
+        }
+        m_CqRing = singleMmap ? m_SqRing
+                              : mmap(nullptr, m_CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, IORING_OFF_CQ_RING);
+        if (m_CqRing == MAP_FAILED) {
+            return false;
+        }
+        m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        m_Sqes = mmap(nullptr, m_SqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_RingFd, IORING_OFF_SQES);
+        if (m_Sqes == MAP_FAILED) {
+            return false;
+        }
+
+        auto* sq = static_cast<uint8_t*>(m_SqRing);
+        m_SqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        m_SqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        m_SqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        m_SqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+        auto* cq = static_cast<uint8_t*>(m_CqRing);
+        m_CqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        m_CqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        m_CqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        m_Cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        // Uma entrada fica reservada para a leitura do eventfd
+        m_SqEntries = params.sq_entries;
+        m_Capacity = params.sq_entries - 1;
+
+        m_WakeFd = eventfd(0, EFD_CLOEXEC);
+        if (m_WakeFd < 0) {
+            return false;
+        }
+
+        m_Thread = std::thread(&IoUringBackend::IoLoop, this);
+        return true;
+    }
+
+    void Stop() override {
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_Stopping = true;
+        }
+        if (m_Thread.joinable()) {
+            Wake();
+            m_Thread.join();
+        }
+    }
+
+protected:
+    void Wake() override {
+        uint64_t one = 1;
+        ssize_t written = write(m_WakeFd, &one, sizeof(one));
+        (void)written;
+    }
+
+private:
+    static constexpr uint64_t kWakeTag = ~0ull;
+    static constexpr uint64_t kCancelTag = ~0ull - 1;
+
+    // Destino da leitura do eventfd; vazado junto com as operações se o anel não puder ser drenado
+    struct WakeSlot {
+        uint64_t value = 0;
+        iovec iov{};
+    };
+
+    struct Operation {
+        AsyncReadRequest request;
+        std::shared_ptr<OpenFile> file;
+        std::vector<uint8_t> buffer;
+        size_t done = 0;
+        iovec iov{};
+    };
+
+    io_uring_sqe& PushSqe(uint8_t opcode, int fd, uint64_t userData) {
+        unsigned tail = *m_SqTail;
+        unsigned index = tail & m_SqMask;
+        io_uring_sqe& sqe = static_cast<io_uring_sqe*>(m_Sqes)[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = opcode;
+        sqe.fd = fd;
+        sqe.user_data = userData;
+        m_SqArray[index] = index;
+        __atomic_store_n(m_SqTail, tail + 1, __ATOMIC_RELEASE);
+        m_ToSubmit++;
+        return sqe;
+    }
+
+    void PushReadv(int fd, iovec* iov, uint64_t offset, uint64_t userData) {
+        io_uring_sqe& sqe = PushSqe(IORING_OP_READV, fd, userData);     // READV: disponível desde o kernel 5.1
+        sqe.addr = reinterpret_cast<uint64_t>(iov);
+        sqe.len = 1;
+        sqe.off = offset;
+    }
+
+    // ASYNC_CANCEL (kernel 5.5+); em kernels antigos a CQE volta com -EINVAL e a leitura
+    // simplesmente termina sozinha
+    void PushCancel(uint64_t target) {
+        io_uring_sqe& sqe = PushSqe(IORING_OP_ASYNC_CANCEL, -1, kCancelTag);
+        sqe.addr = target;
+    }
+
+    // Garante uma entrada livre na SQ, submetendo o que estiver acumulado se preciso
+    bool ReserveSqe() {
+        if (*m_SqTail - __atomic_load_n(m_SqHead, __ATOMIC_ACQUIRE) < m_SqEntries) {
+            return true;
+        }
+        int entered = static_cast<int>(syscall(__NR_io_uring_enter, m_RingFd, m_ToSubmit, 0, 0, nullptr, 0));
+        if (entered > 0) {
+            m_ToSubmit -= std::min<unsigned>(m_ToSubmit, static_cast<unsigned>(entered));
+        }
+        return *m_SqTail - __atomic_load_n(m_SqHead, __ATOMIC_ACQUIRE) < m_SqEntries;
+    }
+
+    static bool IsTransientEnterError(int error) {
+        return error == EINTR || error == EAGAIN || error == EBUSY;
+    }
+
+    void SubmitOperation(uint64_t id, Operation& op) {
+        op.iov.iov_base = op.buffer.data() + op.done;
+        op.iov.iov_len = op.buffer.size() - op.done;
+        PushReadv(op.file->fd, &op.iov, op.request.offset + op.done, id);
+    }
+
+    void IoLoop() {
+        bool wakeArmed = false;
+
+        while (true) {
+            if (!wakeArmed) {
+                m_Wake->iov.iov_base = &m_Wake->value;
+                m_Wake->iov.iov_len = sizeof(m_Wake->value);
+                PushReadv(m_WakeFd, &m_Wake->iov, 0, kWakeTag);
+                wakeArmed = true;
+            }
+
+            std::vector<AsyncReadRequest> batch;
+            bool stopping = false;
+            {
+                std::lock_guard<std::mutex> lock(m_QueueMutex);
+                batch = TakeBatchLocked(m_Capacity - m_Operations.size());
+                stopping = m_Stopping && m_Queue.empty();
+            }
+
+            FileCache files;
+            for (auto& request : batch) {
+                int error = 0;
+                auto file = files.Get(request.path, error);
+                if (!file) {
+                    Fail(request, error);
+                    continue;
+                }
+
+                auto op = std::make_unique<Operation>();
+                op->buffer.resize(static_cast<size_t>(ResolveReadSize(request, file->size)));
+                if (op->buffer.empty()) {
+                    Succeed(request, std::move(op->buffer));
+                    continue;
+                }
+                op->request = std::move(request);
+                op->file = std::move(file);
+
+                uint64_t id = m_NextId++;
+                SubmitOperation(id, *op);
+                m_Operations.emplace(id, std::move(op));
+            }
+
+            if (stopping && m_Operations.empty()) {
+                break;
+            }
+
+            int entered = static_cast<int>(syscall(__NR_io_uring_enter, m_RingFd, m_ToSubmit, 1,
+                                                   IORING_ENTER_GETEVENTS, nullptr, 0));
+            if (entered < 0) {
+                if (IsTransientEnterError(errno)) {
+                    ReapCompletions(wakeArmed);     // EBUSY: a CQ cheia só esvazia consumindo
+                    continue;
+                }
+                DRIFT_LOG_ERROR("[AsyncIO] io_uring_enter falhou (errno " << errno << ")");
+                break;
+            }
+            m_ToSubmit -= std::min<unsigned>(m_ToSubmit, static_cast<unsigned>(entered));
+
+            ReapCompletions(wakeArmed);
+        }
+
+        // Nenhuma leitura pode seguir em voo: o kernel escreveria em buffers já liberados
+        DrainInFlight(wakeArmed);
+
+        std::vector<AsyncReadRequest> remaining;
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_Stopping = true;
+            remaining.swap(m_Queue);
+        }
+        for (auto& request : remaining) {
+            Fail(request, EIO);
+        }
+    }
+
+    /**
+     * Cancela as leituras em voo e espera a CQE de cada uma (e a do eventfd) antes de liberar
+     * os buffers. Se o anel não responder mais, as operações são entregues como erro e seus
+     * buffers vazados de propósito: memória perdida é melhor que o kernel escrevendo em memória
+     * reutilizada.
+     */
+    void DrainInFlight(bool& wakeArmed) {
+        m_Draining = true;
+        bool drained = true;
+
+        for (const auto& [id, op] : m_Operations) {
+            if (!ReserveSqe()) {
+                drained = false;
+                break;
+            }
+            PushCancel(id);
+        }
+        if (wakeArmed) {
+            Wake();
+        }
+
+        while (drained && (!m_Operations.empty() || wakeArmed)) {
+            int entered = static_cast<int>(syscall(__NR_io_uring_enter, m_RingFd, m_ToSubmit, 1,
+                                                   IORING_ENTER_GETEVENTS, nullptr, 0));
+            if (entered < 0 && !IsTransientEnterError(errno)) {
+                drained = false;
+                break;
+            }
+            if (entered > 0) {
+                m_ToSubmit -= std::min<unsigned>(m_ToSubmit, static_cast<unsigned>(entered));
+            }
+            ReapCompletions(wakeArmed);
+        }
+
+        if (!drained) {
+            DRIFT_LOG_ERROR("[AsyncIO] Não foi possível drenar o io_uring; " << m_Operations.size()
+                            << " leituras abandonadas com seus buffers");
+            for (auto& [id, op] : m_Operations) {
+                Fail(op->request, EIO);
+                op.release();
+            }
+            m_Operations.clear();
+            if (wakeArmed) {
+                m_Wake.release();
+            }
+        }
+    }
+
+    void ReapCompletions(bool& wakeArmed) {
+        unsigned head = *m_CqHead;
+        unsigned tail = __atomic_load_n(m_CqTail, __ATOMIC_ACQUIRE);
+
+        while (head != tail) {
+            const io_uring_cqe cqe = m_Cqes[head & m_CqMask];
+            head++;
+
+            if (cqe.user_data == kWakeTag) {
+                wakeArmed = false;
+                continue;
+            }
+            if (cqe.user_data == kCancelTag) {
+                continue;
+            }
+
+            auto it = m_Operations.find(cqe.user_data);
+            if (it == m_Operations.end()) {
+                continue;
+            }
+            Operation& op = *it->second;
+
+            if (!m_Draining && (cqe.res == -EINTR || cqe.res == -EAGAIN)) {
+                SubmitOperation(it->first, op);
+                continue;
+            }
+            if (cqe.res < 0) {
+                Fail(op.request, -cqe.res);
+                m_Operations.erase(it);
+                continue;
+            }
+
+            op.done += static_cast<size_t>(cqe.res);
+            if (cqe.res > 0 && op.done < op.buffer.size()) {
+                if (m_Draining) {
+                    Fail(op.request, ECANCELED);
+                    m_Operations.erase(it);
+                } else {
+                    SubmitOperation(it->first, op);     // Leitura parcial: continua de onde parou
+                }
+                continue;
+            }
+
+            op.buffer.resize(op.done);
+            Succeed(op.request, std::move(op.buffer));
+            m_Operations.erase(it);
+        }
+
+        __atomic_store_n(m_CqHead, head, __ATOMIC_RELEASE);
+    }
+
+    int m_RingFd = -1;
+    int m_WakeFd = -1;
+    void* m_SqRing = nullptr;
+    void* m_CqRing = nullptr;
+    void* m_Sqes = nullptr;
+    size_t m_SqRingSize = 0;
+    size_t m_CqRingSize = 0;
+    size_t m_SqesSize = 0;
+
+    unsigned* m_SqHead = nullptr;
+    unsigned* m_SqTail = nullptr;
+    unsigned* m_SqArray = nullptr;
+    unsigned m_SqMask = 0;
+    unsigned* m_CqHead = nullptr;
+    unsigned* m_CqTail = nullptr;
+    unsigned m_CqMask = 0;
+    io_uring_cqe* m_Cqes = nullptr;
+
+    unsigned m_SqEntries = 0;
+    size_t m_Capacity = 0;
+    unsigned m_ToSubmit = 0;
+    uint64_t m_NextId = 0;
+    bool m_Draining = false;
+    std::unique_ptr<WakeSlot> m_Wake = std::make_unique<WakeSlot>();
+    std::unordered_map<uint64_t, std::unique_ptr<Operation>> m_Operations;
+    std::thread m_Thread;
+};
+
+#endif // DRIFT_HAS_IO_URING
+
+const char* BackendName(AsyncIOBackend backend) {
+    return backend == AsyncIOBackend::IoUring ? "io_uring" : "ThreadPool (pread)";
+}
+
+} // namespace
+
+AsyncIO& AsyncIO::GetInstance() {
+    static AsyncIO instance;
+    return instance;
+}
+
+AsyncIO::~AsyncIO() {
+    Shutdown();
+}
+
+bool AsyncIO::Initialize(const AsyncIOConfig& config) {
+    std::lock_guard<std::mutex> lock(m_LifecycleMutex);
+    if (m_Initialized.load()) {
+        DRIFT_LOG_WARNING("[AsyncIO] Sistema já inicializado");
+        return true;
+    }
+
+#if DRIFT_HAS_IO_URING
+    if (config.backend != AsyncIOBackend::ThreadPool) {
+        auto backend = std::make_unique<IoUringBackend>(*this);
+        if (backend->Start(config)) {
+            m_Backend = std::move(backend);
+            m_ActiveBackend = AsyncIOBackend::IoUring;
+        }
+    }
+#endif
+
+    if (!m_Backend) {
+        if (config.backend == AsyncIOBackend::IoUring) {
+            DRIFT_LOG_WARNING("[AsyncIO] io_uring solicitado mas indisponível, usando ThreadPool");
+        }
+        auto backend = std::make_unique<ThreadPoolBackend>(*this);
+        if (!backend->Start(config)) {
+            DRIFT_LOG_ERROR("[AsyncIO] Falha ao iniciar backend ThreadPool");
+            return false;
+        }
+        m_Backend = std::move(backend);
+        m_ActiveBackend = AsyncIOBackend::ThreadPool;
+    }
+
+    m_Initialized = true;
+    DRIFT_LOG_INFO("[AsyncIO] Sistema inicializado - backend: " << BackendName(m_ActiveBackend));
+    return true;
+}
+
+void AsyncIO::Shutdown() {
+    // O lock espera as submissões em andamento; depois dele nenhuma nova chega ao backend.
+    // Stop() roda fora do lock porque callbacks na thread de IO podem submeter.
+    std::unique_ptr<Backend> backend;
+    {
+        std::lock_guard<std::mutex> lock(m_LifecycleMutex);
+        if (!m_Initialized.load()) {
+            return;
+        }
+        m_Initialized = false;
+        backend = std::move(m_Backend);
+    }
+
+    backend->Stop();
+    backend.reset();
+    DRIFT_LOG_INFO("[AsyncIO] Sistema finalizado");
+}
+
+bool AsyncIO::SubmitRead(AsyncReadRequest request) {
+    std::vector<AsyncReadRequest> requests;
+    requests.push_back(std::move(request));
+    return SubmitReads(std::move(requests));
+}
+
+bool AsyncIO::SubmitReads(std::vector<AsyncReadRequest> requests) {
+    if (requests.empty()) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_LifecycleMutex);
+    if (!m_Initialized.load()) {
+        return false;
+    }
+
+    const size_t count = requests.size();
+    m_Pending += count;
+    m_Submitted += count;
+    if (!m_Backend->Enqueue(std::move(requests))) {
+        m_Pending -= count;
+        m_Submitted -= count;
+        return false;
+    }
+    return true;
+}
+
+void AsyncIO::Complete(AsyncReadRequest& request, AsyncReadResult&& result) {
+    if (result.Succeeded()) {
+        m_Completed++;
+        m_BytesRead += result.data.size;
+    } else {
+        m_Failed++;
+    }
+
+    if (request.callback) {
+        request.callback(std::move(result));
+    }
+    m_Pending--;
+}
+
+AsyncIO::Stats AsyncIO::GetStats() const {
+    Stats stats;
+    stats.submitted = m_Submitted.load();
+    stats.completed = m_Completed.load();
+    stats.failed = m_Failed.load();
+    stats.bytesRead = m_BytesRead.load();
+    stats.batches = m_Batches.load();
+    return stats;
+}
+
+} // namespace Drift::Core::IO
@@ -0,0 +1,196 @@
+#include "Drift/Core/IO/Compression.h"
+#include <cstring>
+
+namespace Drift::Core::IO::FastCompression {
+
+namespace {
+
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t LAST_LITERALS = 5;    // Últimos bytes sempre são literais
+constexpr size_t MF_LIMIT = 12;        // Última match deve começar antes de srcSize - 12
+constexpr size_t MAX_OFFSET = 65535;
+constexpr int HASH_BITS = 12;
+
+inline uint32_t Read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t HashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+// Escreve o complemento de um comprimento (>= 15) em bytes de 255
+inline bool WriteLength(size_t length, uint8_t*& op, const uint8_t* opEnd) {
+    while (length >= 255) {
+        if (op >= opEnd) return false;
+        *op++ = 255;
+        length -= 255;
+    }
+    if (op >= opEnd) return false;
+    *op++ = static_cast<uint8_t>(length);
+    return true;
+}
+
+inline bool EmitSequence(const uint8_t* literals, size_t literalLength,
+                         size_t offset, size_t matchLength,
+                         uint8_t*& op, const uint8_t* opEnd) {
+    if (op >= opEnd) return false;
+    uint8_t* token = op++;
+
+    size_t litCode = literalLength < 15 ? literalLength : 15;
+    if (literalLength >= 15 && !WriteLength(literalLength - 15, op, opEnd)) return false;
+
+    if (static_cast<size_t>(opEnd - op) < literalLength) return false;
+    std::memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    size_t matchCode = 0;
+    if (matchLength > 0) {
+        if (opEnd - op < 2) return false;
+        *op++ = static_cast<uint8_t>(offset & 0xFF);
+        *op++ = static_cast<uint8_t>(offset >> 8);
+
+        size_t extra = matchLength - MIN_MATCH;
+        matchCode = extra < 15 ? extra : 15;
+        if (extra >= 15 && !WriteLength(extra - 15, op, opEnd)) return false;
+    }
+
+    *token = static_cast<uint8_t>((litCode << 4) | matchCode);
+    return true;
+}
+
+} // namespace
+
+size_t GetMaxCompressedSize(size_t sourceSize) {
+    return sourceSize + sourceSize / 255 + 16;
+}
+
+size_t GetMaxDecompressedSize(size_t compressedSize) {
+    // Pior caso: bytes de extensão de match (255) repetidos; 3 bytes mínimos rendem até 19
+    if (compressedSize > SIZE_MAX / 255) {
+        return SIZE_MAX;
+    }
+    return compressedSize * 255;
+}
+
+size_t Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity) {
+    uint8_t* op = dst;
+    const uint8_t* const opEnd = dst + dstCapacity;
+
+    size_t anchor = 0;
+
+    if (srcSize > MF_LIMIT) {
+        // Posições + 1 (0 = vazio)
+        uint32_t table[1 << HASH_BITS] = {};
+        const size_t matchStartLimit = srcSize - MF_LIMIT;
+        const size_t matchEndLimit = srcSize - LAST_LITERALS;
+
+        size_t ip = 0;
+        while (ip < matchStartLimit) {
+            uint32_t sequence = Read32(src + ip);
+            uint32_t h = HashSequence(sequence);
+            size_t candidate = table[h];
+            table[h] = static_cast<uint32_t>(ip + 1);
+
+            if (candidate == 0 || ip - (candidate - 1) > MAX_OFFSET ||
+                Read32(src + candidate - 1) != sequence) {
+                ++ip;
+                continue;
+            }
+
+            size_t ref = candidate - 1;
+            size_t matchLength = MIN_MATCH;
+            while (ip + matchLength < matchEndLimit && src[ref + matchLength] == src[ip + matchLength]) {
+                ++matchLength;
+            }
+
+            if (!EmitSequence(src + anchor, ip - anchor, ip - ref, matchLength, op, opEnd)) {
+                return 0;
+            }
+
+            ip += matchLength;
+            anchor = ip;
+        }
+    }
+
+    // Sequência final: apenas literais
+    if (!EmitSequence(src + anchor, srcSize - anchor, 0, 0, op, opEnd)) {
+        return 0;
+    }
+
+    return static_cast<size_t>(op - dst);
+}
+
+bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+    const uint8_t* ip = src;
+    const uint8_t* const ipEnd = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* const opEnd = dst + dstSize;
+
+    while (ip < ipEnd) {
+        uint8_t token = *ip++;
+
+        // Literais
+        size_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            uint8_t s;
+            do {
+                if (ip >= ipEnd) return false;
+                s = *ip++;
+                literalLength += s;
+            } while (s == 255);
+        }
+
+        if (static_cast<size_t>(ipEnd - ip) < literalLength ||
+            static_cast<size_t>(opEnd - op) < literalLength) {
+            return false;
+        }
+        std::memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        // Fim do bloco: a última sequência não tem match
+        if (ip == ipEnd) {
+            break;
+        }
+
+        // Match
+        if (ipEnd - ip < 2) return false;
+        size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) return false;
+
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15) {
+            uint8_t s;
+            do {
+                if (ip >= ipEnd) return false;
+                s = *ip++;
+                matchLength += s;
+            } while (s == 255);
+        }
+        matchLength += MIN_MATCH;
+
+        if (static_cast<size_t>(opEnd - op) < matchLength) return false;
+
+        // Cópia byte a byte: a origem pode sobrepor o destino
+        const uint8_t* match = op - offset;
+        for (size_t i = 0; i < matchLength; ++i) {
+            op[i] = match[i];
+        }
+        op += matchLength;
+    }
+
+    return op == opEnd;
+}
+
+std::vector<uint8_t> Compress(const uint8_t* src, size_t srcSize) {
+    std::vector<uint8_t> output(GetMaxCompressedSize(srcSize));
+    size_t written = Compress(src, srcSize, output.data(), output.size());
+    output.resize(written);
+    return output;
+}
+
+} // namespace Drift::Core::IO::FastCompression
@@ -0,0 +1,208 @@
+#include "Drift/Core/IO/MappedFile.h"
+#include "Drift/Core/Log.h"
+#include <algorithm>
+#include <filesystem>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Drift::Core::IO {
+
+FileView FileView::SubView(size_t offset, size_t length) const {
+    if (offset >= size) {
+        return FileView{};
+    }
+    size_t available = size - offset;
+    size_t count = (length == 0) ? available : std::min(length, available);
+    return FileView(data + offset, count, owner, mapping);
+}
+
+void FileView::Advise(MapAccessHint hint) const {
+    if (mapping && data) {
+        mapping->Advise(hint, static_cast<size_t>(data - mapping->GetData()), size);
+    }
+}
+
+FileView FileView::FromBuffer(std::vector<uint8_t>&& buffer) {
+    auto storage = std::make_shared<const std::vector<uint8_t>>(std::move(buffer));
+    return FileView(storage->data(), storage->size(), storage);
+}
+
+std::shared_ptr<MappedFile> MappedFile::Open(const std::string& path, MapAccessHint hint) {
+    std::shared_ptr<MappedFile> file(new MappedFile());
+    file->m_Path = path;
+
+#ifdef _WIN32
+    std::wstring widePath = std::filesystem::u8path(path).wstring();
+    HANDLE fileHandle = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING,
+                                    hint == MapAccessHint::Sequential ? FILE_FLAG_SEQUENTIAL_SCAN :
+                                    hint == MapAccessHint::Random ? FILE_FLAG_RANDOM_ACCESS : FILE_ATTRIBUTE_NORMAL,
+                                    nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(fileHandle, &fileSize)) {
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    file->m_FileHandle = fileHandle;
+    file->m_Size = static_cast<size_t>(fileSize.QuadPart);
+
+    // Arquivos vazios não podem ser mapeados, mas são válidos
+    if (file->m_Size == 0) {
+        return file;
+    }
+
+    HANDLE mapping = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        DRIFT_LOG_WARNING("[MappedFile] Falha ao criar mapeamento: " << path);
+        return nullptr;
+    }
+    file->m_MappingHandle = mapping;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        DRIFT_LOG_WARNING("[MappedFile] Falha ao mapear visão: " << path);
+        return nullptr;
+    }
+    file->m_Data = static_cast<const uint8_t*>(view);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    file->m_Size = static_cast<size_t>(st.st_size);
+
+    // Arquivos vazios não podem ser mapeados, mas são válidos
+    if (file->m_Size == 0) {
+        ::close(fd);
+        return file;
+    }
+
+    void* addr = ::mmap(nullptr, file->m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // O descritor não é mais necessário após o mmap
+    ::close(fd);
+
+    if (addr == MAP_FAILED) {
+        DRIFT_LOG_WARNING("[MappedFile] Falha no mmap: " << path);
+        return nullptr;
+    }
+    file->m_Data = static_cast<const uint8_t*>(addr);
+#endif
+
+    if (hint != MapAccessHint::Normal) {
+        file->Advise(hint);
+    }
+
+    return file;
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    if (m_Data) {
+        UnmapViewOfFile(m_Data);
+    }
+    if (m_MappingHandle) {
+        CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+    }
+    if (m_FileHandle) {
+        CloseHandle(static_cast<HANDLE>(m_FileHandle));
+    }
+#else
+    if (m_Data) {
+        ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+#endif
+}
+
+FileView MappedFile::GetView() const {
+    return FileView(m_Data, m_Size, shared_from_this(), this);
+}
+
+FileView MappedFile::GetView(size_t offset, size_t length) const {
+    return GetView().SubView(offset, length);
+}
+
+void MappedFile::Advise(MapAccessHint hint, size_t offset, size_t length) const {
+    if (!m_Data || offset >= m_Size) {
+        return;
+    }
+
+    size_t count = (length == 0) ? (m_Size - offset) : std::min(length, m_Size - offset);
+
+#ifdef _WIN32
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+    if (hint == MapAccessHint::WillNeed) {
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = const_cast<uint8_t*>(m_Data + offset);
+        range.NumberOfBytes = count;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    (void)hint;
+    (void)count;
+#endif
+#else
+    // madvise exige endereço alinhado à página
+    static const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    uintptr_t begin = reinterpret_cast<uintptr_t>(m_Data + offset);
+    uintptr_t alignedBegin = begin & ~(static_cast<uintptr_t>(pageSize) - 1);
+    size_t alignedLength = count + static_cast<size_t>(begin - alignedBegin);
+
+    int advice = MADV_NORMAL;
+    switch (hint) {
+        case MapAccessHint::Sequential: advice = MADV_SEQUENTIAL; break;
+        case MapAccessHint::Random:     advice = MADV_RANDOM; break;
+        case MapAccessHint::WillNeed:   advice = MADV_WILLNEED; break;
+        case MapAccessHint::DontNeed:   advice = MADV_DONTNEED; break;
+        default:                        advice = MADV_NORMAL; break;
+    }
+
+    ::madvise(reinterpret_cast<void*>(alignedBegin), alignedLength, advice);
+#endif
+}
+
+void PrefetchFileContents(const std::string& path) {
+#ifdef _WIN32
+    MappedFile::Open(path, MapAccessHint::WillNeed);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+#if defined(__APPLE__)
+    struct stat st {};
+    if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+        radvisory advisory{};
+        advisory.ra_offset = 0;
+        advisory.ra_count = static_cast<int>(std::min<off_t>(st.st_size, INT32_MAX));
+        ::fcntl(fd, F_RDADVISE, &advisory);
+    }
+#else
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+#endif
+    ::close(fd);
+#endif
+}
+
+} // namespace Drift::Core::IO
@@ -53,7 +53,7 @@ LogSystem& LogSystem::GetInstance() {
 }
 
 void LogSystem::Configure(const LogConfig& config) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     m_Config = config;
     
     // Adicionar output padrão se não houver nenhum
@@ -68,17 +68,17 @@ void LogSystem::Configure(const LogConfig& config) {
 }
 
 void LogSystem::SetLogLevel(LogLevel level) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     m_Config.minLevel = level;
 }
 
 void LogSystem::AddOutput(std::shared_ptr<ILogOutput> output) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     m_Outputs.push_back(output);
 }
 
 void LogSystem::RemoveOutput(std::shared_ptr<ILogOutput> output) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     m_Outputs.erase(
         std::remove(m_Outputs.begin(), m_Outputs.end(), output),
         m_Outputs.end()
@@ -92,7 +92,7 @@ void LogSystem::Log(LogLevel level, const std::string& message) {
     
     std::string formattedMessage = FormatLogMessage(level, nullptr, 0, nullptr, message);
     
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     for (auto& output : m_Outputs) {
         output->Write(level, formattedMessage);
     }
@@ -109,7 +109,7 @@ void LogSystem::Log(LogLevel level, const char* file, int line, const char* func
     
     std::string formattedMessage = FormatLogMessage(level, file, line, function, message);
     
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     for (auto& output : m_Outputs) {
         output->Write(level, formattedMessage);
     }
@@ -179,7 +179,7 @@ void DemonstrateProfiling() {
         std::vector<std::thread> threads;
         for (int i = 0; i < 3; ++i) {
             threads.emplace_back([i]() {
-                PROFILE_SCOPE("Thread " + std::to_string(i));
+                PROFILE_SCOPE_DYNAMIC("Thread " + std::to_string(i));
                 std::this_thread::sleep_for(std::chrono::milliseconds(20 + i * 5));
             });
         }
@@ -286,24 +286,32 @@ void DemonstrateAdvancedFeatures() {
         {
             PROFILE_SCOPE_WITH_PARENT("Loop Principal", "Sistema Completo");
             
+            // Timeline dos 5 frames: cada EndFrame() fecha um frame da captura
+            Profiler::GetInstance().StartCapture(5);
+            
             for (int frame = 0; frame < 5; ++frame) {
-                PROFILE_SCOPE("Frame " + std::to_string(frame));
-                
+                Profiler::GetInstance().BeginFrame();
                 {
-                    PROFILE_SCOPE_WITH_PARENT("Update", "Frame " + std::to_string(frame));
-                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                }
+                    PROFILE_SCOPE_DYNAMIC("Frame " + std::to_string(frame));
                 
-                {
-                    PROFILE_SCOPE_WITH_PARENT("Render", "Frame " + std::to_string(frame));
-                    std::this_thread::sleep_for(std::chrono::milliseconds(15));
-                }
+                    {
+                        PROFILE_SCOPE_WITH_PARENT("Update", "Frame " + std::to_string(frame));
+                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    }
                 
-                {
-                    PROFILE_SCOPE_WITH_PARENT("Audio", "Frame " + std::to_string(frame));
-                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    {
+                        PROFILE_SCOPE_WITH_PARENT("Render", "Frame " + std::to_string(frame));
+                        std::this_thread::sleep_for(std::chrono::milliseconds(15));
+                    }
+                
+                    {
+                        PROFILE_SCOPE_WITH_PARENT("Audio", "Frame " + std::to_string(frame));
+                        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    }
                 }
+                Profiler::GetInstance().EndFrame();
             }
+            Profiler::GetInstance().ExportChromeTrace("frames_trace.json");
         }
     }
     
@@ -314,7 +322,7 @@ void DemonstrateAdvancedFeatures() {
         std::vector<std::vector<int>> dataStructures;
         
         for (int i = 0; i < 10; ++i) {
-            PROFILE_SCOPE("Alocação " + std::to_string(i));
+            PROFILE_SCOPE_DYNAMIC("Alocação " + std::to_string(i));
             
             size_t size = (i + 1) * 1024;
             PROFILE_MEMORY_ALLOC(size);
@@ -324,7 +332,7 @@ void DemonstrateAdvancedFeatures() {
         }
         
         for (int i = 9; i >= 0; --i) {
-            PROFILE_SCOPE("Desalocação " + std::to_string(i));
+            PROFILE_SCOPE_DYNAMIC("Desalocação " + std::to_string(i));
             
             size_t size = (i + 1) * 1024;
             PROFILE_MEMORY_DEALLOC(size);
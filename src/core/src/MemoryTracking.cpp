@@ -0,0 +1,307 @@
+#include "Drift/Core/Profiler.h"
+#include "Drift/Core/Log.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include <sstream>
+
+namespace Drift::Core {
+
+namespace {
+
+constexpr uint32_t MAX_TAG_DEPTH = 32;
+
+// Pilha de tags da thread (POD: usada dentro de operator new, sem alocar)
+struct TagStack {
+    MemoryTag tags[MAX_TAG_DEPTH];
+    uint32_t depth;
+};
+thread_local TagStack t_TagStack = {};
+
+// Contadores por tag: inicializados antes de qualquer código (zero), escritos pelos hooks
+struct alignas(64) TagCounters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> frees{0};
+    std::atomic<uint64_t> bytesAllocated{0};
+    std::atomic<int64_t> liveBytes{0};
+    std::atomic<int64_t> peakLiveBytes{0};
+};
+TagCounters g_TagCounters[MAX_MEMORY_TAGS];
+
+} // namespace
+
+MemoryProfiler::MemoryProfiler() {
+    m_TagNames.push_back("Sem tag");
+    m_TagFrames.emplace_back();
+}
+
+bool MemoryProfiler::IsAllocationTrackingEnabled() {
+    return DRIFT_ALLOCATION_TRACKING != 0;
+}
+
+MemoryTag MemoryProfiler::RegisterTag(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = std::find(m_TagNames.begin(), m_TagNames.end(), name);
+    if (it != m_TagNames.end()) {
+        return static_cast<MemoryTag>(it - m_TagNames.begin());
+    }
+    if (m_TagNames.size() >= MAX_MEMORY_TAGS) {
+        DRIFT_LOG_WARNING("[MemoryProfiler] Limite de tags atingido, alocações de '" << name << "' ficam sem tag");
+        return 0;
+    }
+
+    m_TagNames.push_back(name);
+    m_TagFrames.emplace_back();
+    return static_cast<MemoryTag>(m_TagNames.size() - 1);
+}
+
+void MemoryProfiler::PushTag(MemoryTag tag) {
+    TagStack& stack = t_TagStack;
+    if (stack.depth < MAX_TAG_DEPTH) {
+        stack.tags[stack.depth] = tag;
+    }
+    stack.depth++; // Acima do limite só conta, para o PopTag continuar pareado
+}
+
+void MemoryProfiler::PopTag() {
+    TagStack& stack = t_TagStack;
+    if (stack.depth > 0) {
+        stack.depth--;
+    }
+}
+
+MemoryTag MemoryProfiler::GetCurrentTag() {
+    const TagStack& stack = t_TagStack;
+    return stack.depth == 0 ? 0 : stack.tags[std::min(stack.depth, MAX_TAG_DEPTH) - 1];
+}
+
+std::vector<MemoryTagStats> MemoryProfiler::GetTagStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::vector<MemoryTagStats> result;
+    result.reserve(m_TagNames.size());
+
+    for (size_t tag = 0; tag < m_TagNames.size(); ++tag) {
+        const TagCounters& counters = g_TagCounters[tag];
+        const TagFrameState& frame = m_TagFrames[tag];
+
+        MemoryTagStats stats;
+        stats.name = m_TagNames[tag];
+        stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+        stats.frees = counters.frees.load(std::memory_order_relaxed);
+        stats.bytesAllocated = counters.bytesAllocated.load(std::memory_order_relaxed);
+        stats.liveBytes = static_cast<uint64_t>(std::max<int64_t>(counters.liveBytes.load(std::memory_order_relaxed), 0));
+        stats.peakLiveBytes = static_cast<uint64_t>(counters.peakLiveBytes.load(std::memory_order_relaxed));
+        stats.frameAllocations = frame.frameAllocations;
+        stats.frameBytes = frame.frameBytes;
+        stats.peakFrameAllocations = frame.peakFrameAllocations;
+        stats.averageFrameAllocations = m_FrameCount > 0 ? static_cast<double>(frame.lastAllocations) / m_FrameCount : 0.0;
+        result.push_back(std::move(stats));
+    }
+    return result;
+}
+
+uint64_t MemoryProfiler::GetTrackedLiveBytes() const {
+    int64_t live = 0;
+    for (const auto& counters : g_TagCounters) {
+        live += counters.liveBytes.load(std::memory_order_relaxed);
+    }
+    return static_cast<uint64_t>(std::max<int64_t>(live, 0));
+}
+
+void MemoryProfiler::EndFrame() {
+    if (!IsAllocationTrackingEnabled()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (size_t tag = 0; tag < m_TagFrames.size(); ++tag) {
+        TagFrameState& frame = m_TagFrames[tag];
+        uint64_t allocations = g_TagCounters[tag].allocations.load(std::memory_order_relaxed);
+        uint64_t bytes = g_TagCounters[tag].bytesAllocated.load(std::memory_order_relaxed);
+
+        frame.frameAllocations = allocations - frame.lastAllocations;
+        frame.frameBytes = bytes - frame.lastBytes;
+        frame.peakFrameAllocations = std::max(frame.peakFrameAllocations, frame.frameAllocations);
+        frame.lastAllocations = allocations;
+        frame.lastBytes = bytes;
+    }
+    m_FrameCount++;
+}
+
+std::string MemoryProfiler::GenerateReport() const {
+    std::vector<MemoryTagStats> tags = GetTagStats();
+    std::sort(tags.begin(), tags.end(), [](const auto& a, const auto& b) {
+        return a.frameAllocations != b.frameAllocations ? a.frameAllocations > b.frameAllocations
+                                                        : a.allocations > b.allocations;
+    });
+
+    std::stringstream ss;
+    ss << std::endl << "Alocações por tag:" << std::endl;
+    ss << std::left << std::setw(20) << "Tag"
+       << std::setw(12) << "Allocs"
+       << std::setw(12) << "Vivos (KB)"
+       << std::setw(12) << "Pico (KB)"
+       << std::setw(12) << "Frame"
+       << std::setw(12) << "Frame (KB)"
+       << std::setw(12) << "Média"
+       << std::setw(12) << "Pico frame" << std::endl;
+    ss << std::string(100, '-') << std::endl;
+
+    for (const auto& tag : tags) {
+        if (tag.allocations == 0) {
+            continue;
+        }
+        ss << std::left << std::setw(20) << tag.name
+           << std::setw(12) << tag.allocations
+           << std::setw(12) << std::fixed << std::setprecision(1) << tag.liveBytes / 1024.0
+           << std::setw(12) << tag.peakLiveBytes / 1024.0
+           << std::setw(12) << tag.frameAllocations
+           << std::setw(12) << tag.frameBytes / 1024.0
+           << std::setw(12) << tag.averageFrameAllocations
+           << std::setw(12) << tag.peakFrameAllocations << std::endl;
+    }
+    ss << std::string(100, '-') << std::endl;
+    return ss.str();
+}
+
+} // namespace Drift::Core
+
+#if DRIFT_ALLOCATION_TRACKING
+
+// Substituição global de operator new/delete. Cada bloco leva um cabeçalho com o
+// tamanho e a tag de origem, para a liberação ser creditada à tag certa mesmo
+// quando acontece em outro escopo ou outra thread.
+namespace {
+
+using Drift::Core::MemoryTag;
+using Drift::Core::TagCounters;
+using Drift::Core::g_TagCounters;
+
+struct AllocationHeader {
+    uint64_t size;
+    uint32_t tag;
+    uint32_t offset;        // Distância até o início do bloco do sistema (alinhamentos grandes)
+};
+static_assert(sizeof(AllocationHeader) == 16, "Cabeçalho precisa preservar o alinhamento padrão");
+
+constexpr size_t DEFAULT_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__ > sizeof(AllocationHeader)
+    ? __STDCPP_DEFAULT_NEW_ALIGNMENT__ : sizeof(AllocationHeader);
+
+void RecordAllocation(MemoryTag tag, size_t size) {
+    TagCounters& counters = g_TagCounters[tag];
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    int64_t live = counters.liveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+    int64_t peak = counters.peakLiveBytes.load(std::memory_order_relaxed);
+    while (live > peak && !counters.peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void RecordFree(const AllocationHeader& header) {
+    TagCounters& counters = g_TagCounters[header.tag];
+    counters.frees.fetch_add(1, std::memory_order_relaxed);
+    counters.liveBytes.fetch_sub(static_cast<int64_t>(header.size), std::memory_order_relaxed);
+}
+
+void* TrackedAllocate(size_t size, size_t alignment) {
+    // O cabeçalho ocupa um alinhamento inteiro antes do ponteiro entregue
+    alignment = std::max(alignment, DEFAULT_ALIGNMENT);
+    size_t total = size + alignment;
+
+    void* block;
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        block = std::malloc(total);
+    } else {
+#if defined(_MSC_VER)
+        block = _aligned_malloc(total, alignment);
+#else
+        block = std::aligned_alloc(alignment, (total + alignment - 1) / alignment * alignment);
+#endif
+    }
+    if (!block) {
+        return nullptr;
+    }
+
+    MemoryTag tag = Drift::Core::MemoryProfiler::GetCurrentTag();
+    auto* user = static_cast<unsigned char*>(block) + alignment;
+    auto* header = reinterpret_cast<AllocationHeader*>(user) - 1;
+    header->size = size;
+    header->tag = tag;
+    header->offset = static_cast<uint32_t>(alignment);
+
+    RecordAllocation(tag, size);
+    return user;
+}
+
+void TrackedFree(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+
+    auto* header = static_cast<AllocationHeader*>(ptr) - 1;
+    RecordFree(*header);
+
+    size_t alignment = header->offset;
+    void* block = static_cast<unsigned char*>(ptr) - alignment;
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        std::free(block);
+    } else {
+#if defined(_MSC_VER)
+        _aligned_free(block);
+#else
+        std::free(block);
+#endif
+    }
+}
+
+void* TrackedNew(size_t size, size_t alignment) {
+    for (;;) {
+        if (void* ptr = TrackedAllocate(size, alignment)) {
+            return ptr;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* TrackedNewNoThrow(size_t size, size_t alignment) noexcept {
+    try {
+        return TrackedNew(size, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+} // namespace
+
+void* operator new(size_t size) { return TrackedNew(size, 0); }
+void* operator new[](size_t size) { return TrackedNew(size, 0); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return TrackedNewNoThrow(size, 0); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return TrackedNewNoThrow(size, 0); }
+void* operator new(size_t size, std::align_val_t alignment) { return TrackedNew(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return TrackedNew(size, static_cast<size_t>(alignment)); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return TrackedNewNoThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return TrackedNewNoThrow(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+
+#endif // DRIFT_ALLOCATION_TRACKING
@@ -0,0 +1,88 @@
+#include "Drift/Core/ProfiledMutex.h"
+#include <memory>
+
+namespace Drift::Core {
+
+namespace {
+
+struct LockEntry {
+    std::string name;
+    LockStats stats;
+};
+
+struct LockRegistry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<LockEntry>> locks;
+};
+
+// Nunca destruído: locks de objetos estáticos ainda podem travar durante o encerramento
+LockRegistry& GetRegistry() {
+    static LockRegistry* registry = new LockRegistry();
+    return *registry;
+}
+
+LockStats& RegisterLock(const char* name) {
+    LockRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& entry : registry.locks) {
+        if (entry->name == name) {
+            return entry->stats;
+        }
+    }
+    registry.locks.push_back(std::make_unique<LockEntry>());
+    registry.locks.back()->name = name;
+    return registry.locks.back()->stats;
+}
+
+} // namespace
+
+void LockStats::Reset() {
+    acquisitions.store(0, std::memory_order_relaxed);
+    contentions.store(0, std::memory_order_relaxed);
+    waitNs.store(0, std::memory_order_relaxed);
+    maxWaitNs.store(0, std::memory_order_relaxed);
+    holdNs.store(0, std::memory_order_relaxed);
+    maxHoldNs.store(0, std::memory_order_relaxed);
+}
+
+ProfiledMutex::ProfiledMutex(const char* name) : m_Stats(&RegisterLock(name)) {
+}
+
+void ProfiledMutex::LockContended() {
+    uint64_t start = Clock::NowNs();
+    m_Mutex.lock();
+    uint64_t waitedNs = Clock::NowNs() - start;
+    m_Stats->contentions.fetch_add(1, std::memory_order_relaxed);
+    m_Stats->waitNs.fetch_add(waitedNs, std::memory_order_relaxed);
+    UpdateMax(m_Stats->maxWaitNs, waitedNs);
+}
+
+std::vector<LockStatsSnapshot> ProfiledMutex::GetAllStats() {
+    LockRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::vector<LockStatsSnapshot> snapshots;
+    snapshots.reserve(registry.locks.size());
+    for (const auto& entry : registry.locks) {
+        LockStatsSnapshot snapshot;
+        snapshot.name = entry->name;
+        snapshot.acquisitions = entry->stats.acquisitions.load(std::memory_order_relaxed);
+        snapshot.contentions = entry->stats.contentions.load(std::memory_order_relaxed);
+        snapshot.waitNs = entry->stats.waitNs.load(std::memory_order_relaxed);
+        snapshot.maxWaitNs = entry->stats.maxWaitNs.load(std::memory_order_relaxed);
+        snapshot.holdNs = entry->stats.holdNs.load(std::memory_order_relaxed);
+        snapshot.maxHoldNs = entry->stats.maxHoldNs.load(std::memory_order_relaxed);
+        snapshots.push_back(std::move(snapshot));
+    }
+    return snapshots;
+}
+
+void ProfiledMutex::ResetAllStats() {
+    LockRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& entry : registry.locks) {
+        entry->stats.Reset();
+    }
+}
+
+} // namespace Drift::Core
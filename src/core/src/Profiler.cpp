@@ -7,13 +7,12 @@
 #include <thread>
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <ctime>
+#include <fstream>
 
 namespace Drift::Core {
 
-// Thread-local storage para seções ativas
-thread_local std::vector<ActiveSection> Profiler::s_ActiveSections;
-
 // Implementação do ConsoleProfilerOutput
 void ConsoleProfilerOutput::WriteReport(const std::string& report) {
     std::cout << report << std::endl;
@@ -55,15 +54,181 @@ void FileProfilerOutput::WriteSection(const std::string& name, const SectionStat
     }
 }
 
+// Buffer de eventos de uma thread (produtor: a thread dona; consumidor: o agregador)
+struct Profiler::ThreadBuffer {
+    explicit ThreadBuffer(size_t capacity)
+        : events(capacity), mask(capacity - 1), threadId(std::this_thread::get_id()) {}
+    
+    std::vector<ProfileEvent> events;
+    const uint64_t mask;
+    std::atomic<uint64_t> writeIndex{0};
+    std::atomic<uint64_t> readIndex{0};
+    std::atomic<uint64_t> droppedEvents{0};
+    std::atomic<bool> retired{false};
+    std::thread::id threadId;
+    uint32_t threadIndex = 0;
+    
+    // Estado da thread dona
+    uint32_t depth = 0;                                         // Seções gravadas ainda abertas
+    uint32_t suppressedDepth = 0;                               // Subárvore descartada por buffer cheio
+    std::vector<SectionId> sectionStack;                        // Seções gravadas abertas
+    std::atomic<SectionId> currentSection{INVALID_SECTION_ID};  // Topo da pilha, lido pelo handler de amostragem
+    std::vector<std::pair<SectionId, bool>> namedSections;      // BeginSection/EndSection por nome
+    std::unique_ptr<HardwareCounterGroup> counters;             // Aberto na primeira seção com contadores
+    
+    // Estado do agregador: seções cujo Begin já foi consumido
+    struct OpenSection {
+        SectionId section;
+        uint64_t startNs;
+        uint32_t node;
+        uint32_t memoryMarks;
+        size_t memoryStart;
+        size_t memoryEnd;
+        uint32_t counterMarks;
+        uint64_t counterStart[HARDWARE_COUNTER_COUNT];
+        uint64_t counterEnd[HARDWARE_COUNTER_COUNT];
+    };
+    std::vector<OpenSection> open;
+};
+
+// Aposenta o buffer quando a thread termina; o agregador o libera depois de consumi-lo
+struct Profiler::ThreadBufferOwner {
+    ThreadBuffer* buffer = nullptr;
+    
+    ~ThreadBufferOwner() {
+        if (buffer) {
+            // Desliga o TLS antes de aposentar: um SIGPROF entre os dois passos não pode
+            // escrever num buffer que o coletor já considera livre para reaproveitar
+            SamplingProfiler::UnregisterCurrentThread();
+            s_ThreadBuffer = nullptr;
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            buffer->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local Profiler::ThreadBuffer* Profiler::s_ThreadBuffer = nullptr;
+
+namespace {
+
+// Nome pedido antes do buffer da thread existir (aplicado quando ele é criado)
+thread_local std::string t_PendingThreadName;
+
+void AppendJsonString(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                        << std::dec << std::setfill(' ');
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+// Chrome trace usa microssegundos; 3 casas mantêm a resolução de ns
+void AppendMicroseconds(std::ostream& out, uint64_t nanoseconds) {
+    out << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000 << std::setfill(' ');
+}
+
+// Contadores guardam double nos bits de um atômico de 64 bits
+uint64_t CounterBits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double CounterValue(uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void RecordSample(SectionStats& stats, uint64_t durationNs, uint64_t endNs) {
+    auto endTime = Clock::ToTimePoint(endNs);
+    if (stats.callCount == 0) {
+        stats.firstCall = endTime;
+    }
+    
+    stats.callCount++;
+    stats.totalTimeNs += durationNs;
+    stats.minTimeNs = std::min(stats.minTimeNs, durationNs);
+    stats.maxTimeNs = std::max(stats.maxTimeNs, durationNs);
+    stats.lastTimeNs = durationNs;
+    stats.lastCall = endTime;
+    
+    // Atualizar estatísticas avançadas
+    stats.UpdateVariance(durationNs);
+}
+
+void RecordMemorySample(SectionStats& stats, size_t memoryUsage) {
+    stats.totalMemoryAllocated += memoryUsage;
+    stats.peakMemoryUsage = std::max(stats.peakMemoryUsage, memoryUsage);
+    stats.currentMemoryUsage = memoryUsage;
+}
+
+void RecordCounterSample(SectionStats& stats, const uint64_t* start, const uint64_t* end) {
+    auto delta = [start, end](HardwareCounter counter) {
+        uint32_t index = static_cast<uint32_t>(counter);
+        return end[index] > start[index] ? end[index] - start[index] : 0;
+    };
+    stats.counterSamples++;
+    stats.cycles += delta(HardwareCounter::Cycles);
+    stats.instructions += delta(HardwareCounter::Instructions);
+    stats.l1dMisses += delta(HardwareCounter::L1DMisses);
+    stats.llcMisses += delta(HardwareCounter::LLCMisses);
+    stats.branchMisses += delta(HardwareCounter::BranchMisses);
+}
+
+} // namespace
+
 // Implementação do Profiler
 Profiler& Profiler::GetInstance() {
     static Profiler instance;
     return instance;
 }
 
+Profiler::Profiler() {
+    m_CallTree.emplace_back();      // Raiz
+}
+
+Profiler::~Profiler() = default;
+
 void Profiler::Configure(const ProfilerConfig& config) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    const uint32_t previousSamplingHz = m_Config.samplingFrequencyHz;
+    const std::string previousStreamAddress = m_Config.streamAddress;
     m_Config = config;
+    m_Enabled.store(config.enableProfiling, std::memory_order_relaxed);
+    m_MemoryProfiling.store(config.enableMemoryProfiling, std::memory_order_relaxed);
+    m_HardwareCounters.store(config.enableHardwareCounters, std::memory_order_relaxed);
+    
+    // Amostragem: liga com frequência > 0; só desliga se foi ligada por configuração
+    if (config.samplingFrequencyHz > 0) {
+        SamplingProfiler::GetInstance().Start(config.samplingFrequencyHz, config.samplingBufferSize);
+    } else if (previousSamplingHz > 0) {
+        SamplingProfiler::GetInstance().Stop();
+    }
+    
+    // Streaming: reinicia só quando o endereço muda; o servidor novo precisa de todos os nomes
+    if (config.streamAddress != previousStreamAddress) {
+        ProfilerStreamServer::GetInstance().Stop();
+        m_StreamedSections = 0;
+        m_StreamedCounters = 0;
+        if (!config.streamAddress.empty()) {
+            ProfilerStreamServer::GetInstance().Start(config.streamAddress);
+        }
+    }
+    m_MaxDepth.store(static_cast<uint32_t>(config.maxDepth), std::memory_order_relaxed);
+    m_EventBufferSize.store(config.eventBufferSize, std::memory_order_relaxed);
     
     // Adicionar output padrão se não houver nenhum
     if (m_Outputs.empty()) {
@@ -77,129 +242,842 @@ void Profiler::Configure(const ProfilerConfig& config) {
 }
 
 void Profiler::SetEnabled(bool enabled) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     m_Config.enableProfiling = enabled;
+    m_Enabled.store(enabled, std::memory_order_relaxed);
 }
 
 void Profiler::AddOutput(std::shared_ptr<IProfilerOutput> output) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     m_Outputs.push_back(output);
 }
 
 void Profiler::RemoveOutput(std::shared_ptr<IProfilerOutput> output) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     m_Outputs.erase(
         std::remove(m_Outputs.begin(), m_Outputs.end(), output),
         m_Outputs.end()
     );
 }
 
-void Profiler::BeginSection(const std::string& name) {
-    if (!m_Config.enableProfiling) return;
+SectionId Profiler::RegisterSection(const std::string& name) {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    auto it = m_SectionIds.find(name);
+    if (it != m_SectionIds.end()) {
+        return it->second;
+    }
     
-    std::string parent = "";
-    uint32_t depth = 0;
+    SectionId section = static_cast<SectionId>(m_SectionNames.size());
+    m_SectionNames.push_back(name);
+    m_SectionIds.emplace(name, section);
+    m_SectionStats.emplace_back();
+    m_FrameSectionTimes.push_back(0);
+    m_SectionWindows.emplace_back();
+    return section;
+}
+
+CounterId Profiler::RegisterCounter(const std::string& name, CounterType type) {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    auto it = m_CounterIds.find(name);
+    if (it != m_CounterIds.end()) {
+        return it->second;
+    }
+    if (m_Counters.size() >= MAX_PROFILE_COUNTERS) {
+        DRIFT_LOG_WARNING("[Profiler] Limite de contadores atingido, ignorando: " << name);
+        return MAX_PROFILE_COUNTERS;
+    }
     
-    if (!s_ActiveSections.empty()) {
-        parent = s_ActiveSections.back().name;
-        depth = s_ActiveSections.back().depth + 1;
+    CounterId counter = static_cast<CounterId>(m_Counters.size());
+    CounterSeries series;
+    series.name = name;
+    series.type = type;
+    m_Counters.push_back(std::move(series));
+    m_CounterIds.emplace(name, counter);
+    return counter;
+}
+
+void Profiler::AddCounter(CounterId counter, double delta) {
+    if (counter >= MAX_PROFILE_COUNTERS || !m_Enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::atomic<uint64_t>& slot = m_CounterValues[counter];
+    uint64_t bits = slot.load(std::memory_order_relaxed);
+    while (!slot.compare_exchange_weak(bits, CounterBits(CounterValue(bits) + delta), std::memory_order_relaxed)) {
+    }
+}
+
+void Profiler::SetGauge(CounterId counter, double value) {
+    if (counter >= MAX_PROFILE_COUNTERS || !m_Enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    m_CounterValues[counter].store(CounterBits(value), std::memory_order_relaxed);
+}
+
+std::vector<double> Profiler::GetCounterHistory(const std::string& name) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    auto it = m_CounterIds.find(name);
+    if (it == m_CounterIds.end()) {
+        return {};
     }
     
-    BeginSection(name, parent);
+    const CounterSeries& series = m_Counters[it->second];
+    std::vector<double> history(series.samples.begin() + series.next, series.samples.end());
+    history.insert(history.end(), series.samples.begin(), series.samples.begin() + series.next);
+    return history;
 }
 
-void Profiler::EndSection(const std::string& name) {
-    if (!m_Config.enableProfiling) return;
+void Profiler::SampleCounters(uint64_t endNs, std::vector<ProfileCounterSample>& samples) {
+    const size_t window = std::max<size_t>(m_Config.frameHistorySize, 1);
+    for (CounterId counter = 0; counter < m_Counters.size(); ++counter) {
+        CounterSeries& series = m_Counters[counter];
+        std::atomic<uint64_t>& slot = m_CounterValues[counter];
+        double value = CounterValue(series.type == CounterType::Counter ? slot.exchange(CounterBits(0.0), std::memory_order_relaxed)
+                                                                        : slot.load(std::memory_order_relaxed));
+        
+        if (series.samples.size() < window) {
+            series.samples.push_back(value);
+        } else {
+            series.samples[series.next] = value;
+            series.next = (series.next + 1) % series.samples.size();
+        }
+        samples.push_back({endNs, counter, value});
+    }
+}
+
+void Profiler::PublishStreamFrame(ProfilerStreamFrame& frame, const std::vector<ProfileCounterSample>& counters) {
+    // Nomes registrados desde o último frame transmitido vão antes dele
+    std::string definitions;
+    for (; m_StreamedSections < m_SectionNames.size(); ++m_StreamedSections) {
+        AppendStreamSectionName(definitions, static_cast<uint32_t>(m_StreamedSections), m_SectionNames[m_StreamedSections]);
+    }
+    for (; m_StreamedCounters < m_Counters.size(); ++m_StreamedCounters) {
+        const CounterSeries& series = m_Counters[m_StreamedCounters];
+        AppendStreamCounterName(definitions, static_cast<uint32_t>(m_StreamedCounters),
+                                static_cast<uint8_t>(series.type), series.name);
+    }
     
-    if (s_ActiveSections.empty() || s_ActiveSections.back().name != name) {
-        return; // Seção não encontrada ou não iniciada
+    frame.counters.reserve(counters.size());
+    for (const auto& sample : counters) {
+        frame.counters.emplace_back(sample.counter, sample.value);
+    }
+    std::string bytes;
+    AppendStreamFrame(bytes, frame);
+    ProfilerStreamServer::GetInstance().Publish(std::move(definitions), std::move(bytes));
+}
+
+std::string Profiler::GetSectionName(SectionId section) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    return GetSectionNameLocked(section);
+}
+
+std::string Profiler::GetSectionNameLocked(SectionId section) const {
+    return section < m_SectionNames.size() ? m_SectionNames[section] : std::string();
+}
+
+Profiler::ThreadBuffer* Profiler::GetThreadBuffer() {
+    if (s_ThreadBuffer) {
+        return s_ThreadBuffer;
+    }
+    
+    size_t capacity = 64;
+    while (capacity < m_EventBufferSize.load(std::memory_order_relaxed)) {
+        capacity <<= 1;
     }
     
-    auto endTime = std::chrono::high_resolution_clock::now();
-    auto& activeSection = s_ActiveSections.back();
+    auto buffer = std::make_unique<ThreadBuffer>(capacity);
+    buffer->threadIndex = m_ThreadCounter++;
+    ThreadBuffer* raw = buffer.get();
+    {
+        std::lock_guard<ProfiledMutex> lock(m_Mutex);
+        if (!t_PendingThreadName.empty()) {
+            m_ThreadNames[raw->threadIndex] = std::move(t_PendingThreadName);
+            t_PendingThreadName.clear();
+        }
+        m_ThreadBuffers.push_back(std::move(buffer));
+    }
     
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - activeSection.startTime);
-    uint64_t timeNs = duration.count();
+    static thread_local ThreadBufferOwner owner;
+    owner.buffer = raw;
+    s_ThreadBuffer = raw;
+    SamplingProfiler::RegisterCurrentThread();
+    return raw;
+}
+
+void Profiler::PushEvent(ThreadBuffer& buffer, SectionId section, ProfileEventType type, uint64_t value) {
+    uint64_t write = buffer.writeIndex.load(std::memory_order_relaxed);
+    buffer.events[write & buffer.mask] = ProfileEvent{value, section, type};
+    buffer.writeIndex.store(write + 1, std::memory_order_release);
+}
+
+bool Profiler::OpenHardwareCounters(ThreadBuffer& buffer) {
+    if (!buffer.counters) {
+        // Uma tentativa por thread; a falha é avisada uma vez por processo
+        buffer.counters = std::make_unique<HardwareCounterGroup>();
+        if (!buffer.counters->Open()) {
+            static std::atomic<bool> warned{false};
+            if (!warned.exchange(true)) {
+                DRIFT_LOG_WARNING("[Profiler] Contadores de hardware indisponíveis: " << buffer.counters->GetLastError());
+            }
+        }
+    }
+    return buffer.counters->IsOpen();
+}
+
+bool Profiler::BeginSection(SectionId section) {
+    if (!m_Enabled.load(std::memory_order_relaxed) || section == INVALID_SECTION_ID) {
+        return false;
+    }
     
-    UpdateStats(name, timeNs, activeSection.parentSection, activeSection.depth);
+    ThreadBuffer* buffer = GetThreadBuffer();
+    if (buffer->suppressedDepth > 0) {
+        // Filhos de uma seção descartada também são descartados: não sobem para o pai
+        buffer->suppressedDepth++;
+        buffer->droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    if (buffer->depth >= m_MaxDepth.load(std::memory_order_relaxed)) {
+        return false; // Profundidade máxima atingida
+    }
     
-    if (m_Config.enableMemoryProfiling) {
-        size_t currentMemory = GetCurrentMemoryUsage();
-        size_t memoryUsed = currentMemory - activeSection.memorySnapshot;
-        UpdateMemoryStats(name, memoryUsed);
+    // Reserva também o End de cada seção aberta: Begin gravado sempre tem End gravado
+    const bool memory = m_MemoryProfiling.load(std::memory_order_relaxed);
+    const bool counters = m_HardwareCounters.load(std::memory_order_relaxed) && OpenHardwareCounters(*buffer);
+    const uint64_t capacity = buffer->mask + 1;
+    const uint64_t needed = (memory ? 2 : 1) + (counters ? HARDWARE_COUNTER_COUNT : 0) + buffer->depth + 1;
+    uint64_t used = buffer->writeIndex.load(std::memory_order_relaxed) - buffer->readIndex.load(std::memory_order_acquire);
+    if (used + needed > capacity) {
+        TryFlush();
+        used = buffer->writeIndex.load(std::memory_order_relaxed) - buffer->readIndex.load(std::memory_order_acquire);
+        if (used + needed > capacity) {
+            buffer->droppedEvents.fetch_add(1, std::memory_order_relaxed);
+            buffer->suppressedDepth = 1; // O End correspondente encerra a supressão
+            return true;
+        }
     }
     
-    s_ActiveSections.pop_back();
+    buffer->depth++;
+    buffer->sectionStack.push_back(section);
+    buffer->currentSection.store(section, std::memory_order_relaxed);
+    PushEvent(*buffer, section, ProfileEventType::Begin, GetCurrentTimeNs());
+    if (memory) {
+        PushEvent(*buffer, section, ProfileEventType::Memory, GetCurrentMemoryUsage());
+    }
+    if (counters) {
+        // Lidos por último para não contar o próprio Begin
+        uint64_t values[HARDWARE_COUNTER_COUNT];
+        buffer->counters->Read(values);
+        for (uint64_t value : values) {
+            PushEvent(*buffer, section, ProfileEventType::Counter, value);
+        }
+    }
+    return true;
 }
 
-void Profiler::BeginSection(const std::string& name, const std::string& parent) {
-    if (!m_Config.enableProfiling) return;
-    
-    uint32_t depth = 0;
-    if (!parent.empty()) {
-        depth = 1;
-        for (const auto& section : s_ActiveSections) {
-            if (section.name == parent) {
-                depth = section.depth + 1;
-                break;
-            }
+void Profiler::EndSection(SectionId section) {
+    ThreadBuffer* buffer = s_ThreadBuffer;
+    if (!buffer) {
+        return;
+    }
+    if (buffer->suppressedDepth > 0) {
+        buffer->suppressedDepth--;
+        return;
+    }
+    if (buffer->depth == 0) {
+        return;
+    }
+    
+    // Contadores antes de tudo, para não contar o próprio End
+    uint64_t values[HARDWARE_COUNTER_COUNT];
+    const bool counters = m_HardwareCounters.load(std::memory_order_relaxed) && buffer->counters && buffer->counters->IsOpen();
+    if (counters) {
+        buffer->counters->Read(values);
+    }
+    
+    uint64_t endNs = GetCurrentTimeNs();
+    const uint64_t capacity = buffer->mask + 1;
+    uint64_t used = buffer->writeIndex.load(std::memory_order_relaxed) - buffer->readIndex.load(std::memory_order_acquire);
+    
+    // Marcas extras só entram se sobrar espaço além dos End reservados
+    if (counters && used + HARDWARE_COUNTER_COUNT + buffer->depth <= capacity) {
+        for (uint64_t value : values) {
+            PushEvent(*buffer, section, ProfileEventType::Counter, value);
         }
+        used += HARDWARE_COUNTER_COUNT;
+    }
+    if (m_MemoryProfiling.load(std::memory_order_relaxed) && used + buffer->depth + 1 <= capacity) {
+        PushEvent(*buffer, section, ProfileEventType::Memory, GetCurrentMemoryUsage());
+        used++;
     }
+    PushEvent(*buffer, section, ProfileEventType::End, endNs);
+    buffer->depth--;
+    buffer->sectionStack.pop_back();
+    buffer->currentSection.store(buffer->sectionStack.empty() ? INVALID_SECTION_ID : buffer->sectionStack.back(),
+                                 std::memory_order_relaxed);
     
-    if (depth >= m_Config.maxDepth) {
-        return; // Profundidade máxima atingida
+    // Agrega antes de encher quando ninguém chama Flush (sem esperar pelo lock)
+    if (used + 1 > capacity - capacity / 4) {
+        TryFlush();
     }
+}
+
+void Profiler::BeginSection(const std::string& name) {
+    if (!IsEnabled()) return;
     
-    ActiveSection newSection(name, parent, depth);
+    SectionId section = RegisterSection(name);
+    bool recorded = BeginSection(section);
+    GetThreadBuffer()->namedSections.emplace_back(section, recorded);
+}
+
+void Profiler::EndSection(const std::string& name) {
+    ThreadBuffer* buffer = s_ThreadBuffer;
+    if (!buffer || buffer->namedSections.empty()) {
+        return;
+    }
     
-    if (m_Config.enableMemoryProfiling) {
-        newSection.memorySnapshot = GetCurrentMemoryUsage();
+    auto [section, recorded] = buffer->namedSections.back();
+    if (GetSectionName(section) != name) {
+        return; // Seção não encontrada ou não iniciada
     }
     
-    s_ActiveSections.push_back(newSection);
+    buffer->namedSections.pop_back();
+    if (recorded) {
+        EndSection(section);
+    }
+}
+
+void Profiler::BeginSection(const std::string& name, const std::string& parent) {
+    (void)parent;
+    BeginSection(name); // O pai é o aninhamento real
 }
 
 void Profiler::EndSection(const std::string& name, const std::string& parent) {
     EndSection(name); // A implementação atual não usa o parent
 }
 
+void Profiler::Flush() {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
+}
+
+void Profiler::BeginFrame() {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    m_FrameStartNs = GetCurrentTimeNs();
+}
+
+void Profiler::EndFrame() {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
+    
+    const uint64_t endNs = GetCurrentTimeNs();
+    const uint64_t startNs = m_FrameStartNs != 0 ? m_FrameStartNs : endNs;
+    const uint64_t frameNs = endNs - startNs;
+    m_FrameStartNs = endNs; // Início do próximo frame se BeginFrame não for chamado
+    m_FrameIndex++;
+    
+    // Sem visualizador conectado o frame nem é montado
+    const bool streaming = ProfilerStreamServer::GetInstance().HasClients();
+    ProfilerStreamFrame streamFrame;
+    if (streaming) {
+        streamFrame.index = m_FrameIndex;
+        streamFrame.startNs = startNs;
+        streamFrame.durationNs = frameNs;
+        streamFrame.sections.reserve(m_FrameSections.size());
+    }
+    
+    // Percentis: o frame inteiro e cada seção que rodou nele
+    const size_t window = std::max<size_t>(m_Config.frameHistorySize, 1);
+    m_FrameWindow.Push(frameNs, window);
+    m_LastFrameSections.clear();
+    for (SectionId section : m_FrameSections) {
+        m_LastFrameSections.push_back({section, m_FrameSectionTimes[section]});
+        if (streaming) {
+            streamFrame.sections.emplace_back(section, m_FrameSectionTimes[section]);
+        }
+        m_SectionWindows[section].Push(m_FrameSectionTimes[section], window);
+        m_FrameSectionTimes[section] = 0;
+    }
+    m_FrameSections.clear();
+    
+    std::vector<ProfileCounterSample> frameCounters;
+    SampleCounters(endNs, frameCounters);
+    if (streaming) {
+        PublishStreamFrame(streamFrame, frameCounters);
+    }
+    
+    if (m_Capturing) {
+        m_CaptureCounters.insert(m_CaptureCounters.end(), frameCounters.begin(), frameCounters.end());
+        m_CaptureFrameEnds.push_back(endNs);
+        if (--m_CaptureFramesRemaining == 0) {
+            m_Capturing = false;
+            DRIFT_LOG_INFO("[Profiler] Captura concluída: " << m_CaptureEvents.size() << " seções em "
+                           << m_CaptureFrameEnds.size() << " frames");
+        }
+    }
+    
+    // Detector de picos: mantém a timeline dos últimos frames e grava quando um deles estoura
+    if (m_Config.spikeThresholdMs > 0.0) {
+        m_SpikeHistory.push_back({startNs, endNs, std::move(m_FrameEvents), std::move(frameCounters)});
+        m_FrameEvents.clear();
+        while (m_SpikeHistory.size() > std::max<size_t>(m_Config.spikeHistoryFrames, 1)) {
+            m_SpikeHistory.pop_front();
+        }
+        if (frameNs > static_cast<uint64_t>(m_Config.spikeThresholdMs * 1000000.0)) {
+            DumpSpike(frameNs);
+            m_FrameStartNs = GetCurrentTimeNs(); // A gravação não conta no próximo frame
+        }
+    } else if (!m_SpikeHistory.empty()) {
+        m_SpikeHistory.clear();
+    }
+    
+    MemoryProfiler::GetInstance().EndFrame();
+    SamplingProfiler::GetInstance().Collect();
+}
+
+uint64_t Profiler::GetFrameIndex() const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    return m_FrameIndex;
+}
+
+FramePercentiles Profiler::GetFramePercentiles() const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    return m_FrameWindow.Compute();
+}
+
+FramePercentiles Profiler::GetSectionPercentiles(const std::string& name) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    auto it = m_SectionIds.find(name);
+    if (it == m_SectionIds.end()) {
+        return FramePercentiles{};
+    }
+    return m_SectionWindows[it->second].Compute();
+}
+
+size_t Profiler::CopyFrameTimes(uint64_t* out, size_t capacity) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    // O ring está em ordem a partir de 'next' quando cheio; senão desde o início
+    const auto& samples = m_FrameWindow.samples;
+    const size_t count = std::min(capacity, samples.size());
+    const size_t oldest = samples.size() - count;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = samples[(m_FrameWindow.next + oldest + i) % samples.size()];
+    }
+    return count;
+}
+
+size_t Profiler::CopyLastFrameSections(ProfileFrameSection* out, size_t capacity) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    ProfileFrameSection* end = std::partial_sort_copy(
+        m_LastFrameSections.begin(), m_LastFrameSections.end(), out, out + capacity,
+        [](const ProfileFrameSection& a, const ProfileFrameSection& b) { return a.timeNs > b.timeNs; });
+    return static_cast<size_t>(end - out);
+}
+
+size_t Profiler::CopySectionName(SectionId section, char* out, size_t capacity) const {
+    if (capacity == 0) {
+        return 0;
+    }
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    size_t length = 0;
+    if (section < m_SectionNames.size()) {
+        length = std::min(m_SectionNames[section].size(), capacity - 1);
+        std::memcpy(out, m_SectionNames[section].data(), length);
+    }
+    out[length] = '\0';
+    return length;
+}
+
+void Profiler::FrameWindow::Push(uint64_t timeNs, size_t capacity) {
+    if (samples.size() > capacity) {
+        samples.clear();    // A janela encolheu (Configure): recomeça
+        next = 0;
+    }
+    if (samples.size() < capacity) {
+        samples.push_back(timeNs);
+        return;
+    }
+    samples[next] = timeNs;    // Cheia: sobrescreve o mais antigo
+    next = (next + 1) % capacity;
+}
+
+FramePercentiles Profiler::FrameWindow::Compute() const {
+    FramePercentiles result;
+    if (samples.empty()) {
+        return result;
+    }
+    
+    std::vector<uint64_t> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    // Nearest-rank: o menor valor com pelo menos p% das amostras abaixo ou igual
+    auto rank = [&sorted](double p) {
+        size_t index = static_cast<size_t>(std::ceil(p * sorted.size()));
+        return sorted[std::min(std::max<size_t>(index, 1), sorted.size()) - 1];
+    };
+    result.p50Ns = rank(0.50);
+    result.p95Ns = rank(0.95);
+    result.p99Ns = rank(0.99);
+    result.maxNs = sorted.back();
+    result.sampleCount = static_cast<uint32_t>(sorted.size());
+    return result;
+}
+
+void Profiler::DumpSpike(uint64_t frameNs) {
+    if (m_SpikeDumps >= m_Config.maxSpikeDumps || m_SpikeHistory.empty()) {
+        return;
+    }
+    
+    std::vector<ProfileTimelineEvent> events;
+    std::vector<ProfileCounterSample> counters;
+    std::vector<uint64_t> frameEnds;
+    for (auto& frame : m_SpikeHistory) {
+        events.insert(events.end(), frame.events.begin(), frame.events.end());
+        counters.insert(counters.end(), frame.counters.begin(), frame.counters.end());
+        frameEnds.push_back(frame.endNs);
+    }
+    uint64_t startNs = m_SpikeHistory.front().startNs;
+    
+    std::error_code ec;
+    std::filesystem::create_directories(m_Config.spikeDirectory, ec);
+    std::string filename = (std::filesystem::path(m_Config.spikeDirectory) /
+        ("spike_frame" + std::to_string(m_FrameIndex) + "_" + std::to_string(frameNs / 1000000) + "ms.json")).string();
+    
+    DRIFT_LOG_WARNING("[Profiler] Pico de frame: " << FormatDuration(frameNs));
+    if (WriteChromeTrace(filename, events, counters, frameEnds, startNs, 0)) {
+        m_SpikeDumps++;
+    }
+    
+    // O próximo arquivo só sai com frames novos
+    m_SpikeHistory.clear();
+}
+
+void Profiler::SetThreadName(const std::string& name) {
+    ThreadBuffer* buffer = s_ThreadBuffer;
+    if (!buffer) {
+        t_PendingThreadName = name;
+        return;
+    }
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    m_ThreadNames[buffer->threadIndex] = name;
+}
+
+std::string Profiler::GetThreadNameByIndex(uint32_t threadIndex) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    return GetThreadNameLocked(threadIndex);
+}
+
+bool Profiler::GetSamplingContext(uint32_t& threadIndex, SectionId& section) {
+    ThreadBuffer* buffer = s_ThreadBuffer;
+    if (!buffer) {
+        return false;
+    }
+    threadIndex = buffer->threadIndex;
+    section = buffer->currentSection.load(std::memory_order_relaxed);
+    return true;
+}
+
+void Profiler::StartCapture(uint32_t frameCount) {
+    if (frameCount == 0) {
+        return;
+    }
+    
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents(); // Eventos anteriores ficam fora da captura
+    
+    m_Capturing = true;
+    m_CaptureFramesRemaining = frameCount;
+    m_CaptureStartNs = GetCurrentTimeNs();
+    m_CaptureDroppedEvents = 0;
+    m_CaptureEvents.clear();
+    m_CaptureCounters.clear();
+    m_CaptureFrameEnds.clear();
+    DRIFT_LOG_INFO("[Profiler] Capturando timeline por " << frameCount << " frames");
+}
+
+void Profiler::StopCapture() {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
+    m_Capturing = false;
+}
+
+bool Profiler::IsCapturing() const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    return m_Capturing;
+}
+
+bool Profiler::ExportChromeTrace(const std::string& filename) const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
+    
+    if (m_CaptureEvents.empty() && m_CaptureFrameEnds.empty()) {
+        DRIFT_LOG_WARNING("[Profiler] Nenhuma captura para exportar");
+        return false;
+    }
+    
+    return WriteChromeTrace(filename, m_CaptureEvents, m_CaptureCounters, m_CaptureFrameEnds, m_CaptureStartNs,
+                            m_CaptureDroppedEvents);
+}
+
+bool Profiler::WriteChromeTrace(const std::string& filename, const std::vector<ProfileTimelineEvent>& events,
+                                const std::vector<ProfileCounterSample>& counters, const std::vector<uint64_t>& frameEnds,
+                                uint64_t startNs, uint64_t droppedEvents) const {
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open()) {
+        DRIFT_LOG_ERROR("[Profiler] Não foi possível criar: " << filename);
+        return false;
+    }
+    
+    // Formato "JSON Object" do Chrome trace: eventos completos (ph X) por thread,
+    // metadados com os nomes das threads, contadores (ph C, uma trilha cada) e marcadores
+    // globais (ph i) de fim de frame
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file << "{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"DriftEngine\"}}";
+    
+    std::vector<uint32_t> threads;
+    for (const auto& event : events) {
+        threads.push_back(event.threadIndex);
+    }
+    std::sort(threads.begin(), threads.end());
+    threads.erase(std::unique(threads.begin(), threads.end()), threads.end());
+    for (uint32_t thread : threads) {
+        file << ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":" << thread << ",\"name\":\"thread_name\",\"args\":{\"name\":";
+        AppendJsonString(file, GetThreadNameLocked(thread));
+        file << "}}";
+        file << ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+             << ",\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":" << thread << "}}";
+    }
+    
+    for (const auto& event : events) {
+        uint64_t start = event.startNs > startNs ? event.startNs - startNs : 0;
+        file << ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadIndex << ",\"name\":";
+        AppendJsonString(file, GetSectionNameLocked(event.section));
+        file << ",\"ts\":";
+        AppendMicroseconds(file, start);
+        file << ",\"dur\":";
+        AppendMicroseconds(file, event.endNs > event.startNs ? event.endNs - event.startNs : 0);
+        file << ",\"args\":{\"depth\":" << event.depth << "}}";
+    }
+    
+    for (const auto& sample : counters) {
+        file << ",\n{\"ph\":\"C\",\"pid\":1,\"name\":";
+        AppendJsonString(file, m_Counters[sample.counter].name);
+        file << ",\"ts\":";
+        AppendMicroseconds(file, sample.timeNs > startNs ? sample.timeNs - startNs : 0);
+        file << ",\"args\":{\"value\":" << (std::isfinite(sample.value) ? sample.value : 0.0) << "}}";
+    }
+    
+    for (size_t frame = 0; frame < frameEnds.size(); ++frame) {
+        uint64_t end = frameEnds[frame];
+        file << ",\n{\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"name\":\"Frame " << frame << "\",\"ts\":";
+        AppendMicroseconds(file, end > startNs ? end - startNs : 0);
+        file << "}";
+    }
+    
+    file << "\n],\"otherData\":{\"frames\":" << frameEnds.size()
+         << ",\"droppedSections\":" << droppedEvents << "}}\n";
+    file.close();
+    
+    if (!file) {
+        DRIFT_LOG_ERROR("[Profiler] Falha de escrita: " << filename);
+        return false;
+    }
+    
+    DRIFT_LOG_INFO("[Profiler] Timeline exportada: " << filename << " (" << events.size() << " seções)");
+    return true;
+}
+
+void Profiler::TryFlush() {
+    std::unique_lock<ProfiledMutex> lock(m_Mutex, std::try_to_lock);
+    if (lock.owns_lock()) {
+        CollectEvents();
+    }
+}
+
+void Profiler::CollectEvents() const {
+    for (auto it = m_ThreadBuffers.begin(); it != m_ThreadBuffers.end();) {
+        ThreadBuffer& buffer = **it;
+        
+        // 'retired' antes do índice: depois de aposentada a thread não grava mais
+        bool retired = buffer.retired.load(std::memory_order_acquire);
+        uint64_t write = buffer.writeIndex.load(std::memory_order_acquire);
+        for (uint64_t read = buffer.readIndex.load(std::memory_order_relaxed); read != write; ++read) {
+            ProcessEvent(buffer, buffer.events[read & buffer.mask]);
+        }
+        buffer.readIndex.store(write, std::memory_order_release);
+        
+        if (retired) {
+            m_RetiredDroppedEvents += buffer.droppedEvents.load(std::memory_order_relaxed);
+            it = m_ThreadBuffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void Profiler::ProcessEvent(ThreadBuffer& buffer, const ProfileEvent& event) const {
+    switch (event.type) {
+        case ProfileEventType::Begin: {
+            uint32_t parent = buffer.open.empty() ? 0 : buffer.open.back().node;
+            uint32_t node = FindOrAddChild(parent, event.section);
+            buffer.open.push_back({event.section, event.timeNs, node, 0, 0, 0, 0, {}, {}});
+            break;
+        }
+        
+        case ProfileEventType::Memory: {
+            if (buffer.open.empty() || buffer.open.back().section != event.section) {
+                break;
+            }
+            auto& open = buffer.open.back();
+            (open.memoryMarks++ == 0 ? open.memoryStart : open.memoryEnd) = static_cast<size_t>(event.timeNs);
+            break;
+        }
+        
+        case ProfileEventType::Counter: {
+            if (buffer.open.empty() || buffer.open.back().section != event.section) {
+                break;
+            }
+            auto& open = buffer.open.back();
+            if (open.counterMarks < HARDWARE_COUNTER_COUNT) {
+                open.counterStart[open.counterMarks++] = event.timeNs;
+            } else if (open.counterMarks < 2 * HARDWARE_COUNTER_COUNT) {
+                open.counterEnd[open.counterMarks++ - HARDWARE_COUNTER_COUNT] = event.timeNs;
+            }
+            break;
+        }
+        
+        case ProfileEventType::End: {
+            // Seções abertas antes de um Clear não têm Begin aqui: descarta as internas sem par
+            while (!buffer.open.empty() && buffer.open.back().section != event.section) {
+                buffer.open.pop_back();
+            }
+            if (buffer.open.empty()) {
+                break;
+            }
+            
+            auto open = buffer.open.back();
+            buffer.open.pop_back();
+            uint64_t durationNs = event.timeNs > open.startNs ? event.timeNs - open.startNs : 0;
+            
+            ProfileNode& node = m_CallTree[open.node];
+            SectionStats& stats = m_SectionStats[event.section];
+            for (SectionStats* target : {&node.stats, &stats}) {
+                if (target->callCount == 0) {
+                    target->threadId = buffer.threadId;
+                    target->threadIndex = buffer.threadIndex;
+                }
+                RecordSample(*target, durationNs, event.timeNs);
+                if (open.memoryMarks >= 2) {
+                    RecordMemorySample(*target, open.memoryEnd > open.memoryStart ? open.memoryEnd - open.memoryStart : 0);
+                }
+                if (open.counterMarks == 2 * HARDWARE_COUNTER_COUNT) {
+                    RecordCounterSample(*target, open.counterStart, open.counterEnd);
+                }
+            }
+            
+            node.stats.depth = node.depth;
+            stats.depth = node.depth;
+            
+            // Tempo da seção no frame atual (percentis por frame)
+            if (m_FrameSectionTimes[event.section] == 0) {
+                m_FrameSections.push_back(event.section);
+            }
+            m_FrameSectionTimes[event.section] += std::max<uint64_t>(durationNs, 1);
+            
+            ProfileTimelineEvent timelineEvent{open.startNs, event.timeNs, event.section, buffer.threadIndex, node.depth};
+            if (m_Capturing) {
+                if (m_CaptureEvents.size() < m_Config.captureEventLimit) {
+                    m_CaptureEvents.push_back(timelineEvent);
+                } else {
+                    m_CaptureDroppedEvents++;
+                }
+            }
+            if (m_Config.spikeThresholdMs > 0.0 && m_FrameEvents.size() < m_Config.captureEventLimit) {
+                m_FrameEvents.push_back(timelineEvent);
+            }
+            SectionId parent = buffer.open.empty() ? INVALID_SECTION_ID : buffer.open.back().section;
+            static const std::string noParent;
+            const std::string& parentName = parent == INVALID_SECTION_ID ? noParent : m_SectionNames[parent];
+            if (stats.parentSection != parentName) {
+                stats.parentSection = parentName;
+            }
+            break;
+        }
+    }
+}
+
+uint32_t Profiler::FindOrAddChild(uint32_t parent, SectionId section) const {
+    for (uint32_t child : m_CallTree[parent].children) {
+        if (m_CallTree[child].section == section) {
+            return child;
+        }
+    }
+    
+    ProfileNode node;
+    node.section = section;
+    node.parent = parent;
+    node.depth = parent == 0 ? 0 : m_CallTree[parent].depth + 1;
+    
+    uint32_t index = static_cast<uint32_t>(m_CallTree.size());
+    m_CallTree.push_back(std::move(node));
+    m_CallTree[parent].children.push_back(index);
+    return index;
+}
+
 SectionStats Profiler::GetSectionStats(const std::string& name) const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    auto it = m_Sections.find(name);
-    if (it != m_Sections.end()) {
-        return it->second;
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
+    auto it = m_SectionIds.find(name);
+    if (it != m_SectionIds.end()) {
+        return m_SectionStats[it->second];
     }
     return SectionStats{};
 }
 
 std::vector<std::string> Profiler::GetSectionNames() const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
     std::vector<std::string> names;
-    names.reserve(m_Sections.size());
     
-    for (const auto& pair : m_Sections) {
-        names.push_back(pair.first);
+    for (SectionId section = 0; section < m_SectionStats.size(); ++section) {
+        if (m_SectionStats[section].callCount > 0) {
+            names.push_back(m_SectionNames[section]);
+        }
     }
     
     return names;
 }
 
 std::vector<std::pair<std::string, SectionStats>> Profiler::GetAllStats() const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
     std::vector<std::pair<std::string, SectionStats>> result;
-    result.reserve(m_Sections.size());
     
-    for (const auto& pair : m_Sections) {
-        result.emplace_back(pair.first, pair.second);
+    for (SectionId section = 0; section < m_SectionStats.size(); ++section) {
+        if (m_SectionStats[section].callCount > 0) {
+            result.emplace_back(m_SectionNames[section], m_SectionStats[section]);
+        }
     }
     
     return result;
 }
 
+std::vector<ProfileNode> Profiler::GetCallTree() const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
+    return m_CallTree;
+}
+
+uint64_t Profiler::GetDroppedEventCount() const {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    uint64_t dropped = m_RetiredDroppedEvents;
+    for (const auto& buffer : m_ThreadBuffers) {
+        dropped += buffer->droppedEvents.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
 void Profiler::PrintReport() const {
     std::string report = GenerateReport();
     
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
     for (auto& output : m_Outputs) {
         output->WriteReport(report);
     }
@@ -216,26 +1094,27 @@ void Profiler::ExportReport(const std::string& filename) const {
 }
 
 std::string Profiler::GenerateReport() const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
+    
+    // Converte para vector para ordenar
+    std::vector<std::pair<std::string, SectionStats>> sortedSections;
+    for (SectionId section = 0; section < m_SectionStats.size(); ++section) {
+        if (m_SectionStats[section].callCount > 0) {
+            sortedSections.emplace_back(m_SectionNames[section], m_SectionStats[section]);
+        }
+    }
     
-    if (m_Sections.empty()) {
+    if (sortedSections.empty()) {
         return "Profiler: Nenhuma seção registrada";
     }
     
     std::stringstream ss;
     ss << "\n=== RELATÓRIO DE PERFORMANCE ===" << std::endl;
     ss << "Gerado em: " << Drift::Core::GetTimestamp() << std::endl;
-    ss << "Total de seções: " << m_Sections.size() << std::endl;
+    ss << "Total de seções: " << sortedSections.size() << std::endl;
     ss << std::endl;
     
-    // Converte para vector para ordenar
-    std::vector<std::pair<std::string, SectionStats>> sortedSections;
-    sortedSections.reserve(m_Sections.size());
-    
-    for (const auto& pair : m_Sections) {
-        sortedSections.emplace_back(pair.first, pair.second);
-    }
-    
     // Ordena por tempo total (mais lento primeiro)
     std::sort(sortedSections.begin(), sortedSections.end(),
         [](const auto& a, const auto& b) {
@@ -253,8 +1132,6 @@ std::string Profiler::GenerateReport() const {
     ss << std::string(100, '-') << std::endl;
     
     for (const auto& [name, stats] : sortedSections) {
-        if (stats.callCount == 0) continue;
-        
         ss << std::left << std::setw(30) << name
            << std::setw(8) << stats.callCount
            << std::setw(12) << std::fixed << std::setprecision(3) << stats.GetAverageTimeMs()
@@ -265,71 +1142,236 @@ std::string Profiler::GenerateReport() const {
     }
     
     ss << std::string(100, '-') << std::endl;
+    
+    AppendHardwareCounters(ss, sortedSections);
+    
+    if (m_FrameIndex > 0) {
+        AppendPercentiles(ss);
+        AppendCounters(ss);
+    }
+    
+    AppendLockContention(ss);
+    
+    // Árvore de chamadas: tempo de cada caminho e sua fração do pai
+    ss << std::endl << "Árvore de chamadas:" << std::endl;
+    AppendCallTree(ss, 0, 0);
+    
+    if (MemoryProfiler::IsAllocationTrackingEnabled()) {
+        ss << MemoryProfiler::GetInstance().GenerateReport();
+    }
+    
+    uint64_t dropped = m_RetiredDroppedEvents;
+    for (const auto& buffer : m_ThreadBuffers) {
+        dropped += buffer->droppedEvents.load(std::memory_order_relaxed);
+    }
+    if (dropped > 0) {
+        ss << std::endl << "Seções descartadas (buffer cheio): " << dropped << std::endl;
+    }
+    
     ss << "================================" << std::endl;
     
     return ss.str();
 }
 
-void Profiler::Clear() {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    m_Sections.clear();
+void Profiler::AppendPercentiles(std::ostream& out) const {
+    FramePercentiles frame = m_FrameWindow.Compute();
+    out << std::endl << "Percentis por frame (últimos " << frame.sampleCount << " frames):" << std::endl;
+    out << std::left << std::setw(30) << "Seção"
+        << std::setw(8) << "Frames"
+        << std::setw(12) << "p50 (ms)"
+        << std::setw(12) << "p95 (ms)"
+        << std::setw(12) << "p99 (ms)"
+        << std::setw(12) << "Max (ms)" << std::endl;
+    
+    auto appendRow = [&out](const std::string& name, const FramePercentiles& percentiles) {
+        out << std::left << std::setw(30) << name
+            << std::setw(8) << percentiles.sampleCount
+            << std::setw(12) << std::fixed << std::setprecision(3) << percentiles.GetP50Ms()
+            << std::setw(12) << percentiles.GetP95Ms()
+            << std::setw(12) << percentiles.GetP99Ms()
+            << std::setw(12) << percentiles.GetMaxMs() << std::endl;
+    };
+    appendRow("[Frame]", frame);
+    
+    // Seções ordenadas pelo p95 (as que mais pesam nos frames ruins primeiro)
+    std::vector<std::pair<SectionId, FramePercentiles>> sections;
+    for (SectionId section = 0; section < m_SectionWindows.size(); ++section) {
+        if (!m_SectionWindows[section].samples.empty()) {
+            sections.emplace_back(section, m_SectionWindows[section].Compute());
+        }
+    }
+    std::sort(sections.begin(), sections.end(), [](const auto& a, const auto& b) {
+        return a.second.p95Ns > b.second.p95Ns;
+    });
+    for (const auto& [section, percentiles] : sections) {
+        appendRow(m_SectionNames[section], percentiles);
+    }
+    out << std::string(100, '-') << std::endl;
 }
 
-void Profiler::Reset() {
-    Clear();
-    m_ThreadCounter = 0;
-    m_ThreadIndices.clear();
+void Profiler::AppendCounters(std::ostream& out) const {
+    if (m_Counters.empty()) {
+        return;
+    }
+    
+    out << std::endl << "Contadores por frame:" << std::endl;
+    out << std::left << std::setw(30) << "Contador"
+        << std::setw(8) << "Frames"
+        << std::setw(14) << "Last"
+        << std::setw(14) << "Avg"
+        << std::setw(14) << "Min"
+        << std::setw(14) << "Max" << std::endl;
+    
+    for (const auto& series : m_Counters) {
+        if (series.samples.empty()) {
+            continue;
+        }
+        size_t last = (series.next + series.samples.size() - 1) % series.samples.size();
+        auto [minIt, maxIt] = std::minmax_element(series.samples.begin(), series.samples.end());
+        double sum = 0.0;
+        for (double value : series.samples) {
+            sum += value;
+        }
+        out << std::left << std::setw(30) << series.name
+            << std::setw(8) << series.samples.size()
+            << std::setw(14) << std::fixed << std::setprecision(2) << series.samples[last]
+            << std::setw(14) << sum / series.samples.size()
+            << std::setw(14) << *minIt
+            << std::setw(14) << *maxIt << std::endl;
+    }
+    out << std::string(100, '-') << std::endl;
 }
 
-uint64_t Profiler::GetCurrentTimeNs() const {
-    auto now = std::chrono::high_resolution_clock::now();
-    return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+void Profiler::AppendLockContention(std::ostream& out) const {
+    std::vector<LockStatsSnapshot> locks = ProfiledMutex::GetAllStats();
+    locks.erase(std::remove_if(locks.begin(), locks.end(),
+                               [](const LockStatsSnapshot& lock) { return lock.acquisitions == 0; }),
+                locks.end());
+    if (locks.empty()) {
+        return;
+    }
+    
+    // Mais espera primeiro: um lock em comboio aparece no topo mesmo com posse curta
+    std::sort(locks.begin(), locks.end(), [](const LockStatsSnapshot& a, const LockStatsSnapshot& b) {
+        return a.waitNs > b.waitNs;
+    });
+    
+    out << std::endl << "Contenção de locks:" << std::endl;
+    out << std::left << std::setw(30) << "Lock"
+        << std::setw(12) << "Acquires"
+        << std::setw(10) << "Cont %"
+        << std::setw(12) << "Wait (ms)"
+        << std::setw(14) << "Avg Wait (us)"
+        << std::setw(14) << "Max Wait (ms)"
+        << std::setw(14) << "Avg Hold (us)"
+        << std::setw(14) << "Max Hold (ms)" << std::endl;
+    
+    for (const auto& lock : locks) {
+        out << std::left << std::setw(30) << lock.name
+            << std::setw(12) << lock.acquisitions
+            << std::setw(10) << std::fixed << std::setprecision(2) << lock.GetContentionPercent()
+            << std::setw(12) << std::setprecision(3) << lock.waitNs / 1e6
+            << std::setw(14) << lock.GetAverageWaitUs()
+            << std::setw(14) << lock.maxWaitNs / 1e6
+            << std::setw(14) << lock.GetAverageHoldUs()
+            << std::setw(14) << lock.maxHoldNs / 1e6 << std::endl;
+    }
+    out << std::string(100, '-') << std::endl;
 }
 
-size_t Profiler::GetCurrentMemoryUsage() const {
-    // Implementação básica - pode ser expandida para usar APIs específicas do sistema
-    return 0;
+void Profiler::AppendHardwareCounters(std::ostream& out, const std::vector<std::pair<std::string, SectionStats>>& sections) const {
+    bool any = std::any_of(sections.begin(), sections.end(), [](const auto& entry) {
+        return entry.second.counterSamples > 0;
+    });
+    if (!any) {
+        return;
+    }
+    
+    // Médias por chamada e taxas por mil instruções (MPKI)
+    out << std::endl << "Contadores de hardware (por chamada):" << std::endl;
+    out << std::left << std::setw(30) << "Seção"
+        << std::setw(12) << "Ciclos"
+        << std::setw(12) << "Instr"
+        << std::setw(8) << "IPC"
+        << std::setw(12) << "L1D/kInstr"
+        << std::setw(12) << "LLC/kInstr"
+        << std::setw(12) << "Br/kInstr" << std::endl;
+    
+    for (const auto& [name, stats] : sections) {
+        if (stats.counterSamples == 0) {
+            continue;
+        }
+        out << std::left << std::setw(30) << name
+            << std::setw(12) << stats.cycles / stats.counterSamples
+            << std::setw(12) << stats.instructions / stats.counterSamples
+            << std::setw(8) << std::fixed << std::setprecision(2) << stats.GetIPC()
+            << std::setw(12) << stats.GetL1DMissesPerKInstr()
+            << std::setw(12) << stats.GetLLCMissesPerKInstr()
+            << std::setw(12) << stats.GetBranchMissesPerKInstr() << std::endl;
+    }
+    out << std::string(100, '-') << std::endl;
 }
 
-void Profiler::UpdateStats(const std::string& name, uint64_t durationNs, const std::string& parent, uint32_t depth) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
-    auto& stats = m_Sections[name];
+void Profiler::AppendCallTree(std::ostream& out, uint32_t node, uint64_t parentTimeNs) const {
+    std::vector<uint32_t> children = m_CallTree[node].children;
+    std::sort(children.begin(), children.end(), [this](uint32_t a, uint32_t b) {
+        return m_CallTree[a].stats.totalTimeNs > m_CallTree[b].stats.totalTimeNs;
+    });
     
-    if (stats.callCount == 0) {
-        stats.firstCall = std::chrono::steady_clock::now();
-        stats.threadId = std::this_thread::get_id();
+    for (uint32_t child : children) {
+        const ProfileNode& childNode = m_CallTree[child];
+        if (childNode.stats.callCount == 0) {
+            continue;
+        }
         
-        // Atribuir índice de thread se não existir
-        auto threadIt = m_ThreadIndices.find(stats.threadId);
-        if (threadIt == m_ThreadIndices.end()) {
-            stats.threadIndex = m_ThreadCounter++;
-            m_ThreadIndices[stats.threadId] = stats.threadIndex;
-        } else {
-            stats.threadIndex = threadIt->second;
+        std::string label = std::string(2 * childNode.depth, ' ') + GetSectionNameLocked(childNode.section);
+        out << std::left << std::setw(40) << label
+            << std::setw(8) << childNode.stats.callCount
+            << std::setw(12) << std::fixed << std::setprecision(3) << childNode.stats.GetTotalTimeMs();
+        if (parentTimeNs > 0) {
+            out << std::fixed << std::setprecision(1) << 100.0 * childNode.stats.totalTimeNs / parentTimeNs << "%";
         }
+        out << std::endl;
+        AppendCallTree(out, child, childNode.stats.totalTimeNs);
     }
+}
+
+void Profiler::Clear() {
+    std::lock_guard<ProfiledMutex> lock(m_Mutex);
+    CollectEvents();
     
-    stats.callCount++;
-    stats.totalTimeNs += durationNs;
-    stats.minTimeNs = std::min(stats.minTimeNs, durationNs);
-    stats.maxTimeNs = std::max(stats.maxTimeNs, durationNs);
-    stats.lastTimeNs = durationNs;
-    stats.lastCall = std::chrono::steady_clock::now();
-    stats.depth = depth;
-    stats.parentSection = parent;
+    // Os ids continuam válidos (estão em statics dos pontos de chamada); só os dados zeram
+    m_SectionStats.assign(m_SectionNames.size(), SectionStats{});
+    m_CallTree.clear();
+    m_CallTree.emplace_back();
+    for (auto& buffer : m_ThreadBuffers) {
+        buffer->open.clear();
+        buffer->droppedEvents.store(0, std::memory_order_relaxed);
+    }
+    m_RetiredDroppedEvents = 0;
     
-    // Atualizar estatísticas avançadas
-    stats.UpdateVariance(durationNs);
+    m_FrameSectionTimes.assign(m_SectionNames.size(), 0);
+    m_FrameSections.clear();
+    m_FrameEvents.clear();
+    m_FrameWindow = FrameWindow{};
+    m_LastFrameSections.clear();
+    m_SectionWindows.assign(m_SectionNames.size(), FrameWindow{});
+    m_SpikeHistory.clear();
+    for (auto& series : m_Counters) {
+        series.samples.clear();
+        series.next = 0;
+    }
+    ProfiledMutex::ResetAllStats();
 }
 
-void Profiler::UpdateMemoryStats(const std::string& name, size_t memoryUsage) {
-    std::lock_guard<std::mutex> lock(m_Mutex);
-    
-    auto& stats = m_Sections[name];
-    stats.totalMemoryAllocated += memoryUsage;
-    stats.peakMemoryUsage = std::max(stats.peakMemoryUsage, memoryUsage);
-    stats.currentMemoryUsage = memoryUsage;
+void Profiler::Reset() {
+    Clear();
+}
+
+size_t Profiler::GetCurrentMemoryUsage() const {
+    // Com o rastreamento de alocações, o total vivo de operator new; senão a contagem manual
+    const MemoryProfiler& memory = MemoryProfiler::GetInstance();
+    return MemoryProfiler::IsAllocationTrackingEnabled() ? memory.GetTrackedLiveBytes() : memory.GetCurrentUsage();
 }
 
 std::string Profiler::FormatDuration(uint64_t nanoseconds) const {
@@ -357,31 +1399,27 @@ std::string Profiler::FormatMemory(size_t bytes) const {
 }
 
 std::string Profiler::GetThreadName(std::thread::id threadId) const {
-    auto it = m_ThreadIndices.find(threadId);
-    if (it != m_ThreadIndices.end()) {
-        return "Thread-" + std::to_string(it->second);
+    for (const auto& buffer : m_ThreadBuffers) {
+        if (buffer->threadId == threadId) {
+            return GetThreadNameLocked(buffer->threadIndex);
+        }
     }
     return "Thread-Unknown";
 }
 
-// Implementação do ScopedProfiler
-ScopedProfiler::ScopedProfiler(const std::string& name, const std::string& parent)
-    : m_Name(name), m_Parent(parent), m_IsActive(true) {
-    Profiler::GetInstance().BeginSection(name, parent);
-    m_StartTime = std::chrono::high_resolution_clock::now();
-    m_StartMemory = Profiler::GetInstance().GetCurrentMemoryUsage();
+std::string Profiler::GetThreadNameLocked(uint32_t threadIndex) const {
+    auto it = m_ThreadNames.find(threadIndex);
+    return it != m_ThreadNames.end() ? it->second : "Thread-" + std::to_string(threadIndex);
 }
 
-ScopedProfiler::~ScopedProfiler() {
-    if (m_IsActive) {
-        End();
-    }
-}
-
-void ScopedProfiler::End() {
-    if (m_IsActive) {
-        Profiler::GetInstance().EndSection(m_Name);
-        m_IsActive = false;
+// Implementação do ScopedProfiler
+ScopedProfiler::ScopedProfiler(const std::string& name, const std::string& parent)
+    : m_Section(INVALID_SECTION_ID), m_IsActive(false) {
+    (void)parent;
+    Profiler& profiler = Profiler::GetInstance();
+    if (profiler.IsEnabled()) {
+        m_Section = profiler.RegisterSection(name);
+        m_IsActive = profiler.BeginSection(m_Section);
     }
 }
 
@@ -455,6 +1493,12 @@ void SectionStats::Reset() {
     totalMemoryAllocated = 0;
     peakMemoryUsage = 0;
     currentMemoryUsage = 0;
+    counterSamples = 0;
+    cycles = 0;
+    instructions = 0;
+    l1dMisses = 0;
+    llcMisses = 0;
+    branchMisses = 0;
     threadIndex = 0;
     depth = 0;
     parentSection.clear();
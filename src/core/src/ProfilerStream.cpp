@@ -0,0 +1,571 @@
+#include "Drift/Core/ProfilerStream.h"
+#include "Drift/Core/Log.h"
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace Drift::Core {
+
+namespace {
+
+constexpr size_t MESSAGE_HEADER_SIZE = sizeof(uint8_t) + sizeof(uint32_t);
+constexpr size_t MAX_PENDING_FRAMES = 64;           // Fila do EndFrame até a thread do servidor
+constexpr size_t MAX_CLIENT_BACKLOG = 4 << 20;      // Bytes não enviados antes de descartar frames
+constexpr uint32_t MAX_MESSAGE_SIZE = 64 << 20;     // Acima disso o stream está corrompido
+constexpr uint32_t MAX_STREAM_ID = 1 << 20;         // Ids vindos do socket indexam vetores do cliente
+
+template<typename T>
+void Put(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool Get(const char*& cursor, const char* end, T& value) {
+    if (static_cast<size_t>(end - cursor) < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return true;
+}
+
+bool GetString(const char*& cursor, const char* end, std::string& value) {
+    uint32_t length = 0;
+    if (!Get(cursor, end, length) || static_cast<size_t>(end - cursor) < length) {
+        return false;
+    }
+    value.assign(cursor, length);
+    cursor += length;
+    return true;
+}
+
+// Reserva o cabeçalho; FinishMessage escreve o tamanho quando o payload está completo
+size_t BeginMessage(std::string& out, ProfilerStreamMessage type) {
+    Put(out, static_cast<uint8_t>(type));
+    Put(out, uint32_t{0});
+    return out.size();
+}
+
+void FinishMessage(std::string& out, size_t payloadStart) {
+    uint32_t size = static_cast<uint32_t>(out.size() - payloadStart);
+    std::memcpy(&out[payloadStart - sizeof(uint32_t)], &size, sizeof(size));
+}
+
+void PutString(std::string& out, const std::string& value) {
+    Put(out, static_cast<uint32_t>(value.size()));
+    out.append(value);
+}
+
+#if !defined(_WIN32)
+
+// "unix:/caminho" ou "tcp:porta"; TCP sempre em 127.0.0.1
+bool ParseAddress(const std::string& address, sockaddr_storage& storage, socklen_t& length, std::string& unixPath) {
+    std::memset(&storage, 0, sizeof(storage));
+    unixPath.clear();
+
+    if (address.rfind("unix:", 0) == 0) {
+        unixPath = address.substr(5);
+        auto* addr = reinterpret_cast<sockaddr_un*>(&storage);
+        if (unixPath.empty() || unixPath.size() >= sizeof(addr->sun_path)) {
+            return false;
+        }
+        addr->sun_family = AF_UNIX;
+        std::memcpy(addr->sun_path, unixPath.c_str(), unixPath.size() + 1);
+        length = static_cast<socklen_t>(sizeof(sockaddr_un));
+        return true;
+    }
+
+    if (address.rfind("tcp:", 0) == 0) {
+        char* end = nullptr;
+        unsigned long port = std::strtoul(address.c_str() + 4, &end, 10);
+        if (end == address.c_str() + 4 || *end != '\0' || port == 0 || port > 65535) {
+            return false;
+        }
+        auto* addr = reinterpret_cast<sockaddr_in*>(&storage);
+        addr->sin_family = AF_INET;
+        addr->sin_port = htons(static_cast<uint16_t>(port));
+        addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        length = static_cast<socklen_t>(sizeof(sockaddr_in));
+        return true;
+    }
+    return false;
+}
+
+void SetNonBlocking(int fd) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+}
+
+ssize_t SendNoSignal(int fd, const char* data, size_t size) {
+#if defined(MSG_NOSIGNAL)
+    return send(fd, data, size, MSG_NOSIGNAL);
+#else
+    return send(fd, data, size, 0);
+#endif
+}
+
+#endif
+
+} // namespace
+
+void AppendStreamSectionName(std::string& out, uint32_t section, const std::string& name) {
+    size_t payload = BeginMessage(out, ProfilerStreamMessage::SectionName);
+    Put(out, section);
+    PutString(out, name);
+    FinishMessage(out, payload);
+}
+
+void AppendStreamCounterName(std::string& out, uint32_t counter, uint8_t type, const std::string& name) {
+    size_t payload = BeginMessage(out, ProfilerStreamMessage::CounterName);
+    Put(out, counter);
+    Put(out, type);
+    PutString(out, name);
+    FinishMessage(out, payload);
+}
+
+void AppendStreamFrame(std::string& out, const ProfilerStreamFrame& frame) {
+    size_t payload = BeginMessage(out, ProfilerStreamMessage::Frame);
+    Put(out, frame.index);
+    Put(out, frame.startNs);
+    Put(out, frame.durationNs);
+    Put(out, static_cast<uint32_t>(frame.sections.size()));
+    Put(out, static_cast<uint32_t>(frame.counters.size()));
+    for (const auto& [section, timeNs] : frame.sections) {
+        Put(out, section);
+        Put(out, timeNs);
+    }
+    for (const auto& [counter, value] : frame.counters) {
+        Put(out, counter);
+        Put(out, value);
+    }
+    FinishMessage(out, payload);
+}
+
+// ============================================================================
+// Servidor
+// ============================================================================
+
+ProfilerStreamServer& ProfilerStreamServer::GetInstance() {
+    static ProfilerStreamServer instance;
+    return instance;
+}
+
+ProfilerStreamServer::~ProfilerStreamServer() {
+    Stop();
+}
+
+void ProfilerStreamServer::Publish(std::string definitions, std::string frame) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_PendingDefinitions += definitions;
+        if (m_PendingFrames.size() >= MAX_PENDING_FRAMES) {
+            m_PendingFrames.pop_front();
+            m_DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_PendingFrames.push_back(std::move(frame));
+    }
+#if !defined(_WIN32)
+    char wake = 1;
+    (void)!write(m_WakeFds[1], &wake, 1);   // Pipe cheio já garante que a thread vai acordar
+#endif
+}
+
+#if !defined(_WIN32)
+
+bool ProfilerStreamServer::Start(const std::string& address) {
+    Stop();
+
+    sockaddr_storage storage;
+    socklen_t length = 0;
+    std::string unixPath;
+    if (!ParseAddress(address, storage, length, unixPath)) {
+        DRIFT_LOG_ERROR("[ProfilerStream] Endereço inválido (use unix:/caminho ou tcp:porta): " << address);
+        return false;
+    }
+
+    int fd = socket(storage.ss_family, SOCK_STREAM, 0);
+    if (fd == -1) {
+        DRIFT_LOG_ERROR("[ProfilerStream] Falha ao criar socket: " << std::strerror(errno));
+        return false;
+    }
+    if (storage.ss_family == AF_INET) {
+        int reuse = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    } else {
+        // Remove só o socket de uma execução anterior que não encerrou; outro arquivo no
+        // caminho é preservado e o bind falha
+        struct stat info{};
+        if (lstat(unixPath.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+            unlink(unixPath.c_str());
+        }
+    }
+    if (bind(fd, reinterpret_cast<sockaddr*>(&storage), length) == -1 || listen(fd, 4) == -1) {
+        DRIFT_LOG_ERROR("[ProfilerStream] Falha ao escutar em " << address << ": " << std::strerror(errno));
+        close(fd);
+        return false;
+    }
+    if (pipe(m_WakeFds) == -1) {
+        DRIFT_LOG_ERROR("[ProfilerStream] Falha ao criar pipe: " << std::strerror(errno));
+        close(fd);
+        if (!unixPath.empty()) {
+            unlink(unixPath.c_str());
+        }
+        return false;
+    }
+    SetNonBlocking(fd);
+    SetNonBlocking(m_WakeFds[0]);
+    SetNonBlocking(m_WakeFds[1]);
+
+    m_ListenFd = fd;
+    m_UnixPath = unixPath;
+    m_Running.store(true, std::memory_order_release);
+    m_Thread = std::thread(&ProfilerStreamServer::Run, this);
+    DRIFT_LOG_INFO("[ProfilerStream] Transmitindo em " << address);
+    return true;
+}
+
+void ProfilerStreamServer::Stop() {
+    if (!m_Thread.joinable()) {
+        return;
+    }
+    m_Running.store(false, std::memory_order_release);
+    char wake = 1;
+    (void)!write(m_WakeFds[1], &wake, 1);
+    m_Thread.join();
+
+    close(m_ListenFd);
+    close(m_WakeFds[0]);
+    close(m_WakeFds[1]);
+    m_ListenFd = m_WakeFds[0] = m_WakeFds[1] = -1;
+    if (!m_UnixPath.empty()) {
+        unlink(m_UnixPath.c_str());
+        m_UnixPath.clear();
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_PendingDefinitions.clear();
+    m_PendingFrames.clear();
+}
+
+void ProfilerStreamServer::Run() {
+    struct Client {
+        int fd;
+        std::string out;
+    };
+    std::vector<Client> clients;
+    std::string definitions;        // Todos os nomes já publicados, para clientes novos
+    std::string hello;
+    size_t payload = BeginMessage(hello, ProfilerStreamMessage::Hello);
+    Put(hello, PROFILER_STREAM_MAGIC);
+    Put(hello, PROFILER_STREAM_VERSION);
+    FinishMessage(hello, payload);
+
+    std::vector<pollfd> fds;
+    char scratch[4096];
+    while (m_Running.load(std::memory_order_acquire)) {
+        fds.clear();
+        fds.push_back({m_WakeFds[0], POLLIN, 0});
+        fds.push_back({m_ListenFd, POLLIN, 0});
+        for (const auto& client : clients) {
+            fds.push_back({client.fd, static_cast<short>(client.out.empty() ? POLLIN : POLLIN | POLLOUT), 0});
+        }
+        if (poll(fds.data(), fds.size(), 100) == -1 && errno != EINTR) {
+            DRIFT_LOG_ERROR("[ProfilerStream] poll falhou: " << std::strerror(errno));
+            break;
+        }
+
+        while (read(m_WakeFds[0], scratch, sizeof(scratch)) > 0) {
+        }
+
+        std::string newDefinitions;
+        std::deque<std::string> frames;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            newDefinitions.swap(m_PendingDefinitions);
+            frames.swap(m_PendingFrames);
+        }
+        definitions += newDefinitions;
+        for (auto& client : clients) {
+            client.out += newDefinitions;
+            for (const auto& frame : frames) {
+                if (client.out.size() > MAX_CLIENT_BACKLOG) {
+                    m_DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                client.out += frame;
+            }
+        }
+
+        // Eventos dos clientes (os índices de fds batem com clients antes dos novos aceitos)
+        for (size_t i = clients.size(); i-- > 0;) {
+            const pollfd& entry = fds[i + 2];
+            Client& client = clients[i];
+            bool alive = (entry.revents & (POLLERR | POLLNVAL)) == 0;
+            if (alive && (entry.revents & (POLLIN | POLLHUP))) {
+                ssize_t received = recv(client.fd, scratch, sizeof(scratch), 0);   // Clientes só leem
+                alive = received > 0 || (received == -1 && (errno == EAGAIN || errno == EWOULDBLOCK));
+            }
+            while (alive && !client.out.empty()) {
+                ssize_t sent = SendNoSignal(client.fd, client.out.data(), client.out.size());
+                if (sent > 0) {
+                    client.out.erase(0, static_cast<size_t>(sent));
+                } else {
+                    alive = sent == -1 && (errno == EAGAIN || errno == EWOULDBLOCK);
+                    break;
+                }
+            }
+            if (!alive) {
+                close(client.fd);
+                clients.erase(clients.begin() + static_cast<std::ptrdiff_t>(i));
+                DRIFT_LOG_INFO("[ProfilerStream] Cliente desconectado");
+            }
+        }
+
+        if (fds[1].revents & POLLIN) {
+            int fd;
+            while ((fd = accept(m_ListenFd, nullptr, nullptr)) != -1) {
+                SetNonBlocking(fd);
+                int noDelay = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));  // Falha em socket Unix, sem efeito
+                clients.push_back({fd, hello + definitions});
+                DRIFT_LOG_INFO("[ProfilerStream] Cliente conectado");
+            }
+        }
+        m_ClientCount.store(static_cast<uint32_t>(clients.size()), std::memory_order_relaxed);
+    }
+
+    for (const auto& client : clients) {
+        close(client.fd);
+    }
+    m_ClientCount.store(0, std::memory_order_relaxed);
+}
+
+#else
+
+bool ProfilerStreamServer::Start(const std::string&) {
+    DRIFT_LOG_WARNING("[ProfilerStream] Streaming só está disponível em sistemas POSIX");
+    return false;
+}
+
+void ProfilerStreamServer::Stop() {
+}
+
+void ProfilerStreamServer::Run() {
+}
+
+#endif
+
+// ============================================================================
+// Cliente
+// ============================================================================
+
+ProfilerStreamClient::~ProfilerStreamClient() {
+    Close();
+}
+
+std::vector<ProfilerStreamFrame> ProfilerStreamClient::TakeFrames() {
+    std::vector<ProfilerStreamFrame> frames;
+    frames.swap(m_Frames);
+    return frames;
+}
+
+bool ProfilerStreamClient::Decode() {
+    const char* cursor = m_Buffer.data();
+    const char* end = cursor + m_Buffer.size();
+    while (static_cast<size_t>(end - cursor) >= MESSAGE_HEADER_SIZE) {
+        const char* header = cursor;
+        uint8_t type = 0;
+        uint32_t size = 0;
+        Get(header, end, type);
+        Get(header, end, size);
+        if (size > MAX_MESSAGE_SIZE) {
+            m_LastError = "mensagem grande demais: stream corrompido";
+            return false;
+        }
+        if (static_cast<size_t>(end - header) < size) {
+            break;      // Mensagem incompleta: espera o resto
+        }
+
+        const char* payload = header;
+        const char* payloadEnd = header + size;
+        bool valid = true;
+        switch (static_cast<ProfilerStreamMessage>(type)) {
+        case ProfilerStreamMessage::Hello: {
+            uint32_t magic = 0;
+            uint16_t version = 0;
+            valid = Get(payload, payloadEnd, magic) && Get(payload, payloadEnd, version);
+            if (valid && (magic != PROFILER_STREAM_MAGIC || version != PROFILER_STREAM_VERSION)) {
+                m_LastError = "servidor incompatível (magic ou versão do protocolo)";
+                return false;
+            }
+            break;
+        }
+        case ProfilerStreamMessage::SectionName: {
+            uint32_t section = 0;
+            std::string name;
+            valid = Get(payload, payloadEnd, section) && GetString(payload, payloadEnd, name);
+            if (valid && section >= MAX_STREAM_ID) {
+                m_LastError = "id de seção inválido: stream corrompido";
+                return false;
+            }
+            if (valid) {
+                if (section >= m_SectionNames.size()) {
+                    m_SectionNames.resize(section + 1);
+                }
+                m_SectionNames[section] = std::move(name);
+            }
+            break;
+        }
+        case ProfilerStreamMessage::CounterName: {
+            uint32_t counter = 0;
+            uint8_t counterType = 0;
+            std::string name;
+            valid = Get(payload, payloadEnd, counter) && Get(payload, payloadEnd, counterType) &&
+                    GetString(payload, payloadEnd, name);
+            if (valid && counter >= MAX_STREAM_ID) {
+                m_LastError = "id de contador inválido: stream corrompido";
+                return false;
+            }
+            if (valid) {
+                if (counter >= m_CounterNames.size()) {
+                    m_CounterNames.resize(counter + 1);
+                    m_CounterTypes.resize(counter + 1);
+                }
+                m_CounterNames[counter] = std::move(name);
+                m_CounterTypes[counter] = counterType;
+            }
+            break;
+        }
+        case ProfilerStreamMessage::Frame: {
+            ProfilerStreamFrame frame;
+            uint32_t sectionCount = 0;
+            uint32_t counterCount = 0;
+            valid = Get(payload, payloadEnd, frame.index) && Get(payload, payloadEnd, frame.startNs) &&
+                    Get(payload, payloadEnd, frame.durationNs) && Get(payload, payloadEnd, sectionCount) &&
+                    Get(payload, payloadEnd, counterCount);
+            for (uint32_t i = 0; valid && i < sectionCount; ++i) {
+                std::pair<uint32_t, uint64_t> section;
+                valid = Get(payload, payloadEnd, section.first) && Get(payload, payloadEnd, section.second);
+                frame.sections.push_back(section);
+            }
+            for (uint32_t i = 0; valid && i < counterCount; ++i) {
+                std::pair<uint32_t, double> counter;
+                valid = Get(payload, payloadEnd, counter.first) && Get(payload, payloadEnd, counter.second);
+                frame.counters.push_back(counter);
+            }
+            if (valid) {
+                m_Frames.push_back(std::move(frame));
+            }
+            break;
+        }
+        default:
+            break;      // Mensagem de uma versão mais nova: ignora
+        }
+        if (!valid) {
+            m_LastError = "mensagem truncada: stream corrompido";
+            return false;
+        }
+        cursor = payloadEnd;
+    }
+    m_Buffer.erase(0, static_cast<size_t>(cursor - m_Buffer.data()));
+    return true;
+}
+
+#if !defined(_WIN32)
+
+bool ProfilerStreamClient::Connect(const std::string& address) {
+    Close();
+
+    sockaddr_storage storage;
+    socklen_t length = 0;
+    std::string unixPath;
+    if (!ParseAddress(address, storage, length, unixPath)) {
+        m_LastError = "endereço inválido (use unix:/caminho ou tcp:porta)";
+        return false;
+    }
+
+    int fd = socket(storage.ss_family, SOCK_STREAM, 0);
+    if (fd == -1 || connect(fd, reinterpret_cast<sockaddr*>(&storage), length) == -1) {
+        m_LastError = std::strerror(errno);
+        if (fd != -1) {
+            close(fd);
+        }
+        return false;
+    }
+
+    m_Fd = fd;
+    m_Buffer.clear();
+    m_SectionNames.clear();
+    m_CounterNames.clear();
+    m_CounterTypes.clear();
+    m_Frames.clear();
+    return true;
+}
+
+void ProfilerStreamClient::Close() {
+    if (m_Fd != -1) {
+        close(m_Fd);
+        m_Fd = -1;
+    }
+}
+
+bool ProfilerStreamClient::Poll(int timeoutMs) {
+    if (m_Fd == -1) {
+        return false;
+    }
+
+    pollfd entry{m_Fd, POLLIN, 0};
+    int ready = poll(&entry, 1, timeoutMs);
+    if (ready == -1 && errno != EINTR) {
+        m_LastError = std::strerror(errno);
+        Close();
+        return false;
+    }
+    if (ready <= 0) {
+        return true;
+    }
+
+    char chunk[65536];
+    ssize_t received = recv(m_Fd, chunk, sizeof(chunk), 0);
+    if (received <= 0) {
+        m_LastError = received == 0 ? "servidor encerrou a conexão" : std::strerror(errno);
+        Close();
+        return false;
+    }
+    m_Buffer.append(chunk, static_cast<size_t>(received));
+    if (!Decode()) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+#else
+
+bool ProfilerStreamClient::Connect(const std::string&) {
+    m_LastError = "streaming só está disponível em sistemas POSIX";
+    return false;
+}
+
+void ProfilerStreamClient::Close() {
+    m_Fd = -1;
+}
+
+bool ProfilerStreamClient::Poll(int) {
+    return false;
+}
+
+#endif
+
+} // namespace Drift::Core
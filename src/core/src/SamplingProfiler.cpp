@@ -0,0 +1,497 @@
+#include "Drift/Core/Profiler.h"
+#include "Drift/Core/Log.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#include <csignal>
+#include <ctime>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+// glibc < 2.35 não expõe o nome POSIX do campo
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+
+namespace Drift::Core {
+
+namespace {
+
+constexpr int MAX_SAMPLE_FRAMES = 64;
+constexpr uintptr_t UNKNOWN_THREAD_FLAG = 1ull << 32;   // Thread sem buffer do profiler: chave = tid
+
+// Uma amostra gravada pelo handler; 'sequence' coordena handler e agregador (fila de Vyukov)
+struct SampleSlot {
+    std::atomic<uint64_t> sequence{0};
+    uintptr_t thread = 0;
+    SectionId section = INVALID_SECTION_ID;
+    int depth = 0;
+    void* frames[MAX_SAMPLE_FRAMES];
+};
+
+struct SampleRing {
+    explicit SampleRing(size_t capacity) : slots(new SampleSlot[capacity]), mask(capacity - 1) {
+        for (size_t i = 0; i < capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<SampleSlot[]> slots;
+    const uint64_t mask;
+    std::atomic<uint64_t> writeIndex{0};
+    uint64_t readIndex = 0;                             // Só o agregador (sob m_Mutex)
+    std::atomic<uint64_t> droppedSamples{0};
+};
+
+// Criado no primeiro Start e mantido até o fim do processo: um handler atrasado pode
+// rodar depois do Stop, então o ring nunca é liberado
+std::atomic<SampleRing*> g_Ring{nullptr};
+std::atomic<bool> g_Active{false};
+bool g_HandlerInstalled = false;                        // Sob SamplingProfiler::m_Mutex
+
+#if defined(__linux__)
+
+// Limites da pilha da thread, gravados no registro (fora do handler); high == 0: desconhecidos
+struct StackBounds {
+    uintptr_t low = 0;
+    uintptr_t high = 0;
+};
+thread_local StackBounds t_StackBounds;
+
+// Timer de amostragem de uma thread registrada, no relógio de CPU dela
+struct SampledThread {
+    pid_t tid = 0;
+    clockid_t clock = 0;
+    timer_t timer{};
+    bool armed = false;
+};
+
+struct ThreadRegistry {
+    std::mutex mutex;
+    std::vector<SampledThread> threads;
+    long intervalNs = 0;                                // 0 = amostragem parada
+};
+
+// Nunca liberado: threads podem se remover durante o encerramento do processo
+ThreadRegistry& Registry() {
+    static ThreadRegistry* registry = new ThreadRegistry();
+    return *registry;
+}
+
+// SIGPROF entregue só à thread dona do relógio: threads ociosas não geram amostras
+bool ArmTimer(SampledThread& thread, long intervalNs) {
+    sigevent event{};
+    event.sigev_notify = SIGEV_THREAD_ID;
+    event.sigev_signo = SIGPROF;
+    event.sigev_notify_thread_id = thread.tid;
+    if (timer_create(thread.clock, &event, &thread.timer) != 0) {
+        return false;
+    }
+
+    itimerspec interval{};
+    interval.it_interval.tv_sec = intervalNs / 1000000000L;
+    interval.it_interval.tv_nsec = intervalNs % 1000000000L;
+    interval.it_value = interval.it_interval;
+    if (timer_settime(thread.timer, 0, &interval, nullptr) != 0) {
+        timer_delete(thread.timer);
+        return false;
+    }
+    thread.armed = true;
+    return true;
+}
+
+void DisarmTimer(SampledThread& thread) {
+    if (thread.armed) {
+        timer_delete(thread.timer);
+        thread.armed = false;
+    }
+}
+
+// Pilha pelos frame pointers a partir do contexto interrompido. Só lê memória dentro da
+// pilha da thread, então é segura em sinal, ao contrário de backtrace() (que pode alocar e
+// tomar o lock do loader). Quadros sem frame pointer encerram ou encurtam a pilha.
+int WalkFramePointers(const ucontext_t* context, void** frames, int maxFrames) {
+#if defined(__x86_64__) || defined(__aarch64__)
+#if defined(__x86_64__)
+    uintptr_t pc = static_cast<uintptr_t>(context->uc_mcontext.gregs[REG_RIP]);
+    uintptr_t fp = static_cast<uintptr_t>(context->uc_mcontext.gregs[REG_RBP]);
+#else
+    uintptr_t pc = static_cast<uintptr_t>(context->uc_mcontext.pc);
+    uintptr_t fp = static_cast<uintptr_t>(context->uc_mcontext.regs[29]);
+#endif
+    const StackBounds bounds = t_StackBounds;
+    int depth = 0;
+    frames[depth++] = reinterpret_cast<void*>(pc);
+    while (depth < maxFrames) {
+        // Registro do frame: [fp do chamador, endereço de retorno], sempre acima do anterior
+        if (fp < bounds.low || fp + 2 * sizeof(uintptr_t) > bounds.high || fp % sizeof(uintptr_t) != 0) {
+            break;
+        }
+        const uintptr_t* record = reinterpret_cast<const uintptr_t*>(fp);
+        uintptr_t next = record[0];
+        uintptr_t ret = record[1];
+        if (ret == 0) {
+            break;
+        }
+        frames[depth++] = reinterpret_cast<void*>(ret);
+        if (next <= fp) {
+            break;
+        }
+        fp = next;
+    }
+    return depth;
+#else
+    (void)context;
+    (void)frames;
+    (void)maxFrames;
+    return 0;
+#endif
+}
+
+// Handler de SIGPROF: só operações seguras em sinal (atômicos, TLS inicial, leituras da pilha)
+void SampleHandler(int, siginfo_t*, void* context) {
+    SampleRing* ring = g_Ring.load(std::memory_order_acquire);
+    if (!g_Active.load(std::memory_order_relaxed) || !ring) {
+        return;
+    }
+    const int savedErrno = errno;
+
+    uint64_t write = ring->writeIndex.load(std::memory_order_relaxed);
+    SampleSlot* slot;
+    for (;;) {
+        slot = &ring->slots[write & ring->mask];
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == write) {
+            if (ring->writeIndex.compare_exchange_weak(write, write + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (sequence < write) {
+            ring->droppedSamples.fetch_add(1, std::memory_order_relaxed); // Cheio: o agregador está atrasado
+            errno = savedErrno;
+            return;
+        } else {
+            write = ring->writeIndex.load(std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t threadIndex = 0;
+    SectionId section = INVALID_SECTION_ID;
+    if (Profiler::GetSamplingContext(threadIndex, section)) {
+        slot->thread = threadIndex;
+    } else {
+        slot->thread = UNKNOWN_THREAD_FLAG | static_cast<uintptr_t>(syscall(SYS_gettid));
+    }
+    slot->section = section;
+    slot->depth = WalkFramePointers(static_cast<const ucontext_t*>(context), slot->frames, MAX_SAMPLE_FRAMES);
+    slot->sequence.store(write + 1, std::memory_order_release);
+
+    errno = savedErrno;
+}
+
+// Nome do quadro: símbolo exportado (demangled) ou módulo+offset para simbolizar offline
+std::string SymbolizeFrame(uintptr_t address) {
+    Dl_info info{};
+    if (dladdr(reinterpret_cast<void*>(address), &info) && info.dli_sname) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        std::string name = status == 0 && demangled ? demangled : info.dli_sname;
+        std::free(demangled);
+        std::replace(name.begin(), name.end(), ';', ':');   // ';' separa quadros no formato folded
+        return name;
+    }
+
+    char buffer[64];
+    if (info.dli_fname && info.dli_fbase) {
+        const char* module = std::strrchr(info.dli_fname, '/');
+        std::snprintf(buffer, sizeof(buffer), "+0x%lx",
+                      static_cast<unsigned long>(address - reinterpret_cast<uintptr_t>(info.dli_fbase)));
+        return std::string(module ? module + 1 : info.dli_fname) + buffer;
+    }
+    std::snprintf(buffer, sizeof(buffer), "0x%lx", static_cast<unsigned long>(address));
+    return buffer;
+}
+
+#endif
+
+} // namespace
+
+SamplingProfiler& SamplingProfiler::GetInstance() {
+    static SamplingProfiler instance;
+    return instance;
+}
+
+size_t SamplingProfiler::StackHash::operator()(const std::vector<uintptr_t>& stack) const {
+    size_t hash = 14695981039346656037ull;
+    for (uintptr_t value : stack) {
+        hash = (hash ^ static_cast<size_t>(value)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+bool SamplingProfiler::Start(uint32_t frequencyHz, size_t bufferSize) {
+#if defined(__linux__)
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Running.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    if (frequencyHz == 0) {
+        DRIFT_LOG_ERROR("[SamplingProfiler] Frequência de amostragem inválida");
+        return false;
+    }
+
+    if (!g_Ring.load(std::memory_order_relaxed)) {
+        size_t capacity = 64;
+        while (capacity < bufferSize) {
+            capacity <<= 1;
+        }
+        g_Ring.store(new SampleRing(capacity), std::memory_order_release);
+    }
+
+    if (!g_HandlerInstalled) {
+        struct sigaction action{};
+        action.sa_sigaction = SampleHandler;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(SIGPROF, &action, nullptr) != 0) {
+            DRIFT_LOG_ERROR("[SamplingProfiler] Falha ao instalar o handler de SIGPROF");
+            return false;
+        }
+        g_HandlerInstalled = true;
+    }
+
+    // Um timer por thread registrada; as que se registrarem depois são armadas no registro
+    g_Active.store(true, std::memory_order_relaxed);
+    const long intervalNs = std::max<long>(1000000000L / static_cast<long>(frequencyHz), 1000);
+    size_t failed = 0;
+    {
+        ThreadRegistry& registry = Registry();
+        std::lock_guard<std::mutex> registryLock(registry.mutex);
+        registry.intervalNs = intervalNs;
+        for (auto& thread : registry.threads) {
+            if (!thread.armed && !ArmTimer(thread, intervalNs)) {
+                failed++;
+            }
+        }
+    }
+    RegisterCurrentThread();
+    if (failed > 0) {
+        DRIFT_LOG_WARNING("[SamplingProfiler] Falha ao criar o timer de amostragem de " << failed << " threads");
+    }
+
+    m_Running.store(true, std::memory_order_relaxed);
+    DRIFT_LOG_INFO("[SamplingProfiler] Amostragem iniciada a " << frequencyHz << " Hz");
+    return true;
+#else
+    (void)frequencyHz;
+    (void)bufferSize;
+    DRIFT_LOG_WARNING("[SamplingProfiler] Amostragem por SIGPROF só está disponível no Linux");
+    return false;
+#endif
+}
+
+void SamplingProfiler::Stop() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Running.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+#if defined(__linux__)
+    // O handler continua instalado mas inativo: um SIGPROF pendente não derruba o processo
+    {
+        ThreadRegistry& registry = Registry();
+        std::lock_guard<std::mutex> registryLock(registry.mutex);
+        registry.intervalNs = 0;
+        for (auto& thread : registry.threads) {
+            DisarmTimer(thread);
+        }
+    }
+#endif
+    g_Active.store(false, std::memory_order_relaxed);
+    m_Running.store(false, std::memory_order_relaxed);
+    CollectLocked();
+    DRIFT_LOG_INFO("[SamplingProfiler] Amostragem parada: " << m_SampleCount << " amostras");
+}
+
+void SamplingProfiler::RegisterCurrentThread() {
+#if defined(__linux__)
+    // Limites gravados antes de o timer existir: o handler nunca os vê pela metade
+    pthread_attr_t attributes;
+    if (pthread_getattr_np(pthread_self(), &attributes) == 0) {
+        void* stackAddress = nullptr;
+        size_t stackSize = 0;
+        if (pthread_attr_getstack(&attributes, &stackAddress, &stackSize) == 0) {
+            t_StackBounds.low = reinterpret_cast<uintptr_t>(stackAddress);
+            t_StackBounds.high = reinterpret_cast<uintptr_t>(stackAddress) + stackSize;
+        }
+        pthread_attr_destroy(&attributes);
+    }
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+
+    SampledThread thread;
+    thread.tid = static_cast<pid_t>(syscall(SYS_gettid));
+    if (pthread_getcpuclockid(pthread_self(), &thread.clock) != 0) {
+        return;
+    }
+
+    ThreadRegistry& registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (registry.intervalNs > 0) {
+        ArmTimer(thread, registry.intervalNs);
+    }
+    // Mesmo tid: a própria thread registrada de novo ou uma que terminou sem se remover
+    for (auto& existing : registry.threads) {
+        if (existing.tid == thread.tid) {
+            DisarmTimer(existing);
+            existing = thread;
+            return;
+        }
+    }
+    registry.threads.push_back(thread);
+#endif
+}
+
+void SamplingProfiler::UnregisterCurrentThread() {
+#if defined(__linux__)
+    const pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+    {
+        ThreadRegistry& registry = Registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto it = registry.threads.begin(); it != registry.threads.end(); ++it) {
+            if (it->tid == tid) {
+                DisarmTimer(*it);
+                registry.threads.erase(it);
+                break;
+            }
+        }
+    }
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    t_StackBounds.high = 0;
+#endif
+}
+
+void SamplingProfiler::Collect() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    CollectLocked();
+}
+
+void SamplingProfiler::CollectLocked() const {
+    SampleRing* ring = g_Ring.load(std::memory_order_acquire);
+    if (!ring) {
+        return;
+    }
+
+    const uint64_t capacity = ring->mask + 1;
+    std::vector<uintptr_t> stack;
+    for (;;) {
+        SampleSlot& slot = ring->slots[ring->readIndex & ring->mask];
+        if (slot.sequence.load(std::memory_order_acquire) != ring->readIndex + 1) {
+            break; // Vazio, ou o handler ainda está gravando este slot
+        }
+
+        // Chave: thread, seção e quadros da raiz para a folha (o PC interrompido)
+        stack.clear();
+        stack.push_back(slot.thread);
+        stack.push_back(slot.section);
+        for (int frame = slot.depth - 1; frame >= 0; --frame) {
+            stack.push_back(reinterpret_cast<uintptr_t>(slot.frames[frame]));
+        }
+        m_Stacks[stack]++;
+        m_SampleCount++;
+
+        slot.sequence.store(ring->readIndex + capacity, std::memory_order_release);
+        ring->readIndex++;
+    }
+}
+
+void SamplingProfiler::Clear() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    CollectLocked();
+    m_Stacks.clear();
+    m_SampleCount = 0;
+}
+
+uint64_t SamplingProfiler::GetSampleCount() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    CollectLocked();
+    return m_SampleCount;
+}
+
+uint64_t SamplingProfiler::GetDroppedSampleCount() const {
+    SampleRing* ring = g_Ring.load(std::memory_order_acquire);
+    return ring ? ring->droppedSamples.load(std::memory_order_relaxed) : 0;
+}
+
+bool SamplingProfiler::ExportFoldedStacks(const std::string& filename) const {
+#if defined(__linux__)
+    // Cópia sob o lock; nomes de threads e seções vêm do Profiler sem segurar m_Mutex
+    std::vector<std::pair<std::vector<uintptr_t>, uint64_t>> stacks;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        CollectLocked();
+        stacks.assign(m_Stacks.begin(), m_Stacks.end());
+    }
+
+    // Endereços diferentes da mesma função viram a mesma linha depois de simbolizados
+    const Profiler& profiler = Profiler::GetInstance();
+    std::unordered_map<uintptr_t, std::string> symbols;
+    std::map<std::string, uint64_t> folded;
+    for (const auto& [stack, count] : stacks) {
+        std::string line;
+        uintptr_t thread = stack[0];
+        if (thread & UNKNOWN_THREAD_FLAG) {
+            line = "Thread-tid" + std::to_string(thread & ~UNKNOWN_THREAD_FLAG);
+        } else {
+            line = profiler.GetThreadNameByIndex(static_cast<uint32_t>(thread));
+        }
+
+        SectionId section = static_cast<SectionId>(stack[1]);
+        if (section != INVALID_SECTION_ID) {
+            line += ";[" + profiler.GetSectionName(section) + "]";
+        }
+
+        for (size_t frame = 2; frame < stack.size(); ++frame) {
+            // Endereços de retorno apontam para depois da chamada; a folha é o PC exato
+            uintptr_t address = frame + 1 < stack.size() ? stack[frame] - 1 : stack[frame];
+            auto it = symbols.find(address);
+            if (it == symbols.end()) {
+                it = symbols.emplace(address, SymbolizeFrame(address)).first;
+            }
+            line += ';';
+            line += it->second;
+        }
+        folded[line] += count;
+    }
+
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        DRIFT_LOG_ERROR("[SamplingProfiler] Não foi possível criar " << filename);
+        return false;
+    }
+    for (const auto& [line, count] : folded) {
+        file << line << ' ' << count << '\n';
+    }
+
+    DRIFT_LOG_INFO("[SamplingProfiler] Pilhas exportadas para " << filename);
+    return true;
+#else
+    (void)filename;
+    DRIFT_LOG_WARNING("[SamplingProfiler] Amostragem por SIGPROF só está disponível no Linux");
+    return false;
+#endif
+}
+
+} // namespace Drift::Core
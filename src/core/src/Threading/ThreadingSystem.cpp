@@ -1,4 +1,5 @@
 #include "Drift/Core/Threading/ThreadingSystem.h"
+#include "Drift/Core/Profiler.h"
 #include <algorithm>
 #include <thread>
 #include <chrono>
@@ -81,12 +82,18 @@ void ThreadingSystem::Start() {
     m_Threads.clear();
     m_Threads.reserve(m_Config.threadCount);
     
+    // Cria todos os ThreadData antes das threads: WorkerThread acessa m_Threads[i] ao iniciar
     for (size_t i = 0; i < m_Config.threadCount; ++i) {
         auto threadData = std::make_unique<ThreadData>();
         threadData->threadId = i;
         threadData->shouldStop = false;
         threadData->lastWorkTime = std::chrono::steady_clock::now();
         threadData->stats.threadName = m_Config.threadNamePrefix + "-" + std::to_string(i);
+        m_Threads.push_back(std::move(threadData));
+    }
+    
+    for (size_t i = 0; i < m_Config.threadCount; ++i) {
+        auto& threadData = m_Threads[i];
         
         // Cria a thread
         threadData->thread = std::thread(&ThreadingSystem::WorkerThread, this, i);
@@ -98,8 +105,6 @@ void ThreadingSystem::Start() {
         
         // Configura nome da thread
         SetThreadName(threadData->thread, threadData->stats.threadName);
-        
-        m_Threads.push_back(std::move(threadData));
     }
     
     DRIFT_LOG_INFO("[ThreadingSystem] Sistema iniciado com ", m_Config.threadCount, " threads");
@@ -116,6 +121,7 @@ void ThreadingSystem::Stop() {
     // Notifica todas as threads
     m_GlobalCondition.notify_all();
     for (auto& threadData : m_Threads) {
+        threadData->shouldStop = true;
         threadData->condition.notify_all();
     }
     
@@ -145,7 +151,7 @@ void ThreadingSystem::Resume() {
 }
 
 size_t ThreadingSystem::GetQueueSize() const {
-    std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(m_GlobalQueueMutex));
+    std::lock_guard<ProfiledMutex> lock(const_cast<ProfiledMutex&>(m_GlobalQueueMutex));
     return m_GlobalQueue.size();
 }
 
@@ -213,12 +219,17 @@ void ThreadingSystem::WaitForAll() {
 }
 
 void ThreadingSystem::CancelAll() {
-    std::lock_guard<std::mutex> lock(m_GlobalQueueMutex);
+    std::lock_guard<ProfiledMutex> lock(m_GlobalQueueMutex);
     while (!m_GlobalQueue.empty()) {
         m_GlobalQueue.pop();
     }
     m_CurrentQueueSize = 0;
     m_Stats.totalTasksCancelled += m_Stats.totalTasksSubmitted - m_Stats.totalTasksCompleted;
+    PublishQueueDepth();
+}
+
+void ThreadingSystem::PublishQueueDepth() {
+    PROFILE_GAUGE("Threading/QueueDepth", m_CurrentQueueSize.load());
 }
 
 void ThreadingSystem::EnableProfiling(bool enable) {
@@ -242,7 +253,7 @@ bool ThreadingSystem::TryStealWork(size_t threadId) {
             
             // Adiciona à fila global
             {
-                std::lock_guard<std::mutex> globalLock(m_GlobalQueueMutex);
+                std::lock_guard<ProfiledMutex> globalLock(m_GlobalQueueMutex);
                 m_GlobalQueue.push(std::move(stolenTask));
             }
             
@@ -259,6 +270,7 @@ void ThreadingSystem::WorkerThread(size_t threadId) {
     auto& threadData = *m_Threads[threadId];
     
     DRIFT_LOG_INFO("[ThreadingSystem] Thread ", threadId, " iniciada");
+    Profiler::GetInstance().SetThreadName("Worker " + std::to_string(threadId));
     
     while (!threadData.shouldStop) {
         Task task;
@@ -271,11 +283,12 @@ void ThreadingSystem::WorkerThread(size_t threadId) {
         
         // Se não conseguiu, tenta da fila global
         if (!gotTask && !m_Paused.load()) {
-            std::unique_lock<std::mutex> lock(m_GlobalQueueMutex);
+            std::unique_lock<ProfiledMutex> lock(m_GlobalQueueMutex);
             if (!m_GlobalQueue.empty()) {
                 task = std::move(m_GlobalQueue.front());
                 m_GlobalQueue.pop();
                 m_CurrentQueueSize--;
+                PublishQueueDepth();
                 gotTask = true;
             }
         }
@@ -285,11 +298,12 @@ void ThreadingSystem::WorkerThread(size_t threadId) {
             gotTask = TryStealWork(threadId);
             if (gotTask) {
                 // Recupera a tarefa roubada da fila global
-                std::unique_lock<std::mutex> lock(m_GlobalQueueMutex);
+                std::unique_lock<ProfiledMutex> lock(m_GlobalQueueMutex);
                 if (!m_GlobalQueue.empty()) {
                     task = std::move(m_GlobalQueue.front());
                     m_GlobalQueue.pop();
                     m_CurrentQueueSize--;
+                    PublishQueueDepth();
                 } else {
                     gotTask = false;
                 }
@@ -312,19 +326,19 @@ void ThreadingSystem::WorkerThread(size_t threadId) {
 }
 
 void ThreadingSystem::ProcessTask(Task& task, ThreadData& threadData) {
-    auto startTime = std::chrono::steady_clock::now();
+    uint64_t startTime = Clock::NowNs();
     
     try {
         // Executa a tarefa
         task.func();
         
         // Atualiza estatísticas
-        auto endTime = std::chrono::steady_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+        uint64_t endTime = Clock::NowNs();
+        auto duration = std::chrono::microseconds((endTime - startTime) / 1000);
         
         threadData.stats.tasksExecuted++;
         threadData.stats.totalWorkTime += duration.count();
-        threadData.lastWorkTime = endTime;
+        threadData.lastWorkTime = Clock::ToTimePoint(endTime);
         
         std::lock_guard<std::mutex> lock(m_StatsMutex);
         m_Stats.totalTasksCompleted++;
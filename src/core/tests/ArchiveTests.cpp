@@ -0,0 +1,187 @@
+#include "TestHarness.h"
+#include "Drift/Core/Hash.h"
+#include "Drift/Core/IO/ArchiveFileSystem.h"
+#include "Drift/Core/IO/ArchiveWriter.h"
+#include "Drift/Core/IO/Compression.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+using namespace Drift::Core;
+using namespace Drift::Core::IO;
+using Drift::Core::Tests::TempDirectory;
+
+namespace {
+
+std::vector<uint8_t> RandomBytes(size_t size, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> bytes(size);
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    return bytes;
+}
+
+std::vector<uint8_t> RepetitiveBytes(size_t size) {
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>("drift engine asset payload "[i % 27]);
+    }
+    return bytes;
+}
+
+bool SameBytes(const FileView& view, const std::vector<uint8_t>& expected) {
+    return view.size == expected.size() && (expected.empty() || std::memcmp(view.data, expected.data(), view.size) == 0);
+}
+
+std::vector<uint8_t> ReadWholeFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void WriteWholeFile(const std::string& path, const std::vector<uint8_t>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+// ---------------------------------------------------------------------------
+// FastCompression
+// ---------------------------------------------------------------------------
+
+void CompressionRoundTrip() {
+    const std::vector<std::vector<uint8_t>> inputs = {
+        {},
+        {42},
+        RandomBytes(13, 1),
+        RandomBytes(64 * 1024, 2),
+        RepetitiveBytes(256 * 1024),
+        std::vector<uint8_t>(100000, 0)
+    };
+
+    for (const auto& input : inputs) {
+        std::vector<uint8_t> compressed = FastCompression::Compress(input.data(), input.size());
+        DRIFT_CHECK(compressed.size() <= FastCompression::GetMaxCompressedSize(input.size()));
+        DRIFT_CHECK(input.size() <= FastCompression::GetMaxDecompressedSize(compressed.size()));
+
+        std::vector<uint8_t> output(input.size());
+        DRIFT_CHECK(FastCompression::Decompress(compressed.data(), compressed.size(), output.data(), output.size()));
+        DRIFT_CHECK(output == input);
+    }
+}
+
+void CompressionRejectsWrongSize() {
+    std::vector<uint8_t> input = RepetitiveBytes(4096);
+    std::vector<uint8_t> compressed = FastCompression::Compress(input.data(), input.size());
+    DRIFT_CHECK(compressed.size() < input.size());
+
+    // Destino menor ou maior que o original: o bloco não fecha exatamente
+    std::vector<uint8_t> smaller(input.size() - 1);
+    DRIFT_CHECK(!FastCompression::Decompress(compressed.data(), compressed.size(), smaller.data(), smaller.size()));
+    std::vector<uint8_t> larger(input.size() + 1);
+    DRIFT_CHECK(!FastCompression::Decompress(compressed.data(), compressed.size(), larger.data(), larger.size()));
+
+    // Bloco truncado
+    std::vector<uint8_t> output(input.size());
+    DRIFT_CHECK(!FastCompression::Decompress(compressed.data(), compressed.size() / 2, output.data(), output.size()));
+}
+
+// ---------------------------------------------------------------------------
+// .dpak
+// ---------------------------------------------------------------------------
+
+void ArchiveRoundTrip() {
+    TempDirectory dir("archive_round_trip");
+    const std::string archivePath = dir.File("assets.dpak");
+
+    const std::vector<uint8_t> random = RandomBytes(10000, 3);
+    const std::vector<uint8_t> repetitive = RepetitiveBytes(300 * 1024);
+    const std::vector<uint8_t> small = {1, 2, 3};
+    const std::vector<uint8_t> loose = RandomBytes(777, 4);
+    WriteWholeFile(dir.File("loose.bin"), loose);
+
+    ArchiveWriterConfig config;
+    config.enableCompression = true;
+    ArchiveWriter writer(config);
+    DRIFT_CHECK(writer.AddData("textures/random.bin", random));
+    DRIFT_CHECK(writer.AddData("./textures\\repetitive.bin", repetitive));
+    DRIFT_CHECK(writer.AddData("empty.txt", {}));
+    DRIFT_CHECK(writer.AddData("small.bin", small));
+    DRIFT_CHECK(writer.AddFile("loose.bin", dir.File("loose.bin")));
+    DRIFT_CHECK(!writer.AddData("small.bin", small));
+    DRIFT_CHECK(writer.Write(archivePath));
+    DRIFT_CHECK(writer.GetStats().entryCount == 5);
+    DRIFT_CHECK(writer.GetStats().compressedEntries >= 1);
+
+    ArchiveOpenOptions options;
+    options.verifyCrcOnRead = true;
+    auto archive = ArchiveFileSystem::Open(archivePath, options);
+    DRIFT_CHECK(archive != nullptr);
+    if (!archive) {
+        return;
+    }
+    DRIFT_CHECK(archive->GetEntryCount() == 5);
+    DRIFT_CHECK(archive->VerifyAll());
+
+    ArchiveEntryInfo info;
+    DRIFT_CHECK(archive->GetEntryInfo("textures/repetitive.bin", info));
+    DRIFT_CHECK(info.compression == CompressionMethod::LZ4Block);
+    DRIFT_CHECK(info.storedSize < info.originalSize);
+    DRIFT_CHECK(archive->GetEntryInfo("textures/random.bin", info));
+    DRIFT_CHECK(info.compression == CompressionMethod::None);
+
+    DRIFT_CHECK(SameBytes(archive->Read("textures/random.bin"), random));
+    DRIFT_CHECK(SameBytes(archive->Read("/textures/repetitive.bin"), repetitive));
+    DRIFT_CHECK(SameBytes(archive->Read("small.bin"), small));
+    DRIFT_CHECK(SameBytes(archive->Read("loose.bin"), loose));
+
+    // Entrada de 0 bytes: payload válido e vazio, não "até o fim do arquivo"
+    FileView empty = archive->Read("empty.txt");
+    DRIFT_CHECK(empty.IsValid());
+    DRIFT_CHECK(empty.size == 0);
+    DRIFT_CHECK(archive->VerifyEntry("empty.txt"));
+
+    FileView missing = archive->Read("missing.bin");
+    DRIFT_CHECK(!missing.IsValid());
+    DRIFT_CHECK(!archive->Exists("missing.bin"));
+}
+
+void ArchiveRejectsOversizedOriginalSize() {
+    TempDirectory dir("archive_original_size");
+    const std::string archivePath = dir.File("bad.dpak");
+
+    ArchiveWriterConfig config;
+    config.enableCompression = true;
+    ArchiveWriter writer(config);
+    DRIFT_CHECK(writer.AddData("repetitive.bin", RepetitiveBytes(64 * 1024)));
+    DRIFT_CHECK(writer.Write(archivePath));
+
+    // Reescreve originalSize com um valor absurdo e recalcula os CRCs do TOC e do cabeçalho,
+    // simulando um arquivo malicioso que passaria pela validação de integridade
+    std::vector<uint8_t> bytes = ReadWholeFile(archivePath);
+    DpakHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    DpakEntry entry;
+    std::memcpy(&entry, bytes.data() + header.tocOffset, sizeof(entry));
+    entry.originalSize = uint64_t(1) << 40;
+    std::memcpy(bytes.data() + header.tocOffset, &entry, sizeof(entry));
+
+    header.tocCrc = Crc32(bytes.data() + header.tocOffset, static_cast<size_t>(header.tocSize));
+    header.tocCrc = Crc32(bytes.data() + header.namesOffset, static_cast<size_t>(header.namesSize), header.tocCrc);
+    header.headerCrc = 0;
+    header.headerCrc = Crc32(&header, sizeof(header));
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    WriteWholeFile(archivePath, bytes);
+
+    DRIFT_CHECK(ArchiveFileSystem::Open(archivePath) == nullptr);
+}
+
+} // namespace
+
+int main() {
+    DRIFT_RUN_TEST(CompressionRoundTrip);
+    DRIFT_RUN_TEST(CompressionRejectsWrongSize);
+    DRIFT_RUN_TEST(ArchiveRoundTrip);
+    DRIFT_RUN_TEST(ArchiveRejectsOversizedOriginalSize);
+    return DRIFT_TEST_RESULT();
+}
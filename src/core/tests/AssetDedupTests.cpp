@@ -0,0 +1,155 @@
+#include "TestHarness.h"
+#include "Drift/Core/Assets/AssetsSystem.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+using namespace Drift::Core::Assets;
+using Drift::Core::Tests::TempDirectory;
+
+namespace {
+
+// Asset zero-copy: retém o FileView recebido, como um loader que interpreta os bytes in-place
+class BlobAsset : public IAsset {
+public:
+    BlobAsset(const std::string& path, const Drift::Core::IO::FileView& data)
+        : m_Path(path), m_Data(data), m_LoadTime(std::chrono::steady_clock::now()) {}
+
+    const std::string& GetPath() const override { return m_Path; }
+    const std::string& GetName() const override { return m_Path; }
+    size_t GetMemoryUsage() const override { return m_Data.size; }
+    AssetStatus GetStatus() const override { return AssetStatus::Loaded; }
+    bool Load() override { return true; }
+    void Unload() override {}
+    bool IsLoaded() const override { return true; }
+    std::chrono::steady_clock::time_point GetLoadTime() const override { return m_LoadTime; }
+    size_t GetAccessCount() const override { return 0; }
+    void UpdateAccess() override {}
+
+    const uint8_t* GetBytes() const { return m_Data.data; }
+
+private:
+    std::string m_Path;
+    Drift::Core::IO::FileView m_Data;
+    std::chrono::steady_clock::time_point m_LoadTime;
+};
+
+class BlobLoader : public IAssetLoader<BlobAsset> {
+public:
+    explicit BlobLoader(std::atomic<size_t>& loads) : m_Loads(loads) {}
+
+    std::shared_ptr<BlobAsset> Load(const std::string& path, const std::any& params) override {
+        (void)params;
+        m_Loads++;
+        return std::make_shared<BlobAsset>(path, Drift::Core::IO::FileView{});
+    }
+
+    std::shared_ptr<BlobAsset> Load(const std::string& path, const Drift::Core::IO::FileView& data,
+                                    const std::any& params) override {
+        (void)params;
+        m_Loads++;
+        return std::make_shared<BlobAsset>(path, data);
+    }
+
+    bool CanLoad(const std::string& path) const override {
+        return path.size() > 5 && path.compare(path.size() - 5, 5, ".blob") == 0;
+    }
+    std::vector<std::string> GetSupportedExtensions() const override { return {".blob"}; }
+    std::string GetLoaderName() const override { return "BlobLoader"; }
+    size_t EstimateMemoryUsage(const std::string& path) const override {
+        (void)path;
+        return 4096;
+    }
+
+private:
+    std::atomic<size_t>& m_Loads;
+};
+
+void WriteText(const std::string& path, const std::string& text) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << text;
+}
+
+AssetsSystem& StartAssets(std::atomic<size_t>& loads) {
+    auto& assets = AssetsSystem::GetInstance();
+    AssetsConfig config;
+    config.enableAsyncIO = false;
+    assets.Initialize(config);
+    assets.RegisterLoader<BlobAsset>(std::make_unique<BlobLoader>(loads));
+    return assets;
+}
+
+// Arquivos de conteúdo idêntico: uma instância compartilhada; com params, o mesmo buffer
+void IdenticalContentIsShared() {
+    TempDirectory dir("asset_dedup");
+    const std::string content(8192, 'x');
+    WriteText(dir.File("a.blob"), content);
+    WriteText(dir.File("b.blob"), content);
+    WriteText(dir.File("c.blob"), content + "y");
+
+    std::atomic<size_t> loads{0};
+    auto& assets = StartAssets(loads);
+
+    auto a = assets.LoadAssetSync<BlobAsset>(dir.File("a.blob"));
+    auto b = assets.LoadAssetSync<BlobAsset>(dir.File("b.blob"));
+    auto c = assets.LoadAssetSync<BlobAsset>(dir.File("c.blob"));
+    DRIFT_CHECK(a && b && c);
+    if (!a || !b || !c) {
+        assets.Shutdown();
+        return;
+    }
+    DRIFT_CHECK(a == b);
+    DRIFT_CHECK(a != c);
+    DRIFT_CHECK(loads.load() == 2);
+    DRIFT_CHECK(assets.GetStats().dedupSharedAssets == 1);
+
+    // params mudam o resultado: nova instância, mas os bytes vêm do buffer já vivo
+    auto withParams = assets.LoadAssetSync<BlobAsset>(dir.File("b.blob"), "params", std::any(1));
+    DRIFT_CHECK(withParams && withParams != a);
+    DRIFT_CHECK(withParams && withParams->GetBytes() == a->GetBytes());
+    DRIFT_CHECK(assets.GetStats().dedupPayloadHits >= 1);
+
+    assets.Shutdown();
+}
+
+// Cargas síncronas concorrentes de cópias do mesmo conteúdo terminam numa única instância
+void ConcurrentSyncLoadsShareOneInstance() {
+    TempDirectory dir("asset_dedup_concurrent");
+    const std::string content(256 * 1024, 'z');
+    constexpr int kThreads = 8;
+    for (int i = 0; i < kThreads; ++i) {
+        WriteText(dir.File("copy" + std::to_string(i) + ".blob"), content);
+    }
+
+    std::atomic<size_t> loads{0};
+    auto& assets = StartAssets(loads);
+
+    std::vector<std::shared_ptr<BlobAsset>> results(kThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&, i] {
+            results[i] = assets.LoadAssetSync<BlobAsset>(dir.File("copy" + std::to_string(i) + ".blob"));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& result : results) {
+        DRIFT_CHECK(result != nullptr);
+        DRIFT_CHECK(result == results[0]);
+    }
+    DRIFT_CHECK(loads.load() == 1);
+    DRIFT_CHECK(assets.GetStats().dedupSharedAssets == kThreads - 1);
+
+    assets.Shutdown();
+}
+
+} // namespace
+
+int main() {
+    DRIFT_RUN_TEST(IdenticalContentIsShared);
+    DRIFT_RUN_TEST(ConcurrentSyncLoadsShareOneInstance);
+    return DRIFT_TEST_RESULT();
+}
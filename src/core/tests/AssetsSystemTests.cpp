@@ -0,0 +1,356 @@
+#include "TestHarness.h"
+#include "Drift/Core/Assets/AssetsSystem.h"
+#include "Drift/Core/Threading/ThreadingSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace Drift::Core::Assets;
+using Drift::Core::Tests::TempDirectory;
+
+namespace {
+
+class TestAsset : public IAsset {
+public:
+    TestAsset(const std::string& path, size_t memoryUsage)
+        : m_Path(path), m_MemoryUsage(memoryUsage), m_LoadTime(std::chrono::steady_clock::now()) {}
+
+    const std::string& GetPath() const override { return m_Path; }
+    const std::string& GetName() const override { return m_Path; }
+    size_t GetMemoryUsage() const override { return m_MemoryUsage; }
+    AssetStatus GetStatus() const override { return AssetStatus::Loaded; }
+    bool Load() override { return true; }
+    void Unload() override {}
+    bool IsLoaded() const override { return true; }
+    std::chrono::steady_clock::time_point GetLoadTime() const override { return m_LoadTime; }
+    size_t GetAccessCount() const override { return 0; }
+    void UpdateAccess() override {}
+
+private:
+    std::string m_Path;
+    size_t m_MemoryUsage;
+    std::chrono::steady_clock::time_point m_LoadTime;
+};
+
+// Loader que registra a ordem dos carregamentos; Hold segura os carregamentos até Resume.
+// Cada asset ocupa 1 KB, ou metade no nível "half" da escada de qualidade
+class TestLoader : public IAssetLoader<TestAsset> {
+public:
+    std::shared_ptr<TestAsset> Load(const std::string& path, const std::any& params) override {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Resumed.wait(lock, [this] { return !m_Held; });
+            m_Order.push_back(path);
+        }
+        const bool half = params.type() == typeid(std::string) && std::any_cast<std::string>(params) == "half";
+        return std::make_shared<TestAsset>(path, half ? 512 : 1024);
+    }
+
+    std::vector<AssetQualityLevel> GetQualityLadder() const override {
+        return {{"", 1.0f, {}}, {"half", 0.5f, std::string("half")}};
+    }
+
+    bool CanLoad(const std::string& path) const override {
+        return path.size() > 5 && path.compare(path.size() - 5, 5, ".test") == 0;
+    }
+    std::vector<std::string> GetSupportedExtensions() const override { return {".test"}; }
+    std::string GetLoaderName() const override { return "TestLoader"; }
+    size_t EstimateMemoryUsage(const std::string& path) const override {
+        (void)path;
+        return 1024;
+    }
+
+    std::vector<std::string> GetOrder() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Order;
+    }
+
+    void Hold() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Held = true;
+    }
+
+    void Resume() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Held = false;
+        }
+        m_Resumed.notify_all();
+    }
+
+private:
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Resumed;
+    bool m_Held = false;
+    std::vector<std::string> m_Order;
+};
+
+void WriteText(const std::string& path, const std::string& text) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << text;
+}
+
+// Os carregamentos da fila rodam no ThreadingSystem
+AssetsSystem& StartAssets(AssetsConfig config, TestLoader*& loader) {
+    Drift::Core::Threading::ThreadingConfig threading;
+    threading.threadCount = 2;
+    threading.enableAffinity = false;
+    Drift::Core::Threading::ThreadingSystem::GetInstance().Initialize(threading);
+
+    auto& assets = AssetsSystem::GetInstance();
+    config.enableAsyncIO = false;
+    assets.Initialize(config);
+    assets.ResetStats();    // O singleton mantém as estatísticas entre testes
+    auto owned = std::make_unique<TestLoader>();
+    loader = owned.get();
+    assets.RegisterLoader<TestAsset>(std::move(owned));
+    return assets;
+}
+
+void StopAssets() {
+    AssetsSystem::GetInstance().Shutdown();
+    Drift::Core::Threading::ThreadingSystem::GetInstance().Shutdown();
+}
+
+size_t IndexOf(const std::vector<std::string>& order, const std::string& path) {
+    return static_cast<size_t>(std::find(order.begin(), order.end(), path) - order.begin());
+}
+
+// O id depende só de caminho + variante; chaves por id e por caminho são a mesma chave
+void AssetIdsHashPathAndVariant() {
+    const AssetId id = AssetId::FromPath("textures/a.png");
+    DRIFT_CHECK(id.IsValid());
+    DRIFT_CHECK(id == AssetId::FromPath(std::string("textures/") + "a.png"));
+    DRIFT_CHECK(id != AssetId::FromPath("textures/b.png"));
+    DRIFT_CHECK(id != AssetId::FromPath("textures/a.png", "half"));
+    DRIFT_CHECK(AssetId::FromPath("textures/a.png", "half") == AssetId::FromPath("textures/a.png", "half"));
+
+    const AssetKey byPath("textures/a.png", typeid(TestAsset));
+    const AssetKey byId(id, typeid(TestAsset));
+    DRIFT_CHECK(byPath == byId);
+    DRIFT_CHECK(AssetKeyHash{}(byPath) == AssetKeyHash{}(byId));
+    DRIFT_CHECK(!(byId == AssetKey(id, typeid(int))));
+
+    TempDirectory dir("assets_ids");
+    const std::string path = dir.File("id.test");
+    WriteText(path, path);
+    TestLoader* loader = nullptr;
+    auto& assets = StartAssets(AssetsConfig{}, loader);
+
+    auto asset = assets.LoadAssetSync<TestAsset>(path);
+    DRIFT_CHECK(asset && assets.GetAsset<TestAsset>(AssetId::FromPath(path)) == asset);
+    DRIFT_CHECK(assets.GetAsset<TestAsset>(AssetId::FromPath(path, "half")) == nullptr);
+    DRIFT_CHECK(assets.IsAssetLoaded(AssetId::FromPath(path), typeid(TestAsset)));
+
+    StopAssets();
+}
+
+// Com um carregamento em execução, a fila sai por prioridade e, dentro dela, por ordem de chegada
+void LoadQueueHonorsPriority() {
+    TempDirectory dir("assets_priority");
+    std::vector<std::string> paths;
+    for (const char* name : {"first", "low", "normal", "high", "raised"}) {
+        paths.push_back(dir.File(std::string(name) + ".test"));
+        WriteText(paths.back(), paths.back());
+    }
+    const std::string& first = paths[0];
+    const std::string& low = paths[1];
+    const std::string& normal = paths[2];
+    const std::string& high = paths[3];
+    const std::string& raised = paths[4];
+
+    AssetsConfig config;
+    config.maxConcurrentLoads = 1;
+    TestLoader* loader = nullptr;
+    auto& assets = StartAssets(config, loader);
+
+    loader->Hold();
+    auto pending = assets.LoadAssetAsync<TestAsset>(first);
+    DRIFT_CHECK(assets.GetLoadingCount() == 1);
+    std::vector<std::future<std::shared_ptr<TestAsset>>> queued;
+    queued.push_back(assets.LoadAssetAsync<TestAsset>(low, "", {}, AssetPriority::Low));
+    queued.push_back(assets.LoadAssetAsync<TestAsset>(raised, "", {}, AssetPriority::Low));
+    queued.push_back(assets.LoadAssetAsync<TestAsset>(normal, "", {}, AssetPriority::Normal));
+    queued.push_back(assets.LoadAssetAsync<TestAsset>(high, "", {}, AssetPriority::High));
+    DRIFT_CHECK(assets.GetQueuedCount() == 4);
+    // Subir a prioridade mantém a ordem de chegada: 'raised' chegou antes de 'high'
+    DRIFT_CHECK(assets.SetLoadPriority(raised, typeid(TestAsset), AssetPriority::High));
+    loader->Resume();
+
+    DRIFT_CHECK(pending.get() != nullptr);
+    for (auto& future : queued) {
+        DRIFT_CHECK(future.get() != nullptr);
+    }
+    DRIFT_CHECK(loader->GetOrder() == std::vector<std::string>({first, raised, high, normal, low}));
+
+    StopAssets();
+}
+
+// O orçamento do tipo despeja o menos usado e nunca um asset fixado
+void BudgetEvictsLeastUsed() {
+    TempDirectory dir("assets_budget");
+    std::vector<std::string> paths;
+    for (const char* name : {"a", "b", "c", "d", "e"}) {
+        paths.push_back(dir.File(std::string(name) + ".test"));
+        WriteText(paths.back(), paths.back());
+    }
+
+    TestLoader* loader = nullptr;
+    auto& assets = StartAssets(AssetsConfig{}, loader);
+    const std::type_index type(typeid(TestAsset));
+    assets.SetMemoryBudget(type, AssetMemoryBudget{3 * 1024, 0});
+
+    for (size_t i = 0; i < 3; ++i) {
+        assets.LoadAssetSync<TestAsset>(paths[i]);
+    }
+    for (int access = 0; access < 5; ++access) {
+        assets.GetAsset<TestAsset>(paths[0]);
+        assets.GetAsset<TestAsset>(paths[2]);
+    }
+
+    const size_t evictionsBefore = assets.GetStats().evictionCount;
+    DRIFT_CHECK(assets.LoadAssetSync<TestAsset>(paths[3]) != nullptr);
+    DRIFT_CHECK(!assets.IsAssetLoaded(paths[1], type));
+    DRIFT_CHECK(assets.IsAssetLoaded(paths[0], type) && assets.IsAssetLoaded(paths[2], type));
+    DRIFT_CHECK(assets.GetMemoryUsage(type) <= 3 * 1024);
+    DRIFT_CHECK(assets.GetStats().evictionCount == evictionsBefore + 1);
+
+    // 'd' é o menos usado, mas está fixado: sai um dos outros
+    AssetPin<TestAsset> pin = assets.GetHandle<TestAsset>(paths[3]).Pin();
+    DRIFT_CHECK(pin);
+    DRIFT_CHECK(assets.LoadAssetSync<TestAsset>(paths[4]) != nullptr);
+    DRIFT_CHECK(assets.IsAssetLoaded(paths[3], type));
+    DRIFT_CHECK(assets.GetMemoryUsage(type) <= 3 * 1024);
+    pin.Release();
+
+    StopAssets();
+}
+
+// Sob pressão, os menos usados descem um nível da escada antes de qualquer despejo
+void QualityLadderDowngradesBeforeEvicting() {
+    TempDirectory dir("assets_quality");
+    std::vector<std::string> paths;
+    for (const char* name : {"a", "b", "c", "d"}) {
+        paths.push_back(dir.File(std::string(name) + ".test"));
+        WriteText(paths.back(), paths.back());
+    }
+
+    AssetsConfig config;
+    config.enableQualityDowngrade = true;
+    TestLoader* loader = nullptr;
+    auto& assets = StartAssets(config, loader);
+    const std::type_index type(typeid(TestAsset));
+    assets.SetMemoryBudget(type, AssetMemoryBudget{3 * 1024, 0});
+
+    for (size_t i = 0; i < 3; ++i) {
+        assets.LoadAssetSync<TestAsset>(paths[i]);
+    }
+    for (int access = 0; access < 5; ++access) {
+        assets.GetAsset<TestAsset>(paths[2]);
+    }
+
+    // 1 KB a mais: duas reduções de 512 bytes cobrem a diferença, sem despejo
+    DRIFT_CHECK(assets.LoadAssetSync<TestAsset>(paths[3]) != nullptr);
+    assets.WaitForAllLoads();
+
+    const auto stats = assets.GetStats();
+    DRIFT_CHECK(stats.downgradeCount == 2);
+    DRIFT_CHECK(stats.evictionCount == 0);
+    DRIFT_CHECK(stats.pendingDowngrades == 0);
+    for (const auto& path : paths) {
+        DRIFT_CHECK(assets.IsAssetLoaded(path, type));
+    }
+    DRIFT_CHECK(assets.GetQualityLevel(AssetId::FromPath(paths[0]), type) == 1);
+    DRIFT_CHECK(assets.GetQualityLevel(AssetId::FromPath(paths[1]), type) == 1);
+    DRIFT_CHECK(assets.GetQualityLevel(AssetId::FromPath(paths[2]), type) == 0);
+    DRIFT_CHECK(assets.GetAsset<TestAsset>(paths[0])->GetMemoryUsage() == 512);
+    DRIFT_CHECK(assets.GetMemoryUsage(type) == 3 * 1024);
+
+    StopAssets();
+}
+
+// Um ciclo perde só a aresta que o fecha: quem depende do ciclo ainda espera por ele
+void PreloadBreaksOnlyCycleEdges() {
+    TempDirectory dir("assets_preload_cycle");
+    const std::string a = dir.File("a.test");
+    const std::string b = dir.File("b.test");
+    const std::string c = dir.File("c.test");
+    const std::string d = dir.File("d.test");
+    for (const auto& path : {a, b, c, d}) {
+        WriteText(path, path);
+    }
+
+    AssetsConfig config;
+    config.maxConcurrentLoads = 1;
+    TestLoader* loader = nullptr;
+    auto& assets = StartAssets(config, loader);
+
+    assets.AddDependency(a, b);
+    assets.AddDependency(b, a);
+    assets.AddDependency(c, a);
+    assets.AddDependency(c, b);
+    assets.AddDependency(d, c);
+    assets.PreloadAssets({d});
+    assets.WaitForAllLoads();
+
+    const auto order = loader->GetOrder();
+    DRIFT_CHECK(order.size() == 4);
+    DRIFT_CHECK(IndexOf(order, a) < IndexOf(order, c));
+    DRIFT_CHECK(IndexOf(order, b) < IndexOf(order, c));
+    DRIFT_CHECK(IndexOf(order, c) < IndexOf(order, d));
+
+    StopAssets();
+}
+
+// Handles de slot liberado são rejeitados; entradas fixadas sobrevivem a UnloadAsset e ClearCache
+void HandlesRejectReleasedSlots() {
+    TempDirectory dir("assets_handles");
+    const std::string path = dir.File("h.test");
+    WriteText(path, path);
+
+    TestLoader* loader = nullptr;
+    auto& assets = StartAssets(AssetsConfig{}, loader);
+
+    auto asset = assets.LoadAssetSync<TestAsset>(path);
+    auto handle = assets.GetHandle<TestAsset>(path);
+    DRIFT_CHECK(asset && handle.IsValid() && handle.IsAlive());
+
+    {
+        AssetPin<TestAsset> pin = handle.Pin();
+        DRIFT_CHECK(pin.Get() == asset.get());
+        assets.UnloadAsset(path, typeid(TestAsset));
+        assets.ClearCache();
+        DRIFT_CHECK(handle.IsAlive());
+        DRIFT_CHECK(assets.IsAssetLoaded(path, typeid(TestAsset)));
+        DRIFT_CHECK(pin->GetPath() == path);
+    }
+
+    assets.UnloadAsset(path, typeid(TestAsset));
+    DRIFT_CHECK(!handle.IsAlive());
+    DRIFT_CHECK(!handle.Pin());
+
+    // A recarga reaproveita o slot com outra geração: o handle antigo continua rejeitado
+    assets.LoadAssetSync<TestAsset>(path);
+    auto reloaded = assets.GetHandle<TestAsset>(path);
+    DRIFT_CHECK(reloaded.IsAlive() && reloaded.GetIndex() == handle.GetIndex());
+    DRIFT_CHECK(reloaded.GetGeneration() != handle.GetGeneration());
+    DRIFT_CHECK(!handle.IsAlive() && !handle.Pin());
+
+    StopAssets();
+}
+
+} // namespace
+
+int main() {
+    DRIFT_RUN_TEST(AssetIdsHashPathAndVariant);
+    DRIFT_RUN_TEST(LoadQueueHonorsPriority);
+    DRIFT_RUN_TEST(BudgetEvictsLeastUsed);
+    DRIFT_RUN_TEST(QualityLadderDowngradesBeforeEvicting);
+    DRIFT_RUN_TEST(PreloadBreaksOnlyCycleEdges);
+    DRIFT_RUN_TEST(HandlesRejectReleasedSlots);
+    return DRIFT_TEST_RESULT();
+}
@@ -0,0 +1,171 @@
+#include "TestHarness.h"
+#include "Drift/Core/IO/AsyncIO.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+using namespace Drift::Core::IO;
+using Drift::Core::Tests::TempDirectory;
+
+namespace {
+
+std::vector<uint8_t> MakePattern(size_t size) {
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    return bytes;
+}
+
+void WriteWholeFile(const std::string& path, const std::vector<uint8_t>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+bool WaitForIdle(AsyncIO& io) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (io.GetPendingCount() > 0) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void SubmitAndComplete(AsyncIOBackend backend) {
+    TempDirectory dir("async_io_submit");
+    const std::vector<uint8_t> content = MakePattern(200 * 1024);
+    WriteWholeFile(dir.File("data.bin"), content);
+
+    auto& io = AsyncIO::GetInstance();
+    AsyncIOConfig config;
+    config.backend = backend;
+    config.queueDepth = 8;      // Menor que o número de pedidos: força vários lotes
+    DRIFT_CHECK(io.Initialize(config));
+
+    struct Expected {
+        uint64_t offset;
+        uint64_t size;
+        size_t resultSize;
+        bool succeeds;
+    };
+    const std::vector<Expected> cases = {
+        {0, 0, content.size(), true},                   // Arquivo inteiro
+        {1000, 4096, 4096, true},
+        {content.size() - 10, 4096, 10, true},          // Limitado ao fim do arquivo
+        {content.size() + 10, 16, 0, true},             // Além do fim: sucesso vazio
+    };
+
+    std::mutex resultsMutex;
+    std::vector<AsyncReadResult> results;
+    std::vector<AsyncReadRequest> requests;
+    for (int repeat = 0; repeat < 8; ++repeat) {
+        for (const auto& expected : cases) {
+            AsyncReadRequest request;
+            request.path = dir.File("data.bin");
+            request.offset = expected.offset;
+            request.size = expected.size;
+            request.callback = [&](AsyncReadResult&& result) {
+                std::lock_guard<std::mutex> lock(resultsMutex);
+                results.push_back(std::move(result));
+            };
+            requests.push_back(std::move(request));
+        }
+    }
+    AsyncReadRequest missing;
+    missing.path = dir.File("missing.bin");
+    missing.callback = [&](AsyncReadResult&& result) {
+        std::lock_guard<std::mutex> lock(resultsMutex);
+        results.push_back(std::move(result));
+    };
+    requests.push_back(std::move(missing));
+
+    const size_t requestCount = requests.size();
+    DRIFT_CHECK(io.SubmitReads(std::move(requests)));
+    DRIFT_CHECK(WaitForIdle(io));
+
+    std::lock_guard<std::mutex> lock(resultsMutex);
+    DRIFT_CHECK(results.size() == requestCount);
+    for (const auto& result : results) {
+        if (result.path == dir.File("missing.bin")) {
+            DRIFT_CHECK(!result.Succeeded());
+            continue;
+        }
+        DRIFT_CHECK(result.Succeeded());
+        for (const auto& expected : cases) {
+            if (expected.offset == result.offset) {
+                DRIFT_CHECK(result.data.size == expected.resultSize);
+                DRIFT_CHECK(result.data.size == 0 ||
+                            std::memcmp(result.data.data, content.data() + result.offset, result.data.size) == 0);
+            }
+        }
+    }
+
+    io.Shutdown();
+    DRIFT_CHECK(!io.IsInitialized());
+
+    AsyncReadRequest late;
+    late.path = dir.File("data.bin");
+    DRIFT_CHECK(!io.SubmitRead(std::move(late)));
+}
+
+void SubmitAndCompleteThreadPool() {
+    SubmitAndComplete(AsyncIOBackend::ThreadPool);
+}
+
+void SubmitAndCompleteAuto() {
+    SubmitAndComplete(AsyncIOBackend::Auto);    // io_uring quando o kernel permitir
+}
+
+// Submissões concorrentes com Shutdown: todo pedido aceito recebe exatamente um callback
+void ShutdownWhileSubmitting() {
+    TempDirectory dir("async_io_shutdown");
+    WriteWholeFile(dir.File("data.bin"), MakePattern(4096));
+
+    for (int round = 0; round < 20; ++round) {
+        auto& io = AsyncIO::GetInstance();
+        AsyncIOConfig config;
+        config.backend = round % 2 == 0 ? AsyncIOBackend::ThreadPool : AsyncIOBackend::Auto;
+        DRIFT_CHECK(io.Initialize(config));
+
+        std::atomic<size_t> accepted{0};
+        std::atomic<size_t> completed{0};
+        std::atomic<bool> stop{false};
+        std::vector<std::thread> submitters;
+        for (int t = 0; t < 4; ++t) {
+            submitters.emplace_back([&] {
+                while (!stop.load()) {
+                    AsyncReadRequest request;
+                    request.path = dir.File("data.bin");
+                    request.callback = [&](AsyncReadResult&&) { completed++; };
+                    if (io.SubmitRead(std::move(request))) {
+                        accepted++;
+                    }
+                }
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        io.Shutdown();
+        stop = true;
+        for (auto& thread : submitters) {
+            thread.join();
+        }
+
+        DRIFT_CHECK(completed.load() == accepted.load());
+        DRIFT_CHECK(io.GetPendingCount() == 0);
+    }
+}
+
+} // namespace
+
+int main() {
+    DRIFT_RUN_TEST(SubmitAndCompleteThreadPool);
+    DRIFT_RUN_TEST(SubmitAndCompleteAuto);
+    DRIFT_RUN_TEST(ShutdownWhileSubmitting);
+    return DRIFT_TEST_RESULT();
+}
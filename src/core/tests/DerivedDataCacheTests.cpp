@@ -0,0 +1,62 @@
+#include "TestHarness.h"
+#include "Drift/Core/Assets/DerivedDataCache.h"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Drift::Core::Assets;
+using Drift::Core::Tests::TempDirectory;
+
+namespace {
+
+bool Equals(const Drift::Core::IO::FileView& view, const std::string& expected) {
+    return view.size == expected.size() && std::memcmp(view.data, expected.data(), view.size) == 0;
+}
+
+// Ausência constrói e grava uma vez; depois a mesma chave é hit, inclusive após reiniciar
+void GetOrBuildHitsAndMisses() {
+    TempDirectory dir("derived_data_cache");
+    DerivedDataCacheConfig config;
+    config.directory = dir.File("ddc");
+    auto& cache = DerivedDataCache::GetInstance();
+    DRIFT_CHECK(cache.Initialize(config));
+
+    const std::string source = "bytes de origem";
+    const std::string derived = "resultado processado";
+    const auto key = DerivedDataKey::Make("TestLoader", 1, source.data(), source.size(), "mips=4");
+    int builds = 0;
+    auto build = [&](std::vector<uint8_t>& output) {
+        builds++;
+        output.assign(derived.begin(), derived.end());
+        return true;
+    };
+
+    const auto before = cache.GetStats();
+    DRIFT_CHECK(cache.Get(key).Empty());
+    DRIFT_CHECK(Equals(cache.GetOrBuild(key, build), derived));
+    DRIFT_CHECK(Equals(cache.GetOrBuild(key, build), derived));
+    DRIFT_CHECK(builds == 1);
+    const auto after = cache.GetStats();
+    DRIFT_CHECK(after.misses - before.misses == 2);
+    DRIFT_CHECK(after.hits - before.hits == 1);
+    DRIFT_CHECK(after.writes - before.writes == 1);
+
+    // Outra versão do loader, outros parâmetros ou outro conteúdo: chaves diferentes
+    DRIFT_CHECK(!cache.Contains(DerivedDataKey::Make("TestLoader", 2, source.data(), source.size(), "mips=4")));
+    DRIFT_CHECK(!cache.Contains(DerivedDataKey::Make("TestLoader", 1, source.data(), source.size(), "mips=2")));
+    DRIFT_CHECK(!cache.Contains(DerivedDataKey::Make("TestLoader", 1, derived.data(), derived.size(), "mips=4")));
+
+    cache.Shutdown();
+    DRIFT_CHECK(cache.Initialize(config));
+    DRIFT_CHECK(Equals(cache.Get(key), derived));
+    DRIFT_CHECK(cache.Remove(key));
+    DRIFT_CHECK(!cache.Contains(key));
+    cache.Shutdown();
+}
+
+} // namespace
+
+int main() {
+    DRIFT_RUN_TEST(GetOrBuildHitsAndMisses);
+    return DRIFT_TEST_RESULT();
+}
@@ -0,0 +1,177 @@
+#include "TestHarness.h"
+#include "Drift/Core/ProfilerStream.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace Drift::Core;
+using Drift::Core::Tests::TempDirectory;
+
+namespace {
+
+#if !defined(_WIN32)
+
+template<typename T>
+void Put(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+std::string EncodeHello() {
+    std::string out;
+    Put(out, static_cast<uint8_t>(ProfilerStreamMessage::Hello));
+    Put(out, static_cast<uint32_t>(sizeof(uint32_t) + sizeof(uint16_t)));
+    Put(out, PROFILER_STREAM_MAGIC);
+    Put(out, PROFILER_STREAM_VERSION);
+    return out;
+}
+
+// Servidor falso: aceita um cliente e envia 'bytes' como se fosse o jogo
+class FakeServer {
+public:
+    explicit FakeServer(const std::string& path) : m_Path(path) {
+        m_Listen = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+        unlink(path.c_str());
+        if (bind(m_Listen, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(m_Listen, 1) != 0) {
+            close(m_Listen);
+            m_Listen = -1;
+        }
+    }
+
+    ~FakeServer() {
+        if (m_Client != -1) {
+            close(m_Client);
+        }
+        if (m_Listen != -1) {
+            close(m_Listen);
+        }
+        unlink(m_Path.c_str());
+    }
+
+    bool IsListening() const { return m_Listen != -1; }
+
+    bool AcceptAndSend(const std::string& bytes) {
+        m_Client = accept(m_Listen, nullptr, nullptr);
+        return m_Client != -1 && send(m_Client, bytes.data(), bytes.size(), 0) == static_cast<ssize_t>(bytes.size());
+    }
+
+private:
+    std::string m_Path;
+    int m_Listen = -1;
+    int m_Client = -1;
+};
+
+// Polls até o cliente desistir (erro) ou o limite de tentativas
+bool PollUntilError(ProfilerStreamClient& client) {
+    for (int attempt = 0; attempt < 50; ++attempt) {
+        if (!client.Poll(20)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void DecodesNamesAndFrames() {
+    TempDirectory dir("profiler_stream_decode");
+    FakeServer server(dir.File("stream.sock"));
+    DRIFT_CHECK(server.IsListening());
+
+    ProfilerStreamClient client;
+    DRIFT_CHECK(client.Connect("unix:" + dir.File("stream.sock")));
+
+    std::string bytes = EncodeHello();
+    AppendStreamSectionName(bytes, 2, "Update");
+    AppendStreamCounterName(bytes, 1, 0, "DrawCalls");
+    ProfilerStreamFrame frame;
+    frame.index = 7;
+    frame.durationNs = 16000000;
+    frame.sections = {{2, 5000000}};
+    frame.counters = {{1, 42.0}};
+    AppendStreamFrame(bytes, frame);
+    DRIFT_CHECK(server.AcceptAndSend(bytes));
+
+    std::vector<ProfilerStreamFrame> frames;
+    for (int attempt = 0; attempt < 50 && frames.empty(); ++attempt) {
+        DRIFT_CHECK(client.Poll(20));
+        frames = client.TakeFrames();
+    }
+    DRIFT_CHECK(client.GetSectionNames().size() == 3 && client.GetSectionNames()[2] == "Update");
+    DRIFT_CHECK(client.GetCounterNames().size() == 2 && client.GetCounterNames()[1] == "DrawCalls");
+    DRIFT_CHECK(frames.size() == 1);
+    DRIFT_CHECK(!frames.empty() && frames[0].index == 7 && frames[0].sections == frame.sections);
+}
+
+// Ids vindos do socket não podem dimensionar os vetores do cliente
+void RejectsOutOfRangeIds() {
+    const std::pair<uint32_t, bool> cases[] = {
+        {0xFFFFFFF0u, true},        // Seção
+        {1u << 20, false},          // Contador
+    };
+    for (const auto& [id, isSection] : cases) {
+        TempDirectory dir("profiler_stream_ids");
+        FakeServer server(dir.File("stream.sock"));
+        ProfilerStreamClient client;
+        DRIFT_CHECK(client.Connect("unix:" + dir.File("stream.sock")));
+
+        std::string bytes = EncodeHello();
+        if (isSection) {
+            AppendStreamSectionName(bytes, id, "x");
+        } else {
+            AppendStreamCounterName(bytes, id, 0, "x");
+        }
+        DRIFT_CHECK(server.AcceptAndSend(bytes));
+
+        DRIFT_CHECK(PollUntilError(client));
+        DRIFT_CHECK(client.GetLastError().find("inválido") != std::string::npos);
+        DRIFT_CHECK(client.GetSectionNames().empty());
+        DRIFT_CHECK(client.GetCounterNames().empty());
+    }
+}
+
+// O servidor só remove um socket antigo no caminho; outros arquivos ficam intactos
+void StartKeepsNonSocketFiles() {
+    TempDirectory dir("profiler_stream_unlink");
+    const std::string path = dir.File("stream.sock");
+    {
+        std::ofstream out(path);
+        out << "dados";
+    }
+
+    auto& server = ProfilerStreamServer::GetInstance();
+    DRIFT_CHECK(!server.Start("unix:" + path));
+    std::ifstream in(path);
+    std::string content;
+    in >> content;
+    DRIFT_CHECK(content == "dados");
+
+    // Socket deixado por uma execução anterior é substituído
+    std::remove(path.c_str());
+    {
+        FakeServer stale(path);
+        DRIFT_CHECK(stale.IsListening());
+        DRIFT_CHECK(server.Start("unix:" + path));
+        server.Stop();
+    }
+}
+
+#endif
+
+} // namespace
+
+int main() {
+#if !defined(_WIN32)
+    DRIFT_RUN_TEST(DecodesNamesAndFrames);
+    DRIFT_RUN_TEST(RejectsOutOfRangeIds);
+    DRIFT_RUN_TEST(StartKeepsNonSocketFiles);
+#endif
+    return DRIFT_TEST_RESULT();
+}
@@ -0,0 +1,163 @@
+#include "TestHarness.h"
+#include "Drift/Core/ProfiledMutex.h"
+#include "Drift/Core/Profiler.h"
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Drift::Core;
+using Drift::Core::Tests::TempDirectory;
+
+namespace {
+
+// Espera ativa: sleep pode passar bem do tempo pedido
+void Spin(std::chrono::microseconds duration) {
+    const auto until = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < until) {
+    }
+}
+
+Profiler& StartProfiler(ProfilerConfig config) {
+    auto& profiler = Profiler::GetInstance();
+    profiler.Configure(config);
+    profiler.Reset();
+    return profiler;
+}
+
+// Percentis por nearest-rank na janela; cada frame acima do limite grava um arquivo de pico
+void FramePercentilesAndSpikes() {
+    TempDirectory dir("profiler_frames");
+    ProfilerConfig config;
+    config.frameHistorySize = 50;
+    config.spikeThresholdMs = 20.0;
+    config.spikeDirectory = dir.File("spikes");
+    auto& profiler = StartProfiler(config);
+
+    for (int frame = 0; frame < 50; ++frame) {
+        profiler.BeginFrame();
+        if (frame % 2 == 0) {
+            profiler.BeginSection("Tests/FramePar");
+            Spin(std::chrono::microseconds(500));
+            profiler.EndSection("Tests/FramePar");
+        }
+        Spin(frame == 10 || frame == 30 ? std::chrono::milliseconds(30) : std::chrono::milliseconds(1));
+        profiler.EndFrame();
+    }
+
+    // 2 picos em 50 frames: o p95 (48º menor) ainda é um frame normal, o p99 já é pico
+    const FramePercentiles frames = profiler.GetFramePercentiles();
+    DRIFT_CHECK(frames.sampleCount == 50);
+    DRIFT_CHECK(frames.GetP50Ms() >= 1.0 && frames.GetP50Ms() < 20.0);
+    DRIFT_CHECK(frames.GetP95Ms() < 20.0);
+    DRIFT_CHECK(frames.GetP99Ms() >= 30.0);
+    DRIFT_CHECK(frames.GetMaxMs() >= 30.0);
+
+    const FramePercentiles section = profiler.GetSectionPercentiles("Tests/FramePar");
+    DRIFT_CHECK(section.sampleCount == 25);
+    DRIFT_CHECK(section.GetP50Ms() >= 0.5);
+
+    size_t spikeFiles = 0;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(config.spikeDirectory, ec)) {
+        spikeFiles += entry.path().extension() == ".json" ? 1 : 0;
+    }
+    DRIFT_CHECK(spikeFiles == 2);
+
+    profiler.Configure(ProfilerConfig{});
+    profiler.Reset();
+}
+
+// Contadores somam no frame e zeram; gauges mantêm o último valor; a série guarda a janela
+void CountersAndGaugesPerFrame() {
+    ProfilerConfig config;
+    config.frameHistorySize = 3;
+    auto& profiler = StartProfiler(config);
+
+    const CounterId draws = profiler.RegisterCounter("Tests/DrawCalls", CounterType::Counter);
+    const CounterId queue = profiler.RegisterCounter("Tests/Queue", CounterType::Gauge);
+    DRIFT_CHECK(profiler.RegisterCounter("Tests/DrawCalls", CounterType::Counter) == draws);
+    DRIFT_CHECK(draws != queue);
+
+    // Frame 1: somas de várias threads
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            for (int add = 0; add < 1000; ++add) {
+                profiler.AddCounter(draws, 1.0);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    profiler.SetGauge(queue, 7.0);
+    profiler.EndFrame();
+    DRIFT_CHECK(profiler.GetCounterHistory("Tests/DrawCalls") == std::vector<double>({4000.0}));
+
+    // Frame 2: nada informado
+    profiler.EndFrame();
+
+    // Frames 3 e 4: o primeiro sai da janela de 3
+    profiler.AddCounter(draws, 2.0);
+    profiler.SetGauge(queue, 3.0);
+    profiler.SetGauge(queue, 5.0);
+    profiler.EndFrame();
+    profiler.AddCounter(draws, 4.0);
+    profiler.EndFrame();
+
+    DRIFT_CHECK(profiler.GetCounterHistory("Tests/DrawCalls") == std::vector<double>({0.0, 2.0, 4.0}));
+    DRIFT_CHECK(profiler.GetCounterHistory("Tests/Queue") == std::vector<double>({7.0, 5.0, 5.0}));
+    DRIFT_CHECK(profiler.GetCounterHistory("Tests/Desconhecido").empty());
+
+    profiler.Configure(ProfilerConfig{});
+    profiler.Reset();
+}
+
+// Só quem espera conta como disputa; locks com o mesmo nome somam no mesmo registro
+void ProfiledMutexCountsContention() {
+    ProfiledMutex first("Tests/Contended");
+    ProfiledMutex second("Tests/Contended");
+    first.ResetStats();
+
+    {
+        std::lock_guard<ProfiledMutex> lock(second);
+    }
+    DRIFT_CHECK(first.GetStats().acquisitions.load() == 1);
+    DRIFT_CHECK(first.GetStats().contentions.load() == 0);
+
+    first.lock();
+    DRIFT_CHECK(!first.try_lock());
+    std::thread waiter([&] {
+        std::lock_guard<ProfiledMutex> lock(first);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    first.unlock();
+    waiter.join();
+
+    const LockStats& stats = first.GetStats();
+    DRIFT_CHECK(stats.acquisitions.load() == 3);
+    DRIFT_CHECK(stats.contentions.load() == 1);
+    DRIFT_CHECK(stats.waitNs.load() >= 10000000 && stats.maxWaitNs.load() == stats.waitNs.load());
+    DRIFT_CHECK(stats.maxHoldNs.load() >= 20000000);
+
+    bool reported = false;
+    for (const auto& snapshot : ProfiledMutex::GetAllStats()) {
+        if (snapshot.name == "Tests/Contended") {
+            reported = snapshot.contentions == 1 && snapshot.GetContentionPercent() > 33.0 &&
+                       snapshot.GetContentionPercent() < 34.0;
+        }
+    }
+    DRIFT_CHECK(reported);
+}
+
+} // namespace
+
+int main() {
+    DRIFT_RUN_TEST(FramePercentilesAndSpikes);
+    DRIFT_RUN_TEST(CountersAndGaugesPerFrame);
+    DRIFT_RUN_TEST(ProfiledMutexCountsContention);
+    return DRIFT_TEST_RESULT();
+}
@@ -0,0 +1,79 @@
+#include "TestHarness.h"
+#include "Drift/Core/Profiler.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using namespace Drift::Core;
+using Drift::Core::Tests::TempDirectory;
+
+// Fora do namespace anônimo e com ENABLE_EXPORTS: dladdr resolve os nomes na exportação.
+// noinline: cada nível precisa do próprio frame para aparecer na pilha amostrada. O laço
+// quente não fica numa função folha: o GCC não grava frame pointer em folhas.
+__attribute__((noinline)) uint64_t SpinInner(std::chrono::steady_clock::time_point until) {
+    uint64_t value = 1;
+    while (std::chrono::steady_clock::now() < until) {
+        for (int i = 0; i < 1000; ++i) {
+            value = value * 6364136223846793005ull + 1442695040888963407ull;
+        }
+    }
+    return value;
+}
+
+__attribute__((noinline)) uint64_t SpinOuter(std::chrono::milliseconds duration) {
+    return SpinInner(std::chrono::steady_clock::now() + duration) + 1;
+}
+
+namespace {
+
+std::atomic<uint64_t> g_Sink{0};
+
+// Só threads registradas são amostradas, e com pilhas de mais de um quadro
+void SamplesRegisteredThreads() {
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+    TempDirectory dir("sampling_profiler");
+    auto& sampler = SamplingProfiler::GetInstance();
+    sampler.Clear();
+    DRIFT_CHECK(sampler.Start(1000));
+
+    std::thread registered([] {
+        SamplingProfiler::RegisterCurrentThread();
+        g_Sink += SpinOuter(std::chrono::milliseconds(300));
+        SamplingProfiler::UnregisterCurrentThread();
+    });
+    registered.join();
+
+    // Thread nunca registrada: sem timer, não gera amostras
+    sampler.Collect();
+    const uint64_t beforeUnregistered = sampler.GetSampleCount();
+    std::thread unregistered([] {
+        g_Sink += SpinOuter(std::chrono::milliseconds(100));
+    });
+    unregistered.join();
+
+    sampler.Stop();
+    DRIFT_CHECK(beforeUnregistered > 20);
+    DRIFT_CHECK(sampler.GetSampleCount() == beforeUnregistered);
+
+    // As pilhas passam do PC interrompido: SpinInner chamada por SpinOuter
+    const std::string path = dir.File("samples.folded");
+    DRIFT_CHECK(sampler.ExportFoldedStacks(path));
+    std::ifstream in(path);
+    std::string line;
+    bool foundCaller = false;
+    while (std::getline(in, line)) {
+        foundCaller = foundCaller || line.find("SpinOuter(") != std::string::npos;
+    }
+    DRIFT_CHECK(foundCaller);
+    sampler.Clear();
+#endif
+}
+
+} // namespace
+
+int main() {
+    DRIFT_RUN_TEST(SamplesRegisteredThreads);
+    return DRIFT_TEST_RESULT();
+}
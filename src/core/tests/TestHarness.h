@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+// Harness mínimo dos testes do Core: cada arquivo de teste é um executável registrado no
+// CTest, com funções de teste chamadas por DRIFT_RUN_TEST e código de saída != 0 em falha.
+
+namespace Drift::Core::Tests {
+
+inline int& FailureCount() {
+    static int failures = 0;
+    return failures;
+}
+
+// Diretório temporário exclusivo do teste, removido no destrutor
+class TempDirectory {
+public:
+    explicit TempDirectory(const std::string& name)
+        : m_Path(std::filesystem::temp_directory_path() / ("drift_test_" + name)) {
+        std::error_code ec;
+        std::filesystem::remove_all(m_Path, ec);
+        std::filesystem::create_directories(m_Path, ec);
+    }
+
+    ~TempDirectory() {
+        std::error_code ec;
+        std::filesystem::remove_all(m_Path, ec);
+    }
+
+    std::string File(const std::string& name) const { return (m_Path / name).string(); }
+
+private:
+    std::filesystem::path m_Path;
+};
+
+} // namespace Drift::Core::Tests
+
+#define DRIFT_CHECK(condition) do { \
+    if (!(condition)) { \
+        std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #condition); \
+        ++Drift::Core::Tests::FailureCount(); \
+    } \
+} while(0)
+
+#define DRIFT_RUN_TEST(test) do { \
+    const int failuresBefore = Drift::Core::Tests::FailureCount(); \
+    test(); \
+    std::printf("[%s] %s\n", Drift::Core::Tests::FailureCount() == failuresBefore ? " OK " : "FAIL", #test); \
+} while(0)
+
+#define DRIFT_TEST_RESULT() (Drift::Core::Tests::FailureCount() == 0 ? 0 : 1)
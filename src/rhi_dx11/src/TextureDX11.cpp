@@ -3,10 +3,13 @@
 #include "Drift/RHI/DX11/TextureDX11.h"
 #include "Drift/RHI/Texture.h"
 #include "Drift/Core/Log.h"
+#include "Drift/Core/IO/MappedFile.h"
+#include "Drift/Core/Assets/DerivedDataCache.h"
 #include <stdexcept>
 #include <wrl/client.h>
 #include <filesystem>
 #include <vector>
+#include <cstring>
 
 #include <gli/gli.hpp>
 #include <gli/dx.hpp>
@@ -23,8 +26,9 @@ static std::string ToUTF8(const std::wstring& wstr) {
 }
 
 // Função auxiliar para carregar imagens PNG/JPG usando stb_image
-static bool LoadImageWithSTB(const std::string& path, int& width, int& height, int& channels, unsigned char*& data) {
-    data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+// Decodifica diretamente das páginas mapeadas, sem buffer intermediário de leitura
+static bool LoadImageWithSTB(const Drift::Core::IO::FileView& file, int& width, int& height, int& channels, unsigned char*& data) {
+    data = stbi_load_from_memory(file.data, static_cast<int>(file.size), &width, &height, &channels, 0);
     return data != nullptr;
 }
 
@@ -37,6 +41,69 @@ static void FreeImageData(unsigned char* data) {
 
 namespace Drift::RHI::DX11 {
 
+// Versão da decodificação stb: incrementar ao mudar a conversão abaixo invalida o cache
+static constexpr uint32_t STB_DECODE_VERSION = 1;
+
+// Cabeçalho do blob decodificado guardado no DerivedDataCache (seguido dos pixels)
+struct DecodedImageHeader {
+    uint32_t width;
+    uint32_t height;
+    uint32_t channels;      // 1, 2 ou 4 (RGB é expandido para RGBA)
+    uint32_t reserved;
+};
+
+// Decodifica a imagem ou reaproveita o resultado de uma execução anterior
+static bool DecodeImageCached(const Drift::Core::IO::FileView& file, DecodedImageHeader& info,
+                              Drift::Core::IO::FileView& pixels) {
+    using namespace Drift::Core::Assets;
+
+    auto key = DerivedDataKey::Make("TextureDX11.stb", STB_DECODE_VERSION, file, "rgba-expand");
+    Drift::Core::IO::FileView blob = DerivedDataCache::GetInstance().GetOrBuild(key, [&](std::vector<uint8_t>& out) {
+        int width, height, channels;
+        unsigned char* imageData = nullptr;
+        if (!LoadImageWithSTB(file, width, height, channels, imageData)) {
+            return false;
+        }
+        if (channels < 1 || channels > 4) {
+            FreeImageData(imageData);
+            return false;
+        }
+
+        DecodedImageHeader header{};
+        header.width = static_cast<uint32_t>(width);
+        header.height = static_cast<uint32_t>(height);
+        header.channels = channels == 3 ? 4 : static_cast<uint32_t>(channels);
+
+        size_t pixelCount = static_cast<size_t>(width) * height;
+        out.resize(sizeof(header) + pixelCount * header.channels);
+        std::memcpy(out.data(), &header, sizeof(header));
+        uint8_t* dst = out.data() + sizeof(header);
+
+        // Se é RGB, converte para RGBA
+        if (channels == 3) {
+            for (size_t i = 0; i < pixelCount; ++i) {
+                dst[i * 4 + 0] = imageData[i * 3 + 0]; // R
+                dst[i * 4 + 1] = imageData[i * 3 + 1]; // G
+                dst[i * 4 + 2] = imageData[i * 3 + 2]; // B
+                dst[i * 4 + 3] = 255;                  // A
+            }
+        } else {
+            std::memcpy(dst, imageData, pixelCount * channels);
+        }
+
+        FreeImageData(imageData);
+        return true;
+    });
+
+    if (blob.size < sizeof(DecodedImageHeader)) {
+        return false;
+    }
+    std::memcpy(&info, blob.data, sizeof(info));
+    pixels = blob.SubView(sizeof(DecodedImageHeader));
+    return pixels.size == static_cast<size_t>(info.width) * info.height * info.channels;
+}
+
+
 // Cria textura DX11 a partir de arquivo (DDS/WIC) ou memória
 std::shared_ptr<Drift::RHI::ITexture> CreateTextureDX11(
     ID3D11Device* dev,
@@ -57,6 +124,14 @@ std::shared_ptr<Drift::RHI::ITexture> CreateTextureDX11(
 
     if (!desc.path.empty())
     {
+        // Mapeia o arquivo: gli e stb_image leem direto do mapeamento, evitando
+        // a cópia intermediária arquivo -> std::vector feita pelos loaders por path
+        auto mapped = Drift::Core::IO::MappedFile::Open(pathUtf8, Drift::Core::IO::MapAccessHint::Sequential);
+        if (!mapped || mapped->GetSize() == 0) {
+            throw std::runtime_error("Falha ao mapear arquivo de textura: " + pathUtf8);
+        }
+        const Drift::Core::IO::FileView fileView = mapped->GetView();
+
         // Verifica se é um formato suportado pelo GLI (DDS, KTX)
         bool isGLIFormat = false;
         gli::texture tex;
@@ -64,14 +139,14 @@ std::shared_ptr<Drift::RHI::ITexture> CreateTextureDX11(
         if (pathUtf8.size() >= 4 &&
             _stricmp(pathUtf8.c_str() + pathUtf8.size() - 4, ".dds") == 0)
         {
-            tex = gli::load_dds(pathUtf8);
+            tex = gli::load_dds(reinterpret_cast<const char*>(fileView.data), fileView.size);
             isGLIFormat = true;
         }
         else if (pathUtf8.size() >= 4 &&
                  (_stricmp(pathUtf8.c_str() + pathUtf8.size() - 4, ".ktx") == 0 ||
                   _stricmp(pathUtf8.c_str() + pathUtf8.size() - 5, ".ktx2") == 0))
         {
-            tex = gli::load_ktx(pathUtf8);
+            tex = gli::load_ktx(reinterpret_cast<const char*>(fileView.data), fileView.size);
             isGLIFormat = true;
         }
 
@@ -128,55 +203,27 @@ std::shared_ptr<Drift::RHI::ITexture> CreateTextureDX11(
         }
         else
         {
-            // Tenta carregar com stb_image (PNG, JPG, etc.)
-            int width, height, channels;
-            unsigned char* imageData = nullptr;
-            
-            if (!LoadImageWithSTB(pathUtf8, width, height, channels, imageData)) {
+            // Tenta carregar com stb_image (PNG, JPG, etc.); o resultado decodificado
+            // fica no DerivedDataCache e nas próximas execuções é só mapeado
+            DecodedImageHeader info{};
+            Drift::Core::IO::FileView pixels;
+            if (!DecodeImageCached(fileView, info, pixels)) {
                 throw std::runtime_error("Falha ao carregar imagem: " + pathUtf8);
             }
 
-            // Determina o formato DXGI baseado no número de canais
+            // Determina o formato DXGI baseado no número de canais (RGB já expandido para RGBA)
             DXGI_FORMAT dxgiFmt;
-            size_t bytesPerPixel;
-            
-            switch (channels) {
-                case 1: // Grayscale
-                    dxgiFmt = DXGI_FORMAT_R8_UNORM;
-                    bytesPerPixel = 1;
-                    break;
-                case 2: // Grayscale + Alpha
-                    dxgiFmt = DXGI_FORMAT_R8G8_UNORM;
-                    bytesPerPixel = 2;
-                    break;
-                case 3: // RGB
-                    dxgiFmt = DXGI_FORMAT_R8G8B8A8_UNORM;
-                    bytesPerPixel = 4; // Expandir para RGBA
-                    break;
-                case 4: // RGBA
-                    dxgiFmt = DXGI_FORMAT_R8G8B8A8_UNORM;
-                    bytesPerPixel = 4;
-                    break;
+            switch (info.channels) {
+                case 1: dxgiFmt = DXGI_FORMAT_R8_UNORM; break;         // Grayscale
+                case 2: dxgiFmt = DXGI_FORMAT_R8G8_UNORM; break;       // Grayscale + Alpha
+                case 4: dxgiFmt = DXGI_FORMAT_R8G8B8A8_UNORM; break;   // RGBA
                 default:
-                    FreeImageData(imageData);
                     throw std::runtime_error("Formato de imagem não suportado: " + pathUtf8);
             }
 
-            // Se é RGB, converte para RGBA
-            std::vector<unsigned char> rgbaData;
-            if (channels == 3) {
-                rgbaData.resize(width * height * 4);
-                for (int i = 0; i < width * height; ++i) {
-                    rgbaData[i * 4 + 0] = imageData[i * 3 + 0]; // R
-                    rgbaData[i * 4 + 1] = imageData[i * 3 + 1]; // G
-                    rgbaData[i * 4 + 2] = imageData[i * 3 + 2]; // B
-                    rgbaData[i * 4 + 3] = 255; // A
-                }
-            }
-
             D3D11_TEXTURE2D_DESC td{};
-            td.Width = width;
-            td.Height = height;
+            td.Width = info.width;
+            td.Height = info.height;
             td.MipLevels = 1;
             td.ArraySize = 1;
             td.Format = dxgiFmt;
@@ -187,19 +234,13 @@ std::shared_ptr<Drift::RHI::ITexture> CreateTextureDX11(
             td.MiscFlags = 0;
 
             D3D11_SUBRESOURCE_DATA initData{};
-            if (channels == 3) {
-                initData.pSysMem = rgbaData.data();
-                initData.SysMemPitch = width * 4;
-            } else {
-                initData.pSysMem = imageData;
-                initData.SysMemPitch = width * bytesPerPixel;
-            }
+            initData.pSysMem = pixels.data;
+            initData.SysMemPitch = info.width * info.channels;
             initData.SysMemSlicePitch = 0;
 
             Microsoft::WRL::ComPtr<ID3D11Texture2D> texObj;
             hr = dev->CreateTexture2D(&td, &initData, texObj.GetAddressOf());
             if (FAILED(hr)) {
-                FreeImageData(imageData);
                 throw std::runtime_error("Falha ao criar textura de '" + pathUtf8 + "'");
             }
 
@@ -211,12 +252,10 @@ std::shared_ptr<Drift::RHI::ITexture> CreateTextureDX11(
 
             hr = dev->CreateShaderResourceView(texObj.Get(), &sd, srv.GetAddressOf());
             if (FAILED(hr)) {
-                FreeImageData(imageData);
                 throw std::runtime_error("Falha ao criar SRV para '" + pathUtf8 + "'");
             }
 
             resource = texObj;
-            FreeImageData(imageData);
         }
     }
     // Textura vazia em memória
@@ -8,6 +8,7 @@
 #include "Drift/UI/FontSystem/FontRendering.h"
 #include "Drift/UI/FontSystem/FontManager.h"
 #include "Drift/Core/Log.h"
+#include "Drift/Core/Profiler.h"
 #include <d3d11.h>
 #include <algorithm>
 #include <chrono>
@@ -227,6 +228,10 @@ void UIBatcherDX11::OnEnd() {
         m_RingBuffer->NextFrame();
     }
     
+    // Somados por frame no profiler: mais de um Begin/End no frame acumula
+    PROFILE_COUNTER("UI/DrawCalls", m_Stats.drawCalls);
+    PROFILE_COUNTER("UI/Vertices", m_Stats.verticesRendered);
+    
     // Log estatísticas finais
     //Core::Log("[UIBatcherDX11] Frame finalizado - DrawCalls: " + std::to_string(m_Stats.drawCalls) + 
     //          ", Vértices: " + std::to_string(m_Stats.verticesRendered) + 
@@ -406,6 +411,7 @@ void UIBatcherDX11::OnAddTexturedRect(float x, float y, float w, float h,
 }
 
 void UIBatcherDX11::OnAddText(float x, float y, const char* text, Drift::Color color) {
+    PROFILE_MEMORY_TAG("Text");
     if (!m_TextRenderer) {
         Core::Log("[UIBatcherDX11] ERRO: TextRenderer não inicializado!");
         return;
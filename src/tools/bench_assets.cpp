@@ -0,0 +1,489 @@
+#include "Drift/Core/Assets/AssetsSystem.h"
+#include "Drift/Core/Threading/ThreadingSystem.h"
+#include "Drift/Core/Log.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Drift::Core;
+using namespace Drift::Core::Assets;
+using SteadyClock = std::chrono::steady_clock;
+
+// Stress do AssetsSystem: N assets sintéticos (sem disco), tráfego misto
+// GetAsset/LoadAssetAsync/UnloadAsset de várias threads com chaves em Zipf,
+// repetido para cada orçamento de memória. A semente fixa torna as execuções comparáveis.
+
+struct BenchOptions {
+    size_t assets = 20000;
+    size_t threads = 0;                                 // 0 = hardware_concurrency
+    double seconds = 3.0;
+    double warmup = 1.0;
+    std::vector<double> budgets = {100.0, 50.0, 25.0, 10.0};   // % do conjunto total
+    std::array<uint32_t, 3> mix = {80, 15, 5};           // get, load, unload
+    double skew = 0.9;                                  // Expoente Zipf (0 = uniforme)
+    size_t averageKB = 64;
+    uint32_t loadMicroseconds = 20;
+    uint32_t seed = 1234;
+    bool csv = false;
+};
+
+// ---------------------------------------------------------------------------
+// Asset e loader sintéticos: o tamanho é só declarado, nada é alocado
+// ---------------------------------------------------------------------------
+
+class BenchAsset : public IAsset {
+public:
+    BenchAsset(const std::string& path, size_t memory)
+        : m_Path(path), m_Memory(memory), m_LoadTime(SteadyClock::now()) {}
+
+    const std::string& GetPath() const override { return m_Path; }
+    const std::string& GetName() const override { return m_Path; }
+    size_t GetMemoryUsage() const override { return m_Memory; }
+    AssetStatus GetStatus() const override { return AssetStatus::Loaded; }
+    bool Load() override { return true; }
+    void Unload() override {}
+    bool IsLoaded() const override { return true; }
+    SteadyClock::time_point GetLoadTime() const override { return m_LoadTime; }
+    size_t GetAccessCount() const override { return 0; }
+    void UpdateAccess() override {}
+
+private:
+    std::string m_Path;
+    size_t m_Memory;
+    SteadyClock::time_point m_LoadTime;
+};
+
+class BenchLoader : public IAssetLoader<BenchAsset> {
+public:
+    BenchLoader(size_t averageKB, uint32_t loadMicroseconds)
+        : m_AverageBytes(averageKB * 1024), m_LoadCost(loadMicroseconds) {}
+
+    std::shared_ptr<BenchAsset> Load(const std::string& path, const std::any& params) override {
+        (void)params;
+        // Simula decodificação ocupando a CPU
+        auto until = SteadyClock::now() + m_LoadCost;
+        while (SteadyClock::now() < until) {
+        }
+        return std::make_shared<BenchAsset>(path, EstimateMemoryUsage(path));
+    }
+
+    bool CanLoad(const std::string& path) const override {
+        return path.size() > 6 && path.compare(path.size() - 6, 6, ".bench") == 0;
+    }
+    std::vector<std::string> GetSupportedExtensions() const override { return {".bench"}; }
+    std::string GetLoaderName() const override { return "BenchLoader"; }
+
+    // Tamanho determinístico por caminho, entre 1/4 e 7/4 da média
+    size_t EstimateMemoryUsage(const std::string& path) const override {
+        uint64_t hash = Hash64(path);
+        return m_AverageBytes / 4 + static_cast<size_t>(hash % (m_AverageBytes * 3 / 2 + 1));
+    }
+
+private:
+    size_t m_AverageBytes;
+    std::chrono::microseconds m_LoadCost;
+};
+
+// ---------------------------------------------------------------------------
+// Histograma log-linear de latência (8 sub-faixas por potência de 2, ~12%)
+// ---------------------------------------------------------------------------
+
+class LatencyHistogram {
+public:
+    static constexpr size_t SUB_BUCKETS = 8;
+    static constexpr size_t BUCKETS = 64 * SUB_BUCKETS;
+
+    void Record(uint64_t nanoseconds) {
+        m_Counts[BucketOf(nanoseconds)]++;
+        m_Total++;
+        m_Max = std::max(m_Max, nanoseconds);
+    }
+
+    void Merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            m_Counts[i] += other.m_Counts[i];
+        }
+        m_Total += other.m_Total;
+        m_Max = std::max(m_Max, other.m_Max);
+    }
+
+    uint64_t Percentile(double percentile) const {
+        if (m_Total == 0) {
+            return 0;
+        }
+        uint64_t target = static_cast<uint64_t>(std::ceil(m_Total * percentile / 100.0));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            seen += m_Counts[i];
+            if (seen >= std::max<uint64_t>(target, 1)) {
+                return std::min(UpperBound(i), m_Max);
+            }
+        }
+        return m_Max;
+    }
+
+    uint64_t GetCount() const { return m_Total; }
+    uint64_t GetMax() const { return m_Max; }
+
+private:
+    static size_t BucketOf(uint64_t value) {
+        if (value < SUB_BUCKETS) {
+            return static_cast<size_t>(value);
+        }
+        size_t exponent = static_cast<size_t>(std::ilogb(static_cast<double>(value)));
+        size_t mantissa = static_cast<size_t>((value >> (exponent - 3)) & (SUB_BUCKETS - 1));
+        return (exponent - 2) * SUB_BUCKETS + mantissa;
+    }
+
+    static uint64_t UpperBound(size_t bucket) {
+        if (bucket < SUB_BUCKETS) {
+            return bucket;
+        }
+        size_t exponent = bucket / SUB_BUCKETS + 2;
+        uint64_t mantissa = bucket % SUB_BUCKETS;
+        return ((SUB_BUCKETS + mantissa + 1) << (exponent - 3)) - 1;
+    }
+
+    std::array<uint64_t, BUCKETS> m_Counts{};
+    uint64_t m_Total = 0;
+    uint64_t m_Max = 0;
+};
+
+enum Operation { OP_GET = 0, OP_LOAD = 1, OP_UNLOAD = 2, OP_COUNT = 3 };
+static const char* OPERATION_NAMES[OP_COUNT] = {"GetAsset", "LoadAssetAsync", "UnloadAsset"};
+
+struct WorkerResult {
+    std::array<LatencyHistogram, OP_COUNT> latency;
+    uint64_t getHits = 0;
+};
+
+struct ScenarioResult {
+    double budgetPercent = 0.0;
+    size_t budgetBytes = 0;
+    double seconds = 0.0;
+    WorkerResult total;
+    AssetsStats stats;
+};
+
+// ---------------------------------------------------------------------------
+// Workload
+// ---------------------------------------------------------------------------
+
+// CDF de Zipf pré-calculada; rank 0 é o mais quente
+static std::vector<double> BuildZipfCdf(size_t count, double skew) {
+    std::vector<double> cdf(count);
+    double sum = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        sum += 1.0 / std::pow(static_cast<double>(i + 1), skew);
+        cdf[i] = sum;
+    }
+    for (double& value : cdf) {
+        value /= sum;
+    }
+    return cdf;
+}
+
+enum class Phase { Warmup, Measure, Stop };
+
+static ScenarioResult RunScenario(const BenchOptions& options, double budgetPercent, size_t totalBytes,
+                                  const std::vector<std::string>& paths, const std::vector<AssetId>& ids,
+                                  const std::vector<double>& cdf) {
+    auto& assets = AssetsSystem::GetInstance();
+    const std::type_index type(typeid(BenchAsset));
+
+    ScenarioResult result;
+    result.budgetPercent = budgetPercent;
+    result.budgetBytes = static_cast<size_t>(totalBytes * budgetPercent / 100.0);
+
+    // Cada cenário começa frio, com o novo orçamento
+    assets.WaitForAllLoads();
+    assets.ClearCache();
+    assets.SetMaxMemoryUsage(std::max<size_t>(result.budgetBytes, 1));
+
+    std::atomic<Phase> phase{Phase::Warmup};
+    std::vector<WorkerResult> workers(options.threads);
+    std::vector<std::thread> threads;
+    const uint32_t mixTotal = options.mix[0] + options.mix[1] + options.mix[2];
+
+    for (size_t t = 0; t < options.threads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937_64 rng(options.seed + t * 7919);
+            std::uniform_real_distribution<double> keyDist(0.0, 1.0);
+            std::uniform_int_distribution<uint32_t> opDist(0, mixTotal - 1);
+            WorkerResult& local = workers[t];
+
+            Phase current;
+            while ((current = phase.load(std::memory_order_relaxed)) != Phase::Stop) {
+                size_t index = static_cast<size_t>(std::lower_bound(cdf.begin(), cdf.end(), keyDist(rng)) - cdf.begin());
+                index = std::min(index, paths.size() - 1);
+                uint32_t roll = opDist(rng);
+                Operation op = roll < options.mix[0] ? OP_GET : (roll < options.mix[0] + options.mix[1] ? OP_LOAD : OP_UNLOAD);
+
+                auto start = SteadyClock::now();
+                bool hit = false;
+                switch (op) {
+                    case OP_GET:
+                        hit = assets.GetAsset<BenchAsset>(ids[index]) != nullptr;
+                        break;
+                    case OP_LOAD:
+                        // Dispara e esquece, como o jogo faz ao entrar numa área
+                        assets.LoadAssetAsync<BenchAsset>(paths[index]);
+                        break;
+                    default:
+                        assets.UnloadAsset(paths[index], type);
+                        break;
+                }
+                auto elapsed = SteadyClock::now() - start;
+
+                if (current == Phase::Measure) {
+                    local.latency[op].Record(static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+                    local.getHits += hit ? 1 : 0;
+                }
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.warmup));
+    assets.ResetStats();
+    auto measureStart = SteadyClock::now();
+    phase = Phase::Measure;
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.seconds));
+    phase = Phase::Stop;
+    result.seconds = std::chrono::duration<double>(SteadyClock::now() - measureStart).count();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    result.stats = assets.GetStats();
+
+    for (const auto& worker : workers) {
+        for (size_t op = 0; op < OP_COUNT; ++op) {
+            result.total.latency[op].Merge(worker.latency[op]);
+        }
+        result.total.getHits += worker.getHits;
+    }
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Relatório
+// ---------------------------------------------------------------------------
+
+static uint64_t TotalOperations(const ScenarioResult& result) {
+    uint64_t ops = 0;
+    for (const auto& histogram : result.total.latency) {
+        ops += histogram.GetCount();
+    }
+    return ops;
+}
+
+static double HitRatio(const ScenarioResult& result) {
+    uint64_t gets = result.total.latency[OP_GET].GetCount();
+    return gets > 0 ? 100.0 * result.total.getHits / gets : 0.0;
+}
+
+static void PrintScenario(const ScenarioResult& result) {
+    const auto& stats = result.stats;
+    uint64_t ops = TotalOperations(result);
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "=== orçamento %.0f%% (%zu MB) ===", result.budgetPercent,
+                  result.budgetBytes / (1024 * 1024));
+    std::cout << line << "\n";
+    std::snprintf(line, sizeof(line), "  vazão:       %.0f ops/s (%llu ops em %.2f s)", ops / result.seconds,
+                  static_cast<unsigned long long>(ops), result.seconds);
+    std::cout << line << "\n";
+    std::snprintf(line, sizeof(line), "  acertos:     %.2f%% GetAsset (cache: %zu acertos / %zu falhas)", HitRatio(result),
+                  stats.cacheHits, stats.cacheMisses);
+    std::cout << line << "\n";
+    std::snprintf(line, sizeof(line), "  %-16s %10s %9s %9s %9s %9s %9s", "tempo (us)", "qtd", "p50", "p90", "p99",
+                  "p99.9", "max");
+    std::cout << line << "\n";
+    for (size_t op = 0; op < OP_COUNT; ++op) {
+        const auto& histogram = result.total.latency[op];
+        std::snprintf(line, sizeof(line), "  %-16s %10llu %9.2f %9.2f %9.2f %9.2f %9.2f", OPERATION_NAMES[op],
+                      static_cast<unsigned long long>(histogram.GetCount()), histogram.Percentile(50) / 1000.0,
+                      histogram.Percentile(90) / 1000.0, histogram.Percentile(99) / 1000.0,
+                      histogram.Percentile(99.9) / 1000.0, histogram.GetMax() / 1000.0);
+        std::cout << line << "\n";
+    }
+    std::snprintf(line, sizeof(line), "  cargas:      %zu concluídas (%zu assíncronas), residentes %zu assets / %zu MB",
+                  stats.loadCount + stats.asyncLoadCount, stats.asyncLoadCount, stats.totalAssets,
+                  stats.memoryUsage / (1024 * 1024));
+    std::cout << line << "\n";
+    std::snprintf(line, sizeof(line), "  despejos:    %zu, %.2f ms no total, %.2f us cada", stats.evictionCount,
+                  stats.evictionTime * 1000.0, stats.evictionCount > 0 ? stats.evictionTime * 1e6 / stats.evictionCount : 0.0);
+    std::cout << line << "\n";
+    std::snprintf(line, sizeof(line), "  lock cache:  %zu aquisições, %.2f%% disputadas, %.2f ms de espera (%.2f us por disputa)",
+                  stats.lockAcquisitions,
+                  stats.lockAcquisitions > 0 ? 100.0 * stats.lockContentions / stats.lockAcquisitions : 0.0,
+                  stats.lockWaitTime * 1000.0,
+                  stats.lockContentions > 0 ? stats.lockWaitTime * 1e6 / stats.lockContentions : 0.0);
+    std::cout << line << std::endl;
+}
+
+static void PrintCsvHeader() {
+    std::cout << "budget_pct,budget_bytes,seconds,ops_per_sec,hit_ratio";
+    for (const char* name : OPERATION_NAMES) {
+        std::cout << "," << name << "_count," << name << "_p50_ns," << name << "_p99_ns," << name << "_p999_ns," << name << "_max_ns";
+    }
+    std::cout << ",loads,evictions,eviction_sec,lock_acquisitions,lock_contentions,lock_wait_sec" << std::endl;
+}
+
+static void PrintCsvRow(const ScenarioResult& result) {
+    const auto& stats = result.stats;
+    std::cout << result.budgetPercent << "," << result.budgetBytes << "," << result.seconds << ","
+              << TotalOperations(result) / result.seconds << "," << HitRatio(result);
+    for (const auto& histogram : result.total.latency) {
+        std::cout << "," << histogram.GetCount() << "," << histogram.Percentile(50) << "," << histogram.Percentile(99)
+                  << "," << histogram.Percentile(99.9) << "," << histogram.GetMax();
+    }
+    std::cout << "," << stats.loadCount + stats.asyncLoadCount << "," << stats.evictionCount << "," << stats.evictionTime << ","
+              << stats.lockAcquisitions << "," << stats.lockContentions << "," << stats.lockWaitTime << std::endl;
+}
+
+// ---------------------------------------------------------------------------
+// Linha de comando
+// ---------------------------------------------------------------------------
+
+static void PrintUsage() {
+    std::cout << "Uso: DriftBench_Assets [opções]\n";
+    std::cout << "  --assets <n>          assets sintéticos (padrão 20000)\n";
+    std::cout << "  --threads <n>         threads clientes (padrão: threads do hardware)\n";
+    std::cout << "  --seconds <s>         tempo medido por orçamento (padrão 3)\n";
+    std::cout << "  --warmup <s>          aquecimento não medido por orçamento (padrão 1)\n";
+    std::cout << "  --budgets <p,...>     orçamentos de memória em % do total dos assets (padrão 100,50,25,10)\n";
+    std::cout << "  --mix <get,load,unl>  pesos das operações (padrão 80,15,5)\n";
+    std::cout << "  --skew <s>            expoente Zipf da popularidade das chaves, 0 = uniforme (padrão 0.9)\n";
+    std::cout << "  --size-kb <n>         tamanho médio de um asset (padrão 64)\n";
+    std::cout << "  --load-us <n>         custo simulado de cada carga (padrão 20)\n";
+    std::cout << "  --seed <n>            semente aleatória (padrão 1234)\n";
+    std::cout << "  --csv                 uma linha CSV por orçamento" << std::endl;
+}
+
+template<typename T>
+static std::vector<T> ParseList(const std::string& text) {
+    std::vector<T> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        values.push_back(static_cast<T>(std::stod(item)));
+    }
+    return values;
+}
+
+static bool ParseOptions(int argc, char** argv, BenchOptions& options) {
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--csv") {
+                options.csv = true;
+            } else if (arg == "--assets" && hasValue) {
+                options.assets = std::stoul(argv[++i]);
+            } else if (arg == "--threads" && hasValue) {
+                options.threads = std::stoul(argv[++i]);
+            } else if (arg == "--seconds" && hasValue) {
+                options.seconds = std::stod(argv[++i]);
+            } else if (arg == "--warmup" && hasValue) {
+                options.warmup = std::stod(argv[++i]);
+            } else if (arg == "--budgets" && hasValue) {
+                options.budgets = ParseList<double>(argv[++i]);
+            } else if (arg == "--mix" && hasValue) {
+                auto mix = ParseList<uint32_t>(argv[++i]);
+                if (mix.size() != 3 || mix[0] + mix[1] + mix[2] == 0) {
+                    std::cerr << "--mix espera três pesos, ex.: 80,15,5" << std::endl;
+                    return false;
+                }
+                options.mix = {mix[0], mix[1], mix[2]};
+            } else if (arg == "--skew" && hasValue) {
+                options.skew = std::stod(argv[++i]);
+            } else if (arg == "--size-kb" && hasValue) {
+                options.averageKB = std::stoul(argv[++i]);
+            } else if (arg == "--load-us" && hasValue) {
+                options.loadMicroseconds = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } else if (arg == "--seed" && hasValue) {
+                options.seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } else {
+                return false;
+            }
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Valor inválido na linha de comando" << std::endl;
+        return false;
+    }
+
+    if (options.threads == 0) {
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return options.assets > 0 && options.averageKB > 0 && !options.budgets.empty();
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    SetLogLevel(LogLevel::Warning);
+
+    Threading::ThreadingSystem::GetInstance().Initialize();
+
+    // Nada vem do disco: sem mmap, IO assíncrono nem manifesto
+    AssetsConfig config;
+    config.maxAssets = options.assets;
+    config.enableMemoryMappedIO = false;
+    config.enableAsyncIO = false;
+    config.replayPrefetchManifest = false;
+    config.enableContentDedup = false;
+    auto& assets = AssetsSystem::GetInstance();
+    assets.Initialize(config);
+    auto loader = std::make_unique<BenchLoader>(options.averageKB, options.loadMicroseconds);
+    const BenchLoader& loaderRef = *loader;
+    assets.RegisterLoader<BenchAsset>(std::move(loader));
+
+    std::vector<std::string> paths(options.assets);
+    std::vector<AssetId> ids(options.assets);
+    size_t totalBytes = 0;
+    for (size_t i = 0; i < options.assets; ++i) {
+        paths[i] = "bench/asset_" + std::to_string(i) + ".bench";
+        ids[i] = AssetId::FromPath(paths[i]);
+        totalBytes += loaderRef.EstimateMemoryUsage(paths[i]);
+    }
+    auto cdf = BuildZipfCdf(options.assets, options.skew);
+
+    if (options.csv) {
+        PrintCsvHeader();
+    } else {
+        char line[256];
+        std::snprintf(line, sizeof(line), "%zu assets (%zu MB), %zu threads, mix %u/%u/%u, skew %.2f, carga %u us, semente %u",
+                      options.assets, totalBytes / (1024 * 1024), options.threads, options.mix[0], options.mix[1],
+                      options.mix[2], options.skew, options.loadMicroseconds, options.seed);
+        std::cout << line << std::endl;
+    }
+
+    for (double budget : options.budgets) {
+        ScenarioResult result = RunScenario(options, budget, totalBytes, paths, ids, cdf);
+        if (options.csv) {
+            PrintCsvRow(result);
+        } else {
+            PrintScenario(result);
+        }
+    }
+
+    assets.Shutdown();
+    Threading::ThreadingSystem::GetInstance().Shutdown();
+    return 0;
+}
@@ -0,0 +1,142 @@
+#include "Drift/Core/IO/ArchiveWriter.h"
+#include "Drift/Core/IO/ArchiveFileSystem.h"
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace Drift::Core::IO;
+
+static void PrintUsage() {
+    std::cout << "Usage:\n";
+    std::cout << "  DriftPak pack <output.dpak> <input>... [--root <dir>] [--compress] [--align <bytes>]\n";
+    std::cout << "  DriftPak list <archive.dpak>\n";
+    std::cout << "  DriftPak verify <archive.dpak>\n";
+    std::cout << "input: arquivo ou diretório (recursivo); caminhos ficam relativos a --root (padrão: diretório atual)" << std::endl;
+}
+
+static int Pack(int argc, char** argv) {
+    if (argc < 4) {
+        PrintUsage();
+        return 1;
+    }
+
+    std::string output = argv[2];
+    std::vector<std::string> inputs;
+    fs::path root = fs::current_path();
+    ArchiveWriterConfig config;
+
+    for (int i = 3; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--root" && i + 1 < argc) {
+            root = fs::absolute(argv[++i]);
+        } else if (arg == "--compress") {
+            config.enableCompression = true;
+        } else if (arg == "--align" && i + 1 < argc) {
+            config.alignment = static_cast<uint32_t>(std::stoul(argv[++i]));
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    ArchiveWriter writer(config);
+
+    auto addFile = [&](const fs::path& file) {
+        std::string name = fs::relative(fs::absolute(file), root).generic_string();
+        if (name.empty() || name.rfind("..", 0) == 0) {
+            std::cerr << "Arquivo fora de --root: " << file.string() << std::endl;
+            return false;
+        }
+        return writer.AddFile(name, file.string());
+    };
+
+    for (const auto& input : inputs) {
+        fs::path inputPath(input);
+        if (fs::is_directory(inputPath)) {
+            for (const auto& item : fs::recursive_directory_iterator(inputPath)) {
+                if (item.is_regular_file() && !addFile(item.path())) {
+                    return 1;
+                }
+            }
+        } else if (fs::is_regular_file(inputPath)) {
+            if (!addFile(inputPath)) {
+                return 1;
+            }
+        } else {
+            std::cerr << "Entrada não encontrada: " << input << std::endl;
+            return 1;
+        }
+    }
+
+    if (writer.GetEntryCount() == 0) {
+        std::cerr << "Nenhum arquivo para empacotar" << std::endl;
+        return 1;
+    }
+
+    if (!writer.Write(output)) {
+        std::cerr << "Falha ao gravar " << output << std::endl;
+        return 1;
+    }
+
+    const auto& stats = writer.GetStats();
+    std::cout << "Packed " << stats.entryCount << " entries -> " << output << "\n";
+    std::cout << "  original: " << stats.originalBytes << " bytes\n";
+    std::cout << "  stored:   " << stats.storedBytes << " bytes (" << stats.compressedEntries << " compressed)\n";
+    std::cout << "  padding:  " << stats.paddingBytes << " bytes\n";
+    std::cout << "  archive:  " << stats.archiveSize << " bytes" << std::endl;
+    return 0;
+}
+
+static int List(const std::string& archivePath) {
+    auto archive = ArchiveFileSystem::Open(archivePath);
+    if (!archive) {
+        std::cerr << "Falha ao abrir " << archivePath << std::endl;
+        return 1;
+    }
+
+    for (const auto& entry : archive->ListEntries()) {
+        std::cout << entry.path << "  " << entry.originalSize << " bytes";
+        if (entry.compression != CompressionMethod::None) {
+            std::cout << " (stored " << entry.storedSize << ")";
+        }
+        std::cout << "  @" << entry.dataOffset << "\n";
+    }
+    std::cout << archive->GetEntryCount() << " entries" << std::endl;
+    return 0;
+}
+
+static int Verify(const std::string& archivePath) {
+    auto archive = ArchiveFileSystem::Open(archivePath);
+    if (!archive) {
+        std::cerr << "Falha ao abrir " << archivePath << std::endl;
+        return 1;
+    }
+
+    if (!archive->VerifyAll()) {
+        std::cerr << "Verificação falhou: " << archivePath << std::endl;
+        return 1;
+    }
+
+    std::cout << "OK: " << archive->GetEntryCount() << " entries verified" << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        PrintUsage();
+        return 1;
+    }
+
+    std::string command = argv[1];
+    if (command == "pack") {
+        return Pack(argc, argv);
+    } else if (command == "list") {
+        return List(argv[2]);
+    } else if (command == "verify") {
+        return Verify(argv[2]);
+    }
+
+    PrintUsage();
+    return 1;
+}
@@ -0,0 +1,239 @@
+#include "Drift/Core/ProfilerStream.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Drift::Core;
+using SteadyClock = std::chrono::steady_clock;
+
+// Visualizador de terminal do stream do profiler (ProfilerConfig::streamAddress):
+// seções mais caras, tempos de frame e contadores da janela dos últimos frames recebidos.
+// Reconecta sozinho quando o jogo reinicia.
+
+struct ViewerOptions {
+    std::string address = "tcp:7777";
+    size_t top = 20;
+    size_t window = 120;                // Frames considerados nas médias
+    uint32_t refreshMs = 500;
+    bool plain = false;                 // Sem códigos ANSI: um bloco por atualização (logs, pipes)
+};
+
+// ---------------------------------------------------------------------------
+// Tela
+// ---------------------------------------------------------------------------
+
+static double Percentile(std::vector<uint64_t> values, double p) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t index = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+    return values[index] / 1e6;
+}
+
+static void Render(const ViewerOptions& options, const ProfilerStreamClient& client,
+                   const std::deque<ProfilerStreamFrame>& frames, uint64_t totalFrames, uint64_t skippedFrames) {
+    const auto& sectionNames = client.GetSectionNames();
+    const auto& counterNames = client.GetCounterNames();
+    char line[256];
+    std::string screen;
+    if (!options.plain) {
+        screen += "\x1b[H\x1b[2J";
+    }
+
+    std::snprintf(line, sizeof(line), "DriftProfilerViewer  %s  |  %llu frames recebidos, %llu perdidos\n",
+                  options.address.c_str(), static_cast<unsigned long long>(totalFrames),
+                  static_cast<unsigned long long>(skippedFrames));
+    screen += line;
+    if (frames.empty()) {
+        screen += "Aguardando frames...\n";
+        std::cout << screen << std::flush;
+        return;
+    }
+
+    // Frames
+    std::vector<uint64_t> durations;
+    uint64_t frameTotalNs = 0;
+    for (const auto& frame : frames) {
+        durations.push_back(frame.durationNs);
+        frameTotalNs += frame.durationNs;
+    }
+    const double averageFrameMs = frameTotalNs / 1e6 / frames.size();
+    std::snprintf(line, sizeof(line),
+                  "Frame #%llu: %.2f ms | últimos %zu: média %.2f ms (%.1f FPS), p50 %.2f, p95 %.2f, p99 %.2f, máx %.2f ms\n\n",
+                  static_cast<unsigned long long>(frames.back().index), frames.back().durationNs / 1e6, frames.size(),
+                  averageFrameMs, averageFrameMs > 0.0 ? 1000.0 / averageFrameMs : 0.0, Percentile(durations, 0.50),
+                  Percentile(durations, 0.95), Percentile(durations, 0.99), Percentile(durations, 1.0));
+    screen += line;
+
+    // Seções: tempo médio por frame na janela (frames em que a seção não rodou contam zero)
+    struct SectionRow {
+        uint32_t id;
+        uint64_t totalNs = 0;
+        uint64_t maxNs = 0;
+        size_t frames = 0;
+    };
+    std::vector<SectionRow> sections;
+    for (const auto& frame : frames) {
+        for (const auto& [id, timeNs] : frame.sections) {
+            if (id >= sections.size()) {
+                for (uint32_t next = static_cast<uint32_t>(sections.size()); next <= id; ++next) {
+                    sections.push_back({next});
+                }
+            }
+            SectionRow& row = sections[id];
+            row.totalNs += timeNs;
+            row.maxNs = std::max(row.maxNs, timeNs);
+            row.frames++;
+        }
+    }
+    sections.erase(std::remove_if(sections.begin(), sections.end(), [](const SectionRow& row) { return row.frames == 0; }),
+                   sections.end());
+    std::sort(sections.begin(), sections.end(),
+              [](const SectionRow& a, const SectionRow& b) { return a.totalNs > b.totalNs; });
+
+    std::snprintf(line, sizeof(line), "%-41s %10s %10s %8s %8s\n", "Seção", "Avg (ms)", "Max (ms)", "% frame", "Frames");
+    screen += line;
+    for (size_t i = 0; i < sections.size() && i < options.top; ++i) {
+        const SectionRow& row = sections[i];
+        const std::string& name = row.id < sectionNames.size() ? sectionNames[row.id] : "?";
+        double averageMs = row.totalNs / 1e6 / frames.size();
+        std::snprintf(line, sizeof(line), "%-40.40s %10.3f %10.3f %7.1f%% %8zu\n", name.c_str(), averageMs,
+                      row.maxNs / 1e6, frameTotalNs > 0 ? 100.0 * row.totalNs / frameTotalNs : 0.0, row.frames);
+        screen += line;
+    }
+
+    // Contadores
+    struct CounterRow {
+        double last = 0.0;
+        double sum = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+        size_t frames = 0;
+    };
+    std::vector<CounterRow> counters(counterNames.size());
+    for (const auto& frame : frames) {
+        for (const auto& [id, value] : frame.counters) {
+            if (id >= counters.size()) {
+                continue;
+            }
+            CounterRow& row = counters[id];
+            row.min = row.frames == 0 ? value : std::min(row.min, value);
+            row.max = row.frames == 0 ? value : std::max(row.max, value);
+            row.last = value;
+            row.sum += value;
+            row.frames++;
+        }
+    }
+    if (!counters.empty()) {
+        std::snprintf(line, sizeof(line), "\n%-40s %12s %12s %12s %12s\n", "Contador", "Last", "Avg", "Min", "Max");
+        screen += line;
+        for (size_t id = 0; id < counters.size(); ++id) {
+            const CounterRow& row = counters[id];
+            if (row.frames == 0) {
+                continue;
+            }
+            std::snprintf(line, sizeof(line), "%-40.40s %12.2f %12.2f %12.2f %12.2f\n", counterNames[id].c_str(),
+                          row.last, row.sum / row.frames, row.min, row.max);
+            screen += line;
+        }
+    }
+    std::cout << screen << std::flush;
+}
+
+// ---------------------------------------------------------------------------
+// Linha de comando
+// ---------------------------------------------------------------------------
+
+static void PrintUsage() {
+    std::cout << "Usage: DriftProfilerViewer [options]\n";
+    std::cout << "  --address <addr>      unix:/path or tcp:port, as in ProfilerConfig::streamAddress (default tcp:7777)\n";
+    std::cout << "  --top <n>             sections shown (default 20)\n";
+    std::cout << "  --window <n>          frames averaged (default 120)\n";
+    std::cout << "  --refresh-ms <n>      screen refresh interval (default 500)\n";
+    std::cout << "  --plain               no ANSI escapes, one block per refresh" << std::endl;
+}
+
+static bool ParseOptions(int argc, char** argv, ViewerOptions& options) {
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--plain") {
+                options.plain = true;
+            } else if (arg == "--address" && hasValue) {
+                options.address = argv[++i];
+            } else if (arg == "--top" && hasValue) {
+                options.top = std::stoul(argv[++i]);
+            } else if (arg == "--window" && hasValue) {
+                options.window = std::stoul(argv[++i]);
+            } else if (arg == "--refresh-ms" && hasValue) {
+                options.refreshMs = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } else {
+                return false;
+            }
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Valor inválido na linha de comando" << std::endl;
+        return false;
+    }
+    return options.window > 0 && options.refreshMs > 0;
+}
+
+int main(int argc, char** argv) {
+    ViewerOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    ProfilerStreamClient client;
+    std::deque<ProfilerStreamFrame> frames;
+    uint64_t totalFrames = 0;
+    uint64_t skippedFrames = 0;
+    std::string lastError;
+
+    for (;;) {
+        if (!client.IsConnected()) {
+            if (!client.Connect(options.address)) {
+                if (client.GetLastError() != lastError) {
+                    lastError = client.GetLastError();
+                    std::cerr << "Aguardando " << options.address << " (" << lastError << ")" << std::endl;
+                }
+                std::this_thread::sleep_for(std::chrono::seconds(1));
+                continue;
+            }
+            lastError.clear();
+            frames.clear();
+            totalFrames = skippedFrames = 0;
+        }
+
+        auto nextRefresh = SteadyClock::now() + std::chrono::milliseconds(options.refreshMs);
+        while (client.IsConnected() && SteadyClock::now() < nextRefresh) {
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(nextRefresh - SteadyClock::now());
+            client.Poll(static_cast<int>(std::max<int64_t>(remaining.count(), 0)));
+            for (auto& frame : client.TakeFrames()) {
+                // Índices pulados: o servidor descartou frames porque o visualizador ficou para trás
+                if (!frames.empty() && frame.index > frames.back().index + 1) {
+                    skippedFrames += frame.index - frames.back().index - 1;
+                }
+                frames.push_back(std::move(frame));
+                totalFrames++;
+                while (frames.size() > options.window) {
+                    frames.pop_front();
+                }
+            }
+        }
+
+        if (!client.IsConnected()) {
+            std::cerr << "Conexão perdida: " << client.GetLastError() << std::endl;
+            continue;
+        }
+        Render(options, client, frames, totalFrames, skippedFrames);
+    }
+}
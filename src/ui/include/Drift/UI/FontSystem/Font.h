@@ -90,6 +90,7 @@ public:
     // Carregamento de fontes
     bool LoadFromFile(const std::string& path);
     bool LoadFromMemory(const unsigned char* data, size_t size);
+    bool LoadFromView(const std::string& path, const Drift::Core::IO::FileView& view);
     bool LoadFromAsset(const std::string& assetPath);
 
     // Acesso a glyphs
@@ -132,7 +133,10 @@ private:
     size_t m_AccessCount{0};
     
     // Dados TTF/OTF
+    // m_FontView aponta para o arquivo mapeado (zero-copy) ou para m_FontData
+    // quando a fonte foi carregada de um buffer externo via LoadFromMemory
     std::vector<unsigned char> m_FontData;
+    Drift::Core::IO::FileView m_FontView;
     std::unique_ptr<stbtt_fontinfo> m_FontInfo;
     bool m_IsValid{false};
     
@@ -192,6 +196,7 @@ public:
 
     // Implementação de IAssetLoader
     std::shared_ptr<Font> Load(const std::string& path, const std::any& params = {}) override;
+    std::shared_ptr<Font> Load(const std::string& path, const Drift::Core::IO::FileView& data, const std::any& params = {}) override;
     bool CanLoad(const std::string& path) const override;
     std::vector<std::string> GetSupportedExtensions() const override;
     std::string GetLoaderName() const override { return "FontLoader"; }
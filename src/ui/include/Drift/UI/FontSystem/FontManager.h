@@ -4,6 +4,7 @@
 #include "FontAtlas.h"
 #include "FontMetrics.h"
 #include "Drift/Core/Assets/AssetsSystem.h"
+#include "Drift/Core/ProfiledMutex.h"
 #include <unordered_map>
 #include <memory>
 #include <mutex>
@@ -196,7 +197,7 @@ private:
     mutable double m_TotalLoadTime{0.0};
     
     // Threading
-    mutable std::mutex m_Mutex;
+    mutable Drift::Core::ProfiledMutex m_Mutex{"FontManager"};
     
     // Métodos auxiliares
     std::shared_ptr<Font> CreateFont(const std::string& path, const FontLoadConfig& config);
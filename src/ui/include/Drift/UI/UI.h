@@ -17,6 +17,7 @@
 #include "Drift/UI/Widgets/Label.h"
 #include "Drift/UI/Widgets/Panel.h"
 #include "Drift/UI/Widgets/Image.h"
+#include "Drift/UI/Widgets/ProfilerOverlay.h"
 
 // Data-Driven
 #include "Drift/UI/DataDriven/UIComponentRegistry.h"
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Drift/UI/UIElement.h"
+#include "Drift/Core/Color.h"
+#include "Drift/Core/Profiler.h"
+#include <array>
+#include <vector>
+
+namespace Drift::UI {
+
+struct ProfilerOverlayConfig {
+    size_t graphFrames = 120;               // Barras do gráfico, uma por frame
+    size_t topSections = 8;                 // Seções mais caras do último frame
+    float targetFrameMs = 16.67f;           // Linha de orçamento; acima dela as barras mudam de cor
+    float graphMaxMs = 50.0f;               // Tempo no topo do gráfico
+    float graphHeight = 80.0f;
+    float lineHeight = 18.0f;
+    float padding = 8.0f;
+    Drift::Color backgroundColor{0xC0101010};
+};
+
+/**
+ * @brief Painel com tempos do profiler desenhado direto no IUIBatcher
+ *
+ * Mostra o tempo do último frame, um gráfico dos últimos frames contra o orçamento e as
+ * seções mais caras do último frame com barras proporcionais ao frame. Os buffers são
+ * alocados em SetConfig(); Update() e Render() só copiam do Profiler e formatam em
+ * arrays fixos, então o overlay não aloca nem aparece nas tags de memória que exibe.
+ */
+class ProfilerOverlay : public UIElement {
+public:
+    explicit ProfilerOverlay(UIContext* context);
+    ~ProfilerOverlay() override = default;
+
+    // Realoca os buffers e recalcula a altura do painel; não chamar por frame
+    void SetConfig(const ProfilerOverlayConfig& config);
+    const ProfilerOverlayConfig& GetConfig() const { return m_Config; }
+
+    void Update(float deltaSeconds) override;
+    void Render(Drift::RHI::IUIBatcher& batch) override;
+
+private:
+    static constexpr size_t TEXT_CAPACITY = 96;
+    using TextLine = std::array<char, TEXT_CAPACITY>;
+
+    Drift::Color ApplyOpacity(Drift::Color color) const;
+    Drift::Color GetFrameColor(double frameMs) const;
+
+    ProfilerOverlayConfig m_Config;
+
+    // Dados copiados do Profiler no Update
+    std::vector<uint64_t> m_FrameTimes;
+    size_t m_FrameCount = 0;
+    std::vector<Drift::Core::ProfileFrameSection> m_Sections;
+    size_t m_SectionCount = 0;
+    uint64_t m_LastFrameNs = 0;
+
+    // Texto já formatado
+    TextLine m_HeaderText{};
+    std::vector<TextLine> m_SectionText;
+    std::array<char, 64> m_NameScratch{};
+};
+
+} // namespace Drift::UI
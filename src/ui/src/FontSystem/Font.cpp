@@ -5,6 +5,7 @@
 #include "Drift/Core/Profiler.h"
 #include "Drift/RHI/Device.h"
 #include "Drift/RHI/Texture.h"
+#include "Drift/Core/IO/MappedFile.h"
 #include <stb_truetype.h>
 #include <fstream>
 #include <algorithm>
@@ -43,8 +44,8 @@ Font::~Font() {
 size_t Font::GetMemoryUsage() const {
     size_t usage = 0;
     
-    // Dados da fonte
-    usage += m_FontData.size();
+    // Dados da fonte (mapeados ou copiados)
+    usage += m_FontView.size;
     
     // Glyphs
     usage += m_Glyphs.size() * sizeof(GlyphInfo);
@@ -84,6 +85,7 @@ bool Font::Load() {
 void Font::Unload() {
     DRIFT_PROFILE_FUNCTION();
     
+    m_FontView = {};
     m_FontData.clear();
     m_FontInfo.reset();
     m_Glyphs.clear();
@@ -96,29 +98,37 @@ void Font::Unload() {
 bool Font::LoadFromFile(const std::string& path) {
     DRIFT_PROFILE_FUNCTION();
     
-    m_Path = path;
-    
-    std::ifstream file(path, std::ios::binary);
-    if (!file.is_open()) {
+    // stb_truetype consulta tabelas espalhadas pelo arquivo: acesso aleatório
+    auto file = Drift::Core::IO::MappedFile::Open(path, Drift::Core::IO::MapAccessHint::Random);
+    if (!file) {
         DRIFT_LOG_ERROR("Não foi possível abrir arquivo de fonte: {}", path);
         return false;
     }
     
-    // Ler dados do arquivo
-    file.seekg(0, std::ios::end);
-    size_t fileSize = file.tellg();
-    file.seekg(0, std::ios::beg);
-    
-    m_FontData.resize(fileSize);
-    file.read(reinterpret_cast<char*>(m_FontData.data()), fileSize);
-    
-    return InitializeFontInfo();
+    return LoadFromView(path, file->GetView());
 }
 
 bool Font::LoadFromMemory(const unsigned char* data, size_t size) {
     DRIFT_PROFILE_FUNCTION();
     
     m_FontData.assign(data, data + size);
+    m_FontView = Drift::Core::IO::FileView(m_FontData.data(), m_FontData.size());
+    return InitializeFontInfo();
+}
+
+bool Font::LoadFromView(const std::string& path, const Drift::Core::IO::FileView& view) {
+    DRIFT_PROFILE_FUNCTION();
+    
+    m_Path = path;
+    
+    // Visões sem dono não garantem tempo de vida: copia para m_FontData
+    if (!view.IsOwned()) {
+        return LoadFromMemory(view.data, view.size);
+    }
+    
+    // Retém o mapeamento (ou buffer do arquivo .dpak); stb_truetype lê in-place
+    m_FontData.clear();
+    m_FontView = view;
     return InitializeFontInfo();
 }
 
@@ -145,12 +155,12 @@ bool Font::LoadFromAsset(const std::string& assetPath) {
 bool Font::InitializeFontInfo() {
     DRIFT_PROFILE_FUNCTION();
     
-    if (m_FontData.empty()) {
+    if (m_FontView.Empty()) {
         return false;
     }
     
     // Inicializar STB TrueType
-    if (!stbtt_InitFont(m_FontInfo.get(), m_FontData.data(), 0)) {
+    if (!stbtt_InitFont(m_FontInfo.get(), m_FontView.data, 0)) {
         DRIFT_LOG_ERROR("Falha ao inicializar fonte TTF: {}", m_Name);
         return false;
     }
@@ -480,6 +490,22 @@ std::shared_ptr<Font> FontLoader::Load(const std::string& path, const std::any&
     return nullptr;
 }
 
+std::shared_ptr<Font> FontLoader::Load(const std::string& path, const Drift::Core::IO::FileView& data, const std::any& params) {
+    DRIFT_PROFILE_FUNCTION();
+    
+    FontLoadConfig config = ParseLoadParams(params);
+    auto font = std::make_shared<Font>(GetFontNameFromPath(path), config);
+    
+    // Reaproveita o mapeamento feito pelo AssetsSystem
+    data.Advise(Drift::Core::IO::MapAccessHint::Random);
+    
+    if (font->LoadFromView(path, data)) {
+        return font;
+    }
+    
+    return nullptr;
+}
+
 bool FontLoader::CanLoad(const std::string& path) const {
     return IsValidFontFile(path);
 }
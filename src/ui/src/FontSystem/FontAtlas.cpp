@@ -39,6 +39,7 @@ FontAtlas::~FontAtlas() {
 bool FontAtlas::AddGlyph(uint32_t codepoint, const std::vector<unsigned char>& bitmap, 
                          int width, int height, const GlyphInfo& info) {
     DRIFT_PROFILE_FUNCTION();
+    PROFILE_MEMORY_TAG("Text");
     
     if (IsFull()) {
         DRIFT_LOG_WARNING("FontAtlas está cheio, não é possível adicionar mais glyphs");
@@ -78,6 +79,8 @@ bool FontAtlas::AddGlyph(uint32_t codepoint, const std::vector<unsigned char>& b
     // Atualizar textura
     UpdateTexture();
     
+    PROFILE_COUNTER("Text/GlyphsAdded", 1);
+    PROFILE_GAUGE("Text/AtlasUsage%", GetUsagePercentage());
     return true;
 }
 
@@ -130,6 +133,8 @@ bool FontAtlas::AddGlyphSDF(uint32_t codepoint, const std::vector<float>& sdfDat
     m_Regions.emplace_back(x, y, requiredWidth, requiredHeight, codepoint);
     
     UpdateTexture();
+    PROFILE_COUNTER("Text/GlyphsAdded", 1);
+    PROFILE_GAUGE("Text/AtlasUsage%", GetUsagePercentage());
     return true;
 }
 
@@ -181,6 +186,8 @@ bool FontAtlas::AddGlyphMSDF(uint32_t codepoint, const std::vector<glm::vec3>& m
     m_Regions.emplace_back(x, y, requiredWidth, requiredHeight, codepoint);
     
     UpdateTexture();
+    PROFILE_COUNTER("Text/GlyphsAdded", 1);
+    PROFILE_GAUGE("Text/AtlasUsage%", GetUsagePercentage());
     return true;
 }
 
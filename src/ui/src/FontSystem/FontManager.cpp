@@ -83,7 +83,7 @@ std::shared_ptr<Font> FontManager::LoadFont(const std::string& path, const FontL
     FontKey key{path, config.size, config.quality, config.format};
     
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
         auto it = m_Fonts.find(key);
         if (it != m_Fonts.end()) {
             UpdateCacheStats(true);
@@ -102,7 +102,7 @@ std::shared_ptr<Font> FontManager::LoadFont(const std::string& path, const FontL
     
     // Adicionar ao cache
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
         
         // Verificar se ainda há espaço
         if (m_Fonts.size() >= m_Config.maxFonts) {
@@ -130,7 +130,7 @@ std::shared_ptr<Font> FontManager::GetFont(const std::string& name, float size,
     
     // Tentar encontrar no cache por nome
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
         for (auto& pair : m_Fonts) {
             if (pair.second.font->GetName() == name && 
                 pair.second.font->GetSize() == size &&
@@ -162,7 +162,7 @@ std::shared_ptr<Font> FontManager::GetOrLoadFont(const std::string& path, const
     FontKey key{path, config.size, config.quality, config.format};
     
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
         auto it = m_Fonts.find(key);
         if (it != m_Fonts.end()) {
             UpdateCacheStats(true);
@@ -196,7 +196,7 @@ std::shared_ptr<Font> FontManager::GetFontAsset(const std::string& assetPath, co
     FontKey key{assetPath, config.size, config.quality, config.format};
     
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
         auto it = m_Fonts.find(key);
         if (it != m_Fonts.end()) {
             UpdateCacheStats(true);
@@ -246,7 +246,7 @@ void FontManager::PreloadFont(const std::string& path, const FontLoadConfig& con
     FontKey key{path, config.size, config.quality, config.format};
     
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
         if (m_Fonts.find(key) != m_Fonts.end()) {
             return; // Já está carregado
         }
@@ -256,7 +256,7 @@ void FontManager::PreloadFont(const std::string& path, const FontLoadConfig& con
     std::async(std::launch::async, [this, path, config]() {
         auto font = LoadFont(path, config);
         if (font) {
-            std::lock_guard<std::mutex> lock(m_Mutex);
+            std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
             FontKey key{path, config.size, config.quality, config.format};
             auto it = m_Fonts.find(key);
             if (it != m_Fonts.end()) {
@@ -277,7 +277,7 @@ void FontManager::PreloadFontAsset(const std::string& assetPath, const FontLoadC
     FontKey key{assetPath, config.size, config.quality, config.format};
     
     {
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
         if (m_Fonts.find(key) != m_Fonts.end()) {
             return;
         }
@@ -286,7 +286,7 @@ void FontManager::PreloadFontAsset(const std::string& assetPath, const FontLoadC
     std::async(std::launch::async, [this, assetPath, config]() {
         auto font = LoadFontAsset(assetPath, config);
         if (font) {
-            std::lock_guard<std::mutex> lock(m_Mutex);
+            std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
             FontKey key{assetPath, config.size, config.quality, config.format};
             auto it = m_Fonts.find(key);
             if (it != m_Fonts.end()) {
@@ -377,7 +377,7 @@ void FontManager::ClearUnusedAtlas() {
 void FontManager::ClearCache() {
     DRIFT_PROFILE_FUNCTION();
     
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
     m_Fonts.clear();
     m_FallbackFonts.clear();
     
@@ -387,7 +387,7 @@ void FontManager::ClearCache() {
 void FontManager::TrimCache() {
     DRIFT_PROFILE_FUNCTION();
     
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
     
     if (m_Fonts.size() <= m_Config.maxFonts) {
         return;
@@ -417,7 +417,7 @@ void FontManager::TrimCache() {
 void FontManager::UnloadUnusedFonts() {
     DRIFT_PROFILE_FUNCTION();
     
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
     
     size_t currentTime = GetCurrentTime();
     size_t unloadedCount = 0;
@@ -438,14 +438,14 @@ void FontManager::UnloadUnusedFonts() {
 }
 
 size_t FontManager::GetCacheSize() const {
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
     return m_Fonts.size();
 }
 
 FontManager::FontStats FontManager::GetStats() const {
     DRIFT_PROFILE_FUNCTION();
     
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
     
     FontStats stats;
     stats.totalFonts = m_Fonts.size();
@@ -511,7 +511,7 @@ void FontManager::LogStats() const {
 void FontManager::ResetStats() {
     DRIFT_PROFILE_FUNCTION();
     
-    std::lock_guard<std::mutex> lock(m_Mutex);
+    std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
     m_CacheHits = 0;
     m_CacheMisses = 0;
     m_FallbackUsage = 0;
@@ -531,7 +531,7 @@ std::shared_ptr<Font> FontManager::CreateFont(const std::string& path, const Fon
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
         
-        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::lock_guard<Drift::Core::ProfiledMutex> lock(m_Mutex);
         m_LoadCount++;
         m_TotalLoadTime += duration.count() / 1000.0; // Converter para ms
         
@@ -7,6 +7,7 @@
 #include "Drift/Engine/Input/InputManager.h"
 #include "Drift/UI/FontSystem/FontRendering.h"
 #include "Drift/UI/FontSystem/FontManager.h"
+#include "Drift/Core/Profiler.h"
 #include <glm/mat4x4.hpp>
 #include <mutex>
 #include <fstream>
@@ -88,6 +89,8 @@ void UIContext::SetDevice(Drift::RHI::IDevice* device)
 
 void UIContext::Update(float deltaSeconds)
 {
+    PROFILE_MEMORY_TAG("UI");
+    
     // Atualiza o sistema de input
     if (m_InputHandler) {
         m_InputHandler->Update(deltaSeconds);
@@ -116,6 +119,8 @@ void UIContext::Update(float deltaSeconds)
 
 void UIContext::Render(Drift::RHI::IUIBatcher& batch)
 {
+    PROFILE_MEMORY_TAG("UI");
+    
     // Configurar o batcher no TextRenderer antes de renderizar
     if (m_TextRenderer) {
         m_TextRenderer->SetBatcher(&batch);
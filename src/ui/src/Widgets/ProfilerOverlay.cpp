@@ -0,0 +1,140 @@
+#include "Drift/UI/Widgets/ProfilerOverlay.h"
+#include <algorithm>
+#include <cstdio>
+
+using namespace Drift::UI;
+
+namespace {
+
+constexpr Drift::Color COLOR_TEXT = 0xFFFFFFFF;
+constexpr Drift::Color COLOR_GRAPH_BACKGROUND = 0x80000000;
+constexpr Drift::Color COLOR_TARGET_LINE = 0xFFFFFFFF;
+constexpr Drift::Color COLOR_FRAME_OK = 0xFF40C040;         // Dentro do orçamento
+constexpr Drift::Color COLOR_FRAME_SLOW = 0xFFE0C020;       // Até 2x o orçamento
+constexpr Drift::Color COLOR_FRAME_SPIKE = 0xFFE04040;
+
+// Cores das barras de seção, repetidas em ordem
+constexpr Drift::Color SECTION_COLORS[] = {
+    0xA04080FF, 0xA040C0C0, 0xA0C080FF, 0xA0FF8040, 0xA080C040, 0xA0C04080, 0xA0FFC040, 0xA080A0C0
+};
+
+} // namespace
+
+ProfilerOverlay::ProfilerOverlay(UIContext* context)
+    : UIElement(context)
+{
+    SetName("ProfilerOverlay");
+    SetConfig(ProfilerOverlayConfig{});
+}
+
+void ProfilerOverlay::SetConfig(const ProfilerOverlayConfig& config)
+{
+    m_Config = config;
+    m_Config.graphFrames = std::max<size_t>(m_Config.graphFrames, 1);
+
+    m_FrameTimes.assign(m_Config.graphFrames, 0);
+    m_Sections.assign(m_Config.topSections, Drift::Core::ProfileFrameSection{});
+    m_SectionText.assign(m_Config.topSections, TextLine{});
+    m_FrameCount = 0;
+    m_SectionCount = 0;
+
+    // Cabeçalho, gráfico e uma linha por seção
+    float height = m_Config.padding * 3.0f + m_Config.lineHeight * (1 + m_Config.topSections) + m_Config.graphHeight;
+    SetSize(glm::vec2(m_Size.x > 0.0f ? m_Size.x : 360.0f, height));
+}
+
+void ProfilerOverlay::Update(float deltaSeconds)
+{
+    if (!IsVisible()) {
+        UIElement::Update(deltaSeconds);
+        return;
+    }
+    
+    auto& profiler = Drift::Core::Profiler::GetInstance();
+    m_FrameCount = profiler.CopyFrameTimes(m_FrameTimes.data(), m_FrameTimes.size());
+    m_SectionCount = profiler.CopyLastFrameSections(m_Sections.data(), m_Sections.size());
+    m_LastFrameNs = m_FrameCount > 0 ? m_FrameTimes[m_FrameCount - 1] : 0;
+
+    uint64_t totalNs = 0;
+    uint64_t maxNs = 0;
+    for (size_t i = 0; i < m_FrameCount; ++i) {
+        totalNs += m_FrameTimes[i];
+        maxNs = std::max(maxNs, m_FrameTimes[i]);
+    }
+    const double lastMs = m_LastFrameNs / 1000000.0;
+    const double averageMs = m_FrameCount > 0 ? totalNs / 1000000.0 / m_FrameCount : 0.0;
+    std::snprintf(m_HeaderText.data(), m_HeaderText.size(), "Frame %.2f ms (%.0f FPS) | média %.2f | máx %.2f",
+                  lastMs, averageMs > 0.0 ? 1000.0 / averageMs : 0.0, averageMs, maxNs / 1000000.0);
+
+    for (size_t i = 0; i < m_SectionCount; ++i) {
+        profiler.CopySectionName(m_Sections[i].section, m_NameScratch.data(), m_NameScratch.size());
+        const double sectionMs = m_Sections[i].timeNs / 1000000.0;
+        const double percent = m_LastFrameNs > 0 ? 100.0 * m_Sections[i].timeNs / m_LastFrameNs : 0.0;
+        std::snprintf(m_SectionText[i].data(), m_SectionText[i].size(), "%6.2f ms %5.1f%%  %s",
+                      sectionMs, percent, m_NameScratch.data());
+    }
+
+    UIElement::Update(deltaSeconds);
+}
+
+void ProfilerOverlay::Render(Drift::RHI::IUIBatcher& batch)
+{
+    if (!IsVisible() || GetOpacity() <= 0.0f || m_Size.x <= 0.0f) {
+        return;
+    }
+
+    const glm::vec2 pos = GetAbsolutePosition();
+    const float padding = m_Config.padding;
+    const float innerX = pos.x + padding;
+    const float innerWidth = std::max(m_Size.x - padding * 2.0f, 1.0f);
+    float y = pos.y + padding;
+
+    batch.AddRect(pos.x, pos.y, m_Size.x, m_Size.y, ApplyOpacity(m_Config.backgroundColor));
+    batch.AddText(innerX, y, m_HeaderText.data(), ApplyOpacity(COLOR_TEXT));
+    y += m_Config.lineHeight;
+
+    // Gráfico: frames mais novos à direita, linha no orçamento
+    const float graphHeight = m_Config.graphHeight;
+    const float maxMs = std::max(m_Config.graphMaxMs, 1.0f);
+    batch.AddRect(innerX, y, innerWidth, graphHeight, ApplyOpacity(COLOR_GRAPH_BACKGROUND));
+    const float barWidth = innerWidth / m_Config.graphFrames;
+    const size_t firstSlot = m_Config.graphFrames - m_FrameCount;
+    for (size_t i = 0; i < m_FrameCount; ++i) {
+        const double frameMs = m_FrameTimes[i] / 1000000.0;
+        const float barHeight = graphHeight * static_cast<float>(std::min(frameMs / maxMs, 1.0));
+        batch.AddRect(innerX + (firstSlot + i) * barWidth, y + graphHeight - barHeight,
+                      std::max(barWidth - 1.0f, 1.0f), barHeight, ApplyOpacity(GetFrameColor(frameMs)));
+    }
+    const float targetY = y + graphHeight - graphHeight * std::min(m_Config.targetFrameMs / maxMs, 1.0f);
+    batch.AddRect(innerX, targetY, innerWidth, 1.0f, ApplyOpacity(COLOR_TARGET_LINE));
+    y += graphHeight + padding;
+
+    // Seções: barra proporcional à fração do frame (inclusiva, então aninhadas se sobrepõem)
+    for (size_t i = 0; i < m_SectionCount; ++i) {
+        const float fraction = m_LastFrameNs > 0
+            ? std::min(static_cast<float>(m_Sections[i].timeNs) / m_LastFrameNs, 1.0f)
+            : 0.0f;
+        const Drift::Color barColor = SECTION_COLORS[i % (sizeof(SECTION_COLORS) / sizeof(SECTION_COLORS[0]))];
+        batch.AddRect(innerX, y + 1.0f, innerWidth * fraction, m_Config.lineHeight - 2.0f, ApplyOpacity(barColor));
+        batch.AddText(innerX + 2.0f, y, m_SectionText[i].data(), ApplyOpacity(COLOR_TEXT));
+        y += m_Config.lineHeight;
+    }
+
+    for (auto& child : m_Children) {
+        child->Render(batch);
+    }
+}
+
+Drift::Color ProfilerOverlay::ApplyOpacity(Drift::Color color) const
+{
+    unsigned alpha = static_cast<unsigned>(((color >> 24) & 0xFF) * m_Opacity);
+    return (color & 0x00FFFFFF) | (alpha << 24);
+}
+
+Drift::Color ProfilerOverlay::GetFrameColor(double frameMs) const
+{
+    if (frameMs <= m_Config.targetFrameMs) {
+        return COLOR_FRAME_OK;
+    }
+    return frameMs <= m_Config.targetFrameMs * 2.0 ? COLOR_FRAME_SLOW : COLOR_FRAME_SPIKE;
+}